@@ -0,0 +1,100 @@
+// Contention benchmark: ConcurrentEventQueue vs mutex-guarded EventQueue
+//
+// N producer threads each push M events, then the consumer drains into a
+// single EventQueue. Reports wall time per configuration.
+
+#include "ConcurrentEventQueue.hpp"
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace ECS;
+
+namespace {
+
+struct BenchPayload {
+    float amount = 0.0f;
+    uint32_t flags = 0;
+};
+
+constexpr int EVENTS_PER_PRODUCER = 200000;
+constexpr int ITERATIONS = 5;
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+double runMutexBaseline(int producers) {
+    EventQueue<BenchPayload> queue;
+    EventQueue<BenchPayload> drained;
+    std::mutex queueMutex;
+    double best = 1e30;
+
+    for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue, &queueMutex, p]() {
+                for (int i = 0; i < EVENTS_PER_PRODUCER; ++i) {
+                    std::lock_guard<std::mutex> lock(queueMutex);
+                    queue.push(static_cast<EntityID>(p), BenchPayload{1.0f, static_cast<uint32_t>(i)});
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        queue.processAndClear([&drained](const Event<BenchPayload>& event) { drained.push(event); });
+        drained.clear();
+        double ms = elapsedMs(start);
+        best = ms < best ? ms : best;
+    }
+    return best;
+}
+
+double runConcurrent(int producers) {
+    ConcurrentEventQueue<BenchPayload> queue(static_cast<size_t>(producers));
+    EventQueue<BenchPayload> drained;
+    double best = 1e30;
+
+    for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue, p]() {
+                for (int i = 0; i < EVENTS_PER_PRODUCER; ++i) {
+                    queue.push(static_cast<size_t>(p), static_cast<EntityID>(p), BenchPayload{1.0f, static_cast<uint32_t>(i)});
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        queue.drainInto(drained);
+        drained.clear();
+        double ms = elapsedMs(start);
+        best = ms < best ? ms : best;
+    }
+    return best;
+}
+
+} // namespace
+
+int main() {
+    unsigned hardwareThreads = std::thread::hardware_concurrency();
+    int maxProducers = hardwareThreads > 1 ? static_cast<int>(hardwareThreads) : 2;
+    if (maxProducers > 16) {
+        maxProducers = 16;
+    }
+
+    std::printf("EventQueue contention (%d events/producer, best of %d)\n", EVENTS_PER_PRODUCER, ITERATIONS);
+    std::printf("%-10s %14s %14s %10s\n", "Producers", "Mutex(ms)", "PerSlot(ms)", "Speedup");
+    for (int producers = 1; producers <= maxProducers; producers *= 2) {
+        double mutexMs = runMutexBaseline(producers);
+        double concurrentMs = runConcurrent(producers);
+        std::printf("%-10d %14.2f %14.2f %9.2fx\n", producers, mutexMs, concurrentMs, mutexMs / concurrentMs);
+    }
+    return 0;
+}
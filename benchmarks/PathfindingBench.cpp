@@ -0,0 +1,265 @@
+// Pathfinding benchmark: A* vs Jump Point Search vs HPA*, single and bulk
+//
+// For each map size (64x64 .. 1024x1024, fixed seed) and two layouts runs
+// the same random start/goal queries with A* and JPS on one thread, then the
+// JPS batch on a WorkerPool. Reports time per query and nodes expanded.
+// The HPA* columns time an abstract search plus refinement of every segment
+// (graph built once per map, build time listed separately) and give its
+// summed path cost relative to A*'s (1.000 = optimal).
+// Layouts: "noise" scatters 20% single-tile walls (worst case for JPS:
+// forced neighbours everywhere); "rooms" is a grid of 16x16 rooms with one
+// door per wall plus 3% scattered walls.
+//
+// Sample, 1024x1024, one core, gcc 12 -O2 (ms per query, A* / JPS / HPA*):
+//   noise  57.1 / 50.9 / 9.3  (HPA* cost 1.028 of A*, graph build 2338 ms)
+//   rooms  70.4 / 26.9 / 1.0  (HPA* cost 1.000, graph build 407 ms)
+// Runs on that machine vary by up to a third. JPS straight jumps scan 64
+// tiles per step; in one back-to-back pair the noise row went from
+// 39.8 / 35.0 before that change to 40.0 / 36.9 after (JPS time on noise is
+// dominated by its open list), while rooms gain 2.3x or more over A*.
+// A second table compares one flow field build (all units share it) with
+// one JPS query per unit toward the same goal.
+
+#include "FlowField.hpp"
+#include "HierarchicalPathfinder.hpp"
+#include "Pathfinder.hpp"
+#include "RandomGrid.hpp"
+#include "WorkerPool.hpp"
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace ECS;
+using RandomGrid::randomBelow;
+using RandomGrid::scatterWalls;
+
+namespace {
+
+constexpr int WALL_PERCENT = 20;
+constexpr int ROOM_SIZE = 16;
+constexpr int ROOM_CLUTTER_PERCENT = 3;
+constexpr int ITERATIONS = 3;
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void buildMap(TileMap& map, uint32_t seed) {
+    scatterWalls(map, seed, WALL_PERCENT);
+}
+
+void buildRooms(TileMap& map, uint32_t seed) {
+    int size = map.getWidth();
+    for (int line = 0; line < size; line += ROOM_SIZE) {
+        map.fillRect(line, 0, line, size - 1, TileFlag::Blocked);
+        map.fillRect(0, line, size - 1, line, TileFlag::Blocked);
+    }
+    for (int roomY = 0; roomY < size; roomY += ROOM_SIZE) {
+        for (int roomX = 0; roomX < size; roomX += ROOM_SIZE) {
+            map.set(roomX + 1 + randomBelow(seed, ROOM_SIZE - 1), roomY, TileFlag::Blocked, false);
+            map.set(roomX, roomY + 1 + randomBelow(seed, ROOM_SIZE - 1), TileFlag::Blocked, false);
+        }
+    }
+    scatterWalls(map, seed, ROOM_CLUTTER_PERCENT);
+}
+
+// Queries between walkable cells in opposite quarters of the map (long paths)
+std::vector<PathRequest> buildRequests(const TileMap& map, int count, PathAlgorithm algorithm, uint32_t seed) {
+    std::vector<PathRequest> requests;
+    int size = map.getWidth();
+    int quarter = size / 4;
+    while (static_cast<int>(requests.size()) < count) {
+        TileCoord start{randomBelow(seed, quarter), randomBelow(seed, size)};
+        TileCoord goal{size - 1 - randomBelow(seed, quarter), randomBelow(seed, size)};
+        if (map.isWalkable(start.x, start.y) && map.isWalkable(goal.x, goal.y)) {
+            requests.push_back(PathRequest{start, goal, algorithm});
+        }
+    }
+    return requests;
+}
+
+struct RunStats {
+    double msPerQuery = 0.0;
+    double expandedPerQuery = 0.0;
+    double totalCost = 0.0;
+    size_t found = 0;
+};
+
+RunStats runSerial(Pathfinder& pathfinder, const std::vector<PathRequest>& requests) {
+    RunStats stats;
+    PathResult result;
+    double best = 1e30;
+    for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+        size_t expanded = 0;
+        size_t found = 0;
+        double totalCost = 0.0;
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& request : requests) {
+            if (pathfinder.findPath(request, result)) {
+                found++;
+                totalCost += result.cost;
+            }
+            expanded += result.expanded;
+        }
+        double ms = elapsedMs(start);
+        best = ms < best ? ms : best;
+        stats.expandedPerQuery = static_cast<double>(expanded) / static_cast<double>(requests.size());
+        stats.totalCost = totalCost;
+        stats.found = found;
+    }
+    stats.msPerQuery = best / static_cast<double>(requests.size());
+    return stats;
+}
+
+// Abstract search plus full refinement per query (the graph is built by the caller)
+RunStats runHierarchical(HierarchicalPathfinder& hpa, const std::vector<PathRequest>& requests) {
+    RunStats stats;
+    HierarchicalPath route;
+    std::vector<TileCoord> steps;
+    double best = 1e30;
+    for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+        size_t found = 0;
+        double totalCost = 0.0;
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& request : requests) {
+            if (!hpa.findPath(request.start, request.goal, route)) {
+                continue;
+            }
+            steps.clear();
+            while (!route.isComplete()) {
+                if (!hpa.refineNext(route, steps)) {
+                    break;
+                }
+            }
+            found++;
+            totalCost += route.cost;
+        }
+        double ms = elapsedMs(start);
+        best = ms < best ? ms : best;
+        stats.totalCost = totalCost;
+        stats.found = found;
+    }
+    stats.msPerQuery = best / static_cast<double>(requests.size());
+    return stats;
+}
+
+double runBulk(Pathfinder& pathfinder, const std::vector<PathRequest>& requests) {
+    std::vector<PathResult> results;
+    double best = 1e30;
+    for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+        auto start = std::chrono::steady_clock::now();
+        pathfinder.findPaths(requests, results);
+        double ms = elapsedMs(start);
+        best = ms < best ? ms : best;
+    }
+    return best / static_cast<double>(requests.size());
+}
+
+// Build a field toward the map centre and walk every unit along it
+void runFlowField(const TileMap& map, const std::vector<PathRequest>& units, Pathfinder& pathfinder) {
+    int size = map.getWidth();
+    TileCoord goal{size / 2, size / 2};
+    for (int offset = 0; !map.isWalkable(goal.x, goal.y); ++offset) {
+        goal.x = size / 2 + offset;
+    }
+
+    FlowField field;
+    double buildMs = 1e30;
+    for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+        auto start = std::chrono::steady_clock::now();
+        field.build(map, {goal});
+        double ms = elapsedMs(start);
+        buildMs = ms < buildMs ? ms : buildMs;
+    }
+
+    size_t steps = 0;
+    auto followStart = std::chrono::steady_clock::now();
+    for (const auto& unit : units) {
+        TileCoord at = unit.start;
+        TileCoord next;
+        while (field.next(at, next)) {
+            at = next;
+            steps++;
+        }
+    }
+    double followMs = elapsedMs(followStart);
+
+    PathResult result;
+    auto searchStart = std::chrono::steady_clock::now();
+    for (const auto& unit : units) {
+        pathfinder.findPath(PathRequest{unit.start, goal, PathAlgorithm::JumpPoint}, result);
+    }
+    double searchMs = elapsedMs(searchStart);
+
+    char label[16];
+    std::snprintf(label, sizeof(label), "%dx%d", size, size);
+    std::printf("%-10s %7zu %12.3f %8zu %14.1f %14.3f\n",
+                label, units.size(), buildMs, field.getSweepCount(),
+                steps ? followMs * 1e6 / static_cast<double>(steps) : 0.0, searchMs);
+}
+
+} // namespace
+
+int main() {
+    unsigned hardwareThreads = std::thread::hardware_concurrency();
+    size_t workers = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    WorkerPool pool(workers);
+
+    std::printf("Pathfinding (8-connected, best of %d, %zu workers + caller for bulk)\n", ITERATIONS, workers);
+    for (int layout = 0; layout < 2; ++layout) {
+        std::printf("\n%s\n", layout == 0 ? "noise (20% walls)" : "rooms (16x16, 3% clutter)");
+        std::printf("%-10s %7s %12s %12s %12s %12s %9s %14s %12s %11s %14s\n",
+                    "Map", "Queries", "A*(ms/q)", "A*(nodes)", "JPS(ms/q)", "JPS(nodes)", "Speedup", "BulkJPS(ms/q)",
+                    "HPA*(ms/q)", "HPA*/A*", "HPA*build(ms)");
+
+        for (int size = 64; size <= 1024; size *= 2) {
+            TileMap map(size, size);
+            if (layout == 0) {
+                buildMap(map, static_cast<uint32_t>(size));
+            } else {
+                buildRooms(map, static_cast<uint32_t>(size));
+            }
+            int queries = size >= 512 ? 16 : 64;
+            std::vector<PathRequest> aStarRequests = buildRequests(map, queries, PathAlgorithm::AStar, 42u);
+            std::vector<PathRequest> jumpRequests = aStarRequests;
+            for (auto& request : jumpRequests) {
+                request.algorithm = PathAlgorithm::JumpPoint;
+            }
+
+            Pathfinder pathfinder(&map, &pool);
+            RunStats aStar = runSerial(pathfinder, aStarRequests);
+            RunStats jump = runSerial(pathfinder, jumpRequests);
+            double bulk = runBulk(pathfinder, jumpRequests);
+
+            auto buildStart = std::chrono::steady_clock::now();
+            HierarchicalPathfinder hpa(&map);
+            double hpaBuild = elapsedMs(buildStart);
+            RunStats hierarchical = runHierarchical(hpa, aStarRequests);
+            if (aStar.found != jump.found || aStar.found != hierarchical.found) {
+                std::printf("mismatch: A* found %zu, JPS found %zu, HPA* found %zu\n",
+                            aStar.found, jump.found, hierarchical.found);
+                return 1;
+            }
+
+            char label[16];
+            std::snprintf(label, sizeof(label), "%dx%d", size, size);
+            std::printf("%-10s %7d %12.3f %12.0f %12.3f %12.0f %8.2fx %14.3f %12.3f %11.3f %14.2f\n",
+                        label, queries, aStar.msPerQuery, aStar.expandedPerQuery,
+                        jump.msPerQuery, jump.expandedPerQuery, aStar.msPerQuery / jump.msPerQuery, bulk,
+                        hierarchical.msPerQuery, aStar.totalCost > 0.0 ? hierarchical.totalCost / aStar.totalCost : 1.0,
+                        hpaBuild);
+        }
+    }
+
+    std::printf("\nFlow field to the map centre vs one JPS query per unit\n");
+    std::printf("%-10s %7s %12s %8s %14s %14s\n",
+                "Map", "Units", "Build(ms)", "Sweeps", "Follow(ns/st)", "JPS total(ms)");
+    for (int size = 64; size <= 1024; size *= 2) {
+        TileMap map(size, size);
+        buildMap(map, static_cast<uint32_t>(size));
+        Pathfinder pathfinder(&map);
+        runFlowField(map, buildRequests(map, 256, PathAlgorithm::JumpPoint, 7u), pathfinder);
+    }
+    return 0;
+}
@@ -28,6 +28,29 @@ struct Position {
     }
 };
 
+/**
+ * PreviousPosition - Position at the start of the latest fixed simulation step
+ * 
+ * Features:
+ * - Snapshot of Position taken before each fixed-timestep update
+ * - Lets rendering interpolate between the last two simulation states
+ * - Zero-initialized by default (ZII compliant)
+ */
+struct PreviousPosition {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    
+    // Equality operators for testing
+    bool operator==(const PreviousPosition& other) const {
+        return x == other.x && y == other.y && z == other.z;
+    }
+    
+    bool operator!=(const PreviousPosition& other) const {
+        return !(*this == other);
+    }
+};
+
 /**
  * Rotation - Angular rotation for entities
  * 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Transform.hpp"
+#include "../../include/ComponentArray.hpp"
+#include "../../include/EntityManager.hpp"
 #include <cmath>
 
 namespace ECS {
@@ -119,6 +121,27 @@ void applyUniformScale(Scale& scale, float factor);
  */
 Position lerp(const Position& start, const Position& end, float t);
 
+/**
+ * Interpolate from the previous to the current simulation position
+ * @param previous Position at the start of the last fixed step
+ * @param current Position after the last fixed step
+ * @param alpha Fraction of a step elapsed since (FixedTimestep::getAlpha())
+ * @return Position to render this frame
+ */
+Position interpolate(const PreviousPosition& previous, const Position& current, float alpha);
+
+/**
+ * Snapshot every Position into PreviousPosition before a fixed simulation step
+ * Entities without a PreviousPosition get one (so the first frame does not jump)
+ * @param positions Current positions
+ * @param previousPositions Snapshot storage
+ * @param previousBit Component bit for PreviousPosition
+ * @param entityManager Entity manager for component mask updates
+ */
+void storePreviousPositions(const ComponentArray<Position>& positions,
+                            ComponentArray<PreviousPosition>& previousPositions,
+                            uint64_t previousBit, EntityManager& entityManager);
+
 /**
  * Check if two positions are approximately equal (within epsilon)
  * @param pos1 First position
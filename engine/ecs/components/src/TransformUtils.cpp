@@ -89,6 +89,27 @@ Position lerp(const Position& start, const Position& end, float t) {
     return result;
 }
 
+Position interpolate(const PreviousPosition& previous, const Position& current, float alpha) {
+    return lerp(Position{previous.x, previous.y, previous.z}, current, alpha);
+}
+
+void storePreviousPositions(const ComponentArray<Position>& positions,
+                            ComponentArray<PreviousPosition>& previousPositions,
+                            uint64_t previousBit, EntityManager& entityManager) {
+    const auto& current = positions.getComponents();
+    const auto& entityIDs = positions.getEntityIDs();
+    
+    for (size_t i = 0; i < current.size(); ++i) {
+        PreviousPosition snapshot{current[i].x, current[i].y, current[i].z};
+        PreviousPosition* previous = previousPositions.get(entityIDs[i]);
+        if (previous) {
+            *previous = snapshot;
+        } else {
+            previousPositions.add(entityIDs[i], snapshot, previousBit, entityManager);
+        }
+    }
+}
+
 bool approximately(const Position& pos1, const Position& pos2, float epsilon) {
     float dx = std::abs(pos2.x - pos1.x);
     float dy = std::abs(pos2.y - pos1.y);
@@ -305,4 +305,31 @@ TEST_F(TransformTest, CommonComponentCombinations) {
     EXPECT_EQ(fullTransform & rotationBit, rotationBit);
     EXPECT_EQ(fullTransform & scaleBit, scaleBit);
     EXPECT_EQ(fullTransform & gridBit, gridBit);
-}
\ No newline at end of file
+}
+
+// Test previous-position snapshots and interpolation
+TEST_F(TransformTest, PreviousPositionInterpolation) {
+    EntityManager entityManager;
+    ComponentArray<Position> positions;
+    ComponentArray<PreviousPosition> previousPositions;
+    uint64_t positionBit = getComponentBit<Position>();
+    uint64_t previousBit = getComponentBit<PreviousPosition>();
+    
+    Entity entity = entityManager.createEntity();
+    positions.add(entity.id, {10.0f, 0.0f, 0.0f}, positionBit, entityManager);
+    
+    // First snapshot adds the component at the current position
+    TransformUtils::storePreviousPositions(positions, previousPositions, previousBit, entityManager);
+    ASSERT_NE(previousPositions.get(entity.id), nullptr);
+    EXPECT_EQ(*previousPositions.get(entity.id), (PreviousPosition{10.0f, 0.0f, 0.0f}));
+    EXPECT_TRUE(entityManager.getEntityByID(entity.id)->hasComponent(previousBit));
+    
+    // Simulate a step, then interpolate halfway
+    positions.get(entity.id)->x = 20.0f;
+    Position halfway = TransformUtils::interpolate(*previousPositions.get(entity.id), *positions.get(entity.id), 0.5f);
+    EXPECT_FLOAT_EQ(halfway.x, 15.0f);
+    
+    TransformUtils::storePreviousPositions(positions, previousPositions, previousBit, entityManager);
+    EXPECT_FLOAT_EQ(previousPositions.get(entity.id)->x, 20.0f);
+    EXPECT_EQ(previousPositions.size(), 1u);
+}
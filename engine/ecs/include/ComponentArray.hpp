@@ -10,6 +10,45 @@
 
 namespace ECS {
 
+/**
+ * ComponentChanges - Per-frame batch of component lifecycle notifications
+ *
+ * Filled by ComponentArray while change tracking is enabled. Lists keep the
+ * order in which operations happened; an entity may appear in several lists
+ * within one frame (e.g. added then removed), so consumers should re-check
+ * ComponentArray::has() when the final state matters.
+ */
+struct ComponentChanges {
+    std::vector<EntityID> added;     // Component newly added to entity
+    std::vector<EntityID> removed;   // Component removed from entity
+    std::vector<EntityID> changed;   // Existing component overwritten or marked changed (deduplicated)
+
+    bool empty() const {
+        return added.empty() && removed.empty() && changed.empty();
+    }
+
+    void clear() {
+        added.clear();
+        removed.clear();
+        changed.clear();
+    }
+};
+
+/**
+ * ComponentObserver - Receives batched component lifecycle notifications
+ *
+ * Called once per non-empty list per dispatchChanges(), never per operation,
+ * so derived indices (spatial hash, occupancy, render batches) can update
+ * incrementally at a single point in the frame.
+ */
+class ComponentObserver {
+public:
+    virtual ~ComponentObserver() = default;
+    virtual void onComponentsAdded(const EntityID* entityIds, size_t count) { (void)entityIds; (void)count; }
+    virtual void onComponentsRemoved(const EntityID* entityIds, size_t count) { (void)entityIds; (void)count; }
+    virtual void onComponentsChanged(const EntityID* entityIds, size_t count) { (void)entityIds; (void)count; }
+};
+
 /**
  * ComponentArray - Struct-of-Arrays storage for components
  * 
@@ -43,6 +82,12 @@ private:
     std::vector<EntityID> entityIDs;          // SoA: Corresponding entity IDs  
     std::unordered_map<EntityID, size_t> entityIndex; // Fast entity->index lookup
 
+    // Change tracking (disabled by default - costs one branch per add/remove when off)
+    bool trackChanges = false;
+    ComponentChanges changes;
+    std::vector<uint8_t> changedFlags;        // Parallel to components: already in changes.changed?
+    std::vector<ComponentObserver*> observers;
+
 public:
     ComponentArray() = default;
     ~ComponentArray() = default;
@@ -60,6 +105,9 @@ public:
         if (it != entityIndex.end()) {
             // Update existing component
             components[it->second] = component;
+            if (trackChanges) {
+                recordChanged(it->second);
+            }
             return;
         }
 
@@ -67,6 +115,10 @@ public:
         components.push_back(component);
         entityIDs.push_back(entityId);
         entityIndex[entityId] = components.size() - 1;
+        if (trackChanges) {
+            changedFlags.push_back(0);
+            changes.added.push_back(entityId);
+        }
 
         // Update entity bitmask IN EntityManager's stored entity (not a local copy)
         Entity* storedEntity = entityManager.getEntityByID(entityId);
@@ -115,6 +167,12 @@ public:
         entityIDs.pop_back();
         entityIndex.erase(it);
 
+        if (trackChanges) {
+            changedFlags[indexToRemove] = changedFlags.back();
+            changedFlags.pop_back();
+            changes.removed.push_back(entityId);
+        }
+
         // Clear component bit IN EntityManager's stored entity (not a local copy)
         Entity* storedEntity = entityManager.getEntityByID(entityId);
         if (storedEntity) {
@@ -132,8 +190,28 @@ public:
         return components.empty();
     }
     
+    // Get number of components storable without reallocation
+    size_t capacity() const {
+        return components.capacity();
+    }
+    
+    // Get entityIndex bucket count (for memory reporting)
+    size_t getIndexBucketCount() const {
+        return entityIndex.bucket_count();
+    }
+    
+    // Get heap bytes held by change tracking lists (for memory reporting)
+    size_t getChangeTrackingBytes() const {
+        return (changes.added.capacity() + changes.removed.capacity() + changes.changed.capacity()) * sizeof(EntityID)
+             + changedFlags.capacity() + observers.capacity() * sizeof(ComponentObserver*);
+    }
+    
     // Clear all components
     void clear() {
+        if (trackChanges) {
+            changes.removed.insert(changes.removed.end(), entityIDs.begin(), entityIDs.end());
+            changedFlags.clear();
+        }
         components.clear();
         entityIDs.clear();
         entityIndex.clear();
@@ -171,6 +249,91 @@ public:
     const std::vector<EntityID>& getEntityIDs() const {
         return entityIDs;
     }
+    
+    // Change tracking - batched lifecycle notifications
+    
+    // Enable/disable recording of added/removed/changed entities
+    // Disabling drops any pending changes
+    void setChangeTracking(bool enabled) {
+        if (enabled == trackChanges) {
+            return;
+        }
+        trackChanges = enabled;
+        changes.clear();
+        changedFlags.assign(enabled ? components.size() : 0, 0);
+    }
+    
+    bool isChangeTrackingEnabled() const {
+        return trackChanges;
+    }
+    
+    // Record an in-place modification made through get()/getByIndex()
+    // Each entity is listed at most once per batch. No-op if tracking is off.
+    void markChanged(EntityID entityId) {
+        if (!trackChanges) {
+            return;
+        }
+        auto it = entityIndex.find(entityId);
+        if (it != entityIndex.end()) {
+            recordChanged(it->second);
+        }
+    }
+    
+    // Get changes recorded since the last clearChanges()/dispatchChanges()
+    const ComponentChanges& getChanges() const {
+        return changes;
+    }
+    
+    // Drop recorded changes (call once per frame after all consumers have read them)
+    void clearChanges() {
+        for (EntityID id : changes.changed) {
+            auto it = entityIndex.find(id);
+            if (it != entityIndex.end()) {
+                changedFlags[it->second] = 0;
+            }
+        }
+        changes.clear();
+    }
+    
+    // Register an observer (enables change tracking). Observer must outlive registration.
+    void addObserver(ComponentObserver* observer) {
+        if (observer && std::find(observers.begin(), observers.end(), observer) == observers.end()) {
+            observers.push_back(observer);
+            setChangeTracking(true);
+        }
+    }
+    
+    void removeObserver(ComponentObserver* observer) {
+        observers.erase(std::remove(observers.begin(), observers.end(), observer), observers.end());
+    }
+    
+    size_t getObserverCount() const {
+        return observers.size();
+    }
+    
+    // Deliver recorded changes to all observers (one call per non-empty list), then clear
+    void dispatchChanges() {
+        for (ComponentObserver* observer : observers) {
+            if (!changes.added.empty()) {
+                observer->onComponentsAdded(changes.added.data(), changes.added.size());
+            }
+            if (!changes.removed.empty()) {
+                observer->onComponentsRemoved(changes.removed.data(), changes.removed.size());
+            }
+            if (!changes.changed.empty()) {
+                observer->onComponentsChanged(changes.changed.data(), changes.changed.size());
+            }
+        }
+        clearChanges();
+    }
+
+private:
+    void recordChanged(size_t index) {
+        if (!changedFlags[index]) {
+            changedFlags[index] = 1;
+            changes.changed.push_back(entityIDs[index]);
+        }
+    }
 };
 
 } // namespace ECS
\ No newline at end of file
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "Event.hpp"
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * ConcurrentEventQueue<T> - Multi-producer, single-consumer event queue
+ *
+ * Lets systems running on worker threads push Event<T> without locks.
+ * Each producer slot owns a private append buffer (padded to its own cache
+ * line to avoid false sharing); the consumer merges all slots at a sync
+ * point after the producing jobs have finished.
+ *
+ * Determinism: drained events are ordered by producer slot, then push order
+ * within the slot. Assign slots by job index (not thread ID) and the drain
+ * order is identical across runs regardless of thread scheduling.
+ *
+ * Threading contract:
+ * - A slot is written by at most one thread between sync points
+ * - drain()/drainInto() run only after all producers have joined
+ * - Buffers keep their capacity across drains (no steady-state allocation)
+ *
+ * Usage:
+ *   ConcurrentEventQueue<DamagePayload> damage(workerCount);
+ *   // in job i:
+ *   damage.push(i, attackerId, DamagePayload{10});
+ *   // after jobs join:
+ *   damage.drainInto(damageQueue);
+ */
+template <typename T>
+class ConcurrentEventQueue {
+private:
+    struct alignas(64) ProducerBuffer {
+        std::vector<Event<T>> events;
+    };
+
+    std::vector<ProducerBuffer> buffers;
+
+public:
+    /**
+     * Construct with a fixed number of producer slots
+     * @param producerCount Number of concurrent producers (e.g. worker/job count)
+     */
+    explicit ConcurrentEventQueue(size_t producerCount) : buffers(producerCount) {}
+    ~ConcurrentEventQueue() = default;
+
+    // Non-copyable but movable
+    ConcurrentEventQueue(const ConcurrentEventQueue&) = delete;
+    ConcurrentEventQueue& operator=(const ConcurrentEventQueue&) = delete;
+    ConcurrentEventQueue(ConcurrentEventQueue&&) = default;
+    ConcurrentEventQueue& operator=(ConcurrentEventQueue&&) = default;
+
+    // Add event from a producer slot (wait-free: touches only the slot's buffer)
+    void push(size_t producer, const Event<T>& event);
+    void push(size_t producer, EntityID source, const T& payload);
+    void push(size_t producer, const T& payload);
+
+    // Append all events to a regular queue in deterministic order, then clear slots
+    // @return Number of events moved
+    size_t drainInto(EventQueue<T>& target);
+
+    // Invoke callback for all events in deterministic order, then clear slots
+    template <typename Func>
+    size_t drain(Func&& callback);
+
+    // Number of pending events across all slots (sync point only)
+    size_t size() const;
+
+    // Check if no events are pending (sync point only)
+    bool empty() const;
+
+    // Number of producer slots
+    size_t getProducerCount() const;
+
+    // Reserve per-slot capacity
+    void reserve(size_t capacityPerProducer);
+
+    // Drop pending events (capacity kept)
+    void clear();
+};
+
+// Template implementations (must be inline for templates)
+
+template <typename T>
+void ConcurrentEventQueue<T>::push(size_t producer, const Event<T>& event) {
+    assert(producer < buffers.size());
+    buffers[producer].events.push_back(event);
+}
+
+template <typename T>
+void ConcurrentEventQueue<T>::push(size_t producer, EntityID source, const T& payload) {
+    assert(producer < buffers.size());
+    buffers[producer].events.emplace_back(source, payload);
+}
+
+template <typename T>
+void ConcurrentEventQueue<T>::push(size_t producer, const T& payload) {
+    assert(producer < buffers.size());
+    buffers[producer].events.emplace_back(payload);
+}
+
+template <typename T>
+size_t ConcurrentEventQueue<T>::drainInto(EventQueue<T>& target) {
+    size_t moved = 0;
+    for (auto& buffer : buffers) {
+        for (const auto& event : buffer.events) {
+            target.push(event);
+        }
+        moved += buffer.events.size();
+        buffer.events.clear();
+    }
+    return moved;
+}
+
+template <typename T>
+template <typename Func>
+size_t ConcurrentEventQueue<T>::drain(Func&& callback) {
+    size_t processed = 0;
+    for (auto& buffer : buffers) {
+        for (const auto& event : buffer.events) {
+            callback(event);
+        }
+        processed += buffer.events.size();
+        buffer.events.clear();
+    }
+    return processed;
+}
+
+template <typename T>
+size_t ConcurrentEventQueue<T>::size() const {
+    size_t total = 0;
+    for (const auto& buffer : buffers) {
+        total += buffer.events.size();
+    }
+    return total;
+}
+
+template <typename T>
+bool ConcurrentEventQueue<T>::empty() const {
+    for (const auto& buffer : buffers) {
+        if (!buffer.events.empty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+size_t ConcurrentEventQueue<T>::getProducerCount() const {
+    return buffers.size();
+}
+
+template <typename T>
+void ConcurrentEventQueue<T>::reserve(size_t capacityPerProducer) {
+    for (auto& buffer : buffers) {
+        buffer.events.reserve(capacityPerProducer);
+    }
+}
+
+template <typename T>
+void ConcurrentEventQueue<T>::clear() {
+    for (auto& buffer : buffers) {
+        buffer.events.clear();
+    }
+}
+
+} // namespace ECS
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "Entity.h"
+#include "Resources.hpp"
 #include <vector>
 #include <queue>
+#include <cstddef>
 
 namespace ECS {
 
@@ -25,6 +27,7 @@ private:
     std::vector<bool> alive;               // Tracks which entity slots are alive (indexed by ID)
     std::queue<EntityID> freeIds;          // Pool of reusable entity IDs
     EntityID nextId = 1;                   // Next available entity ID (0 reserved for INVALID_ENTITY)
+    Resources resources;                   // World-level singleton resources
     
 public:
     EntityManager() = default;
@@ -72,6 +75,12 @@ public:
      */
     size_t getActiveEntityCount() const;
     
+    /**
+     * Count living entities that have every component in requiredMask
+     * Linear in slot count; meant for diagnostics (profiler), not hot loops.
+     */
+    size_t countEntitiesWith(uint64_t requiredMask) const;
+    
     /**
      * Get total number of entities including dead ones (total storage used)
      */
@@ -82,6 +91,17 @@ public:
      */
     size_t getDeadEntityCount() const;
     
+    /**
+     * Get number of entity slots storable without reallocation
+     */
+    size_t getSlotCapacity() const;
+    
+    /**
+     * Get heap bytes reserved by slot storage (entities, generations, alive flags, free list)
+     * The free list is estimated from its element count.
+     */
+    size_t getAllocatedBytes() const;
+    
     /**
      * Check if an entity slot is alive (not necessarily valid - use isValid for full validation)
      */
@@ -100,6 +120,13 @@ public:
      */
     std::vector<const Entity*> getAllEntitiesForIteration() const;
     
+    /**
+     * Get world-level singleton resources (turn counter, camera, grid size, ...)
+     * Resources are independent of entities and survive clear().
+     */
+    Resources& getResources();
+    const Resources& getResources() const;
+    
     /**
      * Clear all entities (for testing/reset)
      */
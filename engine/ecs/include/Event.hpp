@@ -52,6 +52,30 @@ struct Event {
     }
 };
 
+/**
+ * EventView<T> - Read-only, zero-copy view over a contiguous run of events
+ * 
+ * Lightweight (pointer + count) span used to hand event batches to consumers
+ * without copying. Valid until the owning buffer is next modified.
+ */
+template <typename T>
+class EventView {
+private:
+    const Event<T>* first = nullptr;
+    size_t count = 0;
+
+public:
+    EventView() = default;
+    EventView(const Event<T>* data, size_t size) : first(data), count(size) {}
+    
+    const Event<T>* begin() const { return first; }
+    const Event<T>* end() const { return first + count; }
+    const Event<T>* data() const { return first; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const Event<T>& operator[](size_t index) const { return first[index]; }
+};
+
 /**
  * EventQueue<T> - FIFO queue for strongly typed events
  * 
@@ -59,15 +83,27 @@ struct Event {
  * Systems can push events during processing and pop them in batch
  * for efficient processing.
  * 
+ * Double-buffered mode (zero allocation in steady state):
+ * - Producers push into the back buffer as usual
+ * - swapBuffers() at the frame boundary publishes the back buffer as the
+ *   front buffer and recycles the old front (cleared, capacity kept)
+ * - Consumers read readFront(), a zero-copy view that stays stable for the
+ *   whole frame even while new events are pushed
+ * Once both buffers have grown to the peak per-frame event count, no
+ * further allocation happens.
+ * 
  * Design decisions:
- * - popAll() returns by value for safety (no dangling references)
+ * - popAll() returns by value for safety (no dangling references); it hands
+ *   the buffer's capacity to the caller, so prefer swapBuffers()/readFront()
+ *   on hot paths
  * - clear() separate from popAll() for flexibility
  * - Non-copyable but movable for performance
  */
 template <typename T>
 class EventQueue {
 private:
-    std::vector<Event<T>> events;
+    std::vector<Event<T>> events;       // Back buffer: receives pushes
+    std::vector<Event<T>> frontEvents;  // Front buffer: published by swapBuffers()
 
 public:
     EventQueue() = default;
@@ -103,12 +139,22 @@ public:
     // Check if queue is empty
     bool empty() const;
     
-    // Clear all events without returning them
+    // Clear all events without returning them (pending and published; capacity is kept)
     void clear();
     
-    // Reserve space for performance
+    // Reserve space for performance (both buffers)
     void reserve(size_t capacity);
     
+    // Double-buffered mode: publish pending events as the front buffer
+    // The previous front buffer is cleared and reused as the new back buffer
+    void swapBuffers();
+    
+    // Double-buffered mode: zero-copy view of events published by the last swapBuffers()
+    EventView<T> readFront() const;
+    
+    // Double-buffered mode: number of events in the front buffer
+    size_t frontSize() const;
+    
     // Process events with callback function
     template<typename Func>
     void process(Func&& callback);
@@ -176,11 +222,29 @@ bool EventQueue<T>::empty() const {
 template <typename T>
 void EventQueue<T>::clear() {
     events.clear();
+    frontEvents.clear();
 }
 
 template <typename T>
 void EventQueue<T>::reserve(size_t capacity) {
     events.reserve(capacity);
+    frontEvents.reserve(capacity);
+}
+
+template <typename T>
+void EventQueue<T>::swapBuffers() {
+    frontEvents.clear();
+    frontEvents.swap(events);
+}
+
+template <typename T>
+EventView<T> EventQueue<T>::readFront() const {
+    return EventView<T>(frontEvents.data(), frontEvents.size());
+}
+
+template <typename T>
+size_t EventQueue<T>::frontSize() const {
+    return frontEvents.size();
 }
 
 template <typename T>
@@ -0,0 +1,281 @@
+#pragma once
+
+#include "Event.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * EventTypeRegistry - Automatic event type ID assignment
+ *
+ * Mirrors ResourceRegistry for event payload types: each payload type gets a
+ * dense ID on first use, which indexes EventBus channel storage directly.
+ *
+ * Thread-safe: IDs are assigned once via static initialization.
+ */
+namespace EventTypeRegistry {
+    // Global atomic counter for ID assignment
+    extern std::atomic<uint32_t> nextEventTypeId;
+}
+
+/**
+ * Get the event type ID for a given payload type.
+ * Assigns a new ID on first call, returns cached ID on subsequent calls.
+ */
+template <typename T>
+uint32_t getEventTypeId() {
+    static const uint32_t id = EventTypeRegistry::nextEventTypeId.fetch_add(1);
+    return id;
+}
+
+// Subscription handle returned by EventBus::subscribe (0 is never issued)
+using SubscriptionID = uint32_t;
+constexpr SubscriptionID INVALID_SUBSCRIPTION = 0;
+
+// Free-function handler: receives the subscriber's context and the frame's batch
+template <typename T>
+using EventHandler = void (*)(void* context, EventView<T> events);
+
+/**
+ * EventBus - Central owner of event queues with batched subscriber dispatch
+ *
+ * Replaces hand-wiring systems to standalone EventQueue<T> objects: the bus
+ * creates one double-buffered queue per payload type on first use, and
+ * systems subscribe by type.
+ *
+ * dispatch() (once per frame):
+ * - For each event type with a queue: swapBuffers(), then hand every
+ *   subscriber the whole front buffer as one EventView<T>
+ * - Cost is one indirect call per type plus one per subscriber, never
+ *   per event; handlers are plain function pointers + context (no
+ *   std::function, no allocation after the first frame)
+ * - Types are visited in event type ID order, subscribers in subscription
+ *   order, so dispatch order is deterministic
+ * - Events pushed by handlers land in the back buffer and are delivered
+ *   on the next dispatch()
+ *
+ * Usage:
+ *   EventBus bus;
+ *   bus.subscribe<MovePayload, SoundSystem, &SoundSystem::onMoves>(&soundSystem);
+ *   bus.push<MovePayload>(entity, MovePayload{1, 0});
+ *   bus.dispatch(); // SoundSystem::onMoves(EventView<MovePayload>)
+ *
+ * Subscribers must outlive their subscription (unsubscribe() before destruction).
+ */
+class EventBus {
+public:
+    EventBus() = default;
+    ~EventBus();
+
+    // Non-copyable but movable
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+    EventBus(EventBus&& other) noexcept;
+    EventBus& operator=(EventBus&& other) noexcept;
+
+    /**
+     * Get the queue for an event type, creating it on first use
+     */
+    template <typename T>
+    EventQueue<T>& getQueue();
+
+    /**
+     * Get the queue for an event type if it exists
+     * @return Queue pointer or nullptr
+     */
+    template <typename T>
+    EventQueue<T>* findQueue();
+
+    // Push into the type's back buffer (delivered on the next dispatch)
+    template <typename T>
+    void push(EntityID source, const T& payload);
+
+    template <typename T>
+    void push(const T& payload);
+
+    /**
+     * Subscribe a free function with an opaque context pointer
+     * @return Handle for unsubscribe()
+     */
+    template <typename T>
+    SubscriptionID subscribe(EventHandler<T> handler, void* context = nullptr);
+
+    /**
+     * Subscribe a member function: void Listener::Method(EventView<T>)
+     * The call is bound at compile time through a generated thunk.
+     */
+    template <typename T, typename Listener, void (Listener::*Method)(EventView<T>)>
+    SubscriptionID subscribe(Listener* listener);
+
+    /**
+     * Remove a subscription (safe to call from inside a handler)
+     * @return true if the subscription existed
+     */
+    bool unsubscribe(SubscriptionID id);
+
+    /**
+     * Swap every queue and deliver each type's batch to its subscribers
+     * @return Number of events delivered (each counted once, not per subscriber)
+     */
+    size_t dispatch();
+
+    /**
+     * Get number of active subscribers for an event type
+     */
+    template <typename T>
+    size_t getSubscriberCount() const;
+
+    /**
+     * Get number of event types with a queue
+     */
+    size_t getQueueCount() const;
+
+    /**
+     * Drop all pending and published events (queues and subscriptions kept)
+     */
+    void clearEvents();
+
+    /**
+     * Destroy all queues and subscriptions
+     */
+    void clear();
+
+private:
+    // Type-erased handler call: (context, typed handler or nullptr, events, count)
+    using Thunk = void (*)(void* context, void (*handler)(), const void* events, size_t count);
+
+    struct Subscriber {
+        SubscriptionID id = INVALID_SUBSCRIPTION;
+        void* context = nullptr;
+        void (*handler)() = nullptr;   // Typed EventHandler<T> erased; unused for member thunks
+        Thunk thunk = nullptr;
+    };
+
+    struct Channel {
+        void* queue = nullptr;
+        void (*destroy)(void*) = nullptr;
+        size_t (*swap)(void* queue, const void** front) = nullptr; // swapBuffers + publish front
+        void (*clearQueue)(void*) = nullptr;
+        std::vector<Subscriber> subscribers;
+        const void* front = nullptr;      // Published batch for the current dispatch
+        size_t frontCount = 0;
+    };
+
+    template <typename T>
+    static void destroyQueue(void* queue) {
+        delete static_cast<EventQueue<T>*>(queue);
+    }
+
+    template <typename T>
+    static size_t swapQueue(void* queue, const void** front) {
+        auto* typed = static_cast<EventQueue<T>*>(queue);
+        typed->swapBuffers();
+        EventView<T> view = typed->readFront();
+        *front = view.data();
+        return view.size();
+    }
+
+    template <typename T>
+    static void clearTypedQueue(void* queue) {
+        // Clear the back buffer, then swap so the front is empty too
+        auto* typed = static_cast<EventQueue<T>*>(queue);
+        typed->clear();
+        typed->swapBuffers();
+    }
+
+    template <typename T>
+    static void invokeFunction(void* context, void (*handler)(), const void* events, size_t count) {
+        reinterpret_cast<EventHandler<T>>(handler)(
+            context, EventView<T>(static_cast<const Event<T>*>(events), count));
+    }
+
+    template <typename T, typename S, void (S::*Method)(EventView<T>)>
+    static void invokeMember(void* context, void (*handler)(), const void* events, size_t count) {
+        (void)handler; // Suppress unused parameter warning
+        (static_cast<S*>(context)->*Method)(EventView<T>(static_cast<const Event<T>*>(events), count));
+    }
+
+    template <typename T>
+    Channel& getChannel();
+
+    SubscriptionID addSubscriber(Channel& channel, void* context, void (*handler)(), Thunk thunk);
+
+    std::vector<Channel> channels;      // Indexed by event type ID
+    SubscriptionID nextSubscriptionId = 1;
+    bool dispatching = false;
+    bool pendingRemovals = false;
+};
+
+// Template implementations (must be inline for templates)
+
+template <typename T>
+EventBus::Channel& EventBus::getChannel() {
+    uint32_t id = getEventTypeId<T>();
+    if (id >= channels.size()) {
+        channels.resize(id + 1);
+    }
+    Channel& channel = channels[id];
+    if (!channel.queue) {
+        channel.queue = new EventQueue<T>();
+        channel.destroy = &EventBus::destroyQueue<T>;
+        channel.swap = &EventBus::swapQueue<T>;
+        channel.clearQueue = &EventBus::clearTypedQueue<T>;
+    }
+    return channel;
+}
+
+template <typename T>
+EventQueue<T>& EventBus::getQueue() {
+    return *static_cast<EventQueue<T>*>(getChannel<T>().queue);
+}
+
+template <typename T>
+EventQueue<T>* EventBus::findQueue() {
+    uint32_t id = getEventTypeId<T>();
+    if (id >= channels.size()) {
+        return nullptr;
+    }
+    return static_cast<EventQueue<T>*>(channels[id].queue);
+}
+
+template <typename T>
+void EventBus::push(EntityID source, const T& payload) {
+    getQueue<T>().push(source, payload);
+}
+
+template <typename T>
+void EventBus::push(const T& payload) {
+    getQueue<T>().push(payload);
+}
+
+template <typename T>
+SubscriptionID EventBus::subscribe(EventHandler<T> handler, void* context) {
+    return addSubscriber(getChannel<T>(), context,
+                         reinterpret_cast<void (*)()>(handler), &EventBus::invokeFunction<T>);
+}
+
+template <typename T, typename Listener, void (Listener::*Method)(EventView<T>)>
+SubscriptionID EventBus::subscribe(Listener* listener) {
+    return addSubscriber(getChannel<T>(), listener, nullptr,
+                         &EventBus::invokeMember<T, Listener, Method>);
+}
+
+template <typename T>
+size_t EventBus::getSubscriberCount() const {
+    uint32_t id = getEventTypeId<T>();
+    if (id >= channels.size()) {
+        return 0;
+    }
+    size_t count = 0;
+    for (const auto& subscriber : channels[id].subscribers) {
+        if (subscriber.thunk) {
+            count++;
+        }
+    }
+    return count;
+}
+
+} // namespace ECS
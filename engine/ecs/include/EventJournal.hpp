@@ -0,0 +1,320 @@
+#pragma once
+
+#include "Event.hpp"
+#include "EventBus.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+namespace ECS {
+
+class IInputManager;
+
+/**
+ * InputFrame - POD snapshot of one frame of input
+ *
+ * Key state is stored as bitsets over key codes [0, KEY_COUNT), which covers
+ * every KeyCode constant. Captured from any IInputManager and replayed
+ * through ReplayInputManager.
+ */
+struct InputFrame {
+    static constexpr int KEY_COUNT = 128;
+    static constexpr int MOUSE_BUTTON_COUNT = 3;
+
+    uint64_t keysDown[KEY_COUNT / 64] = {};
+    uint64_t keysPressed[KEY_COUNT / 64] = {};   // Just pressed this frame
+    uint64_t keysReleased[KEY_COUNT / 64] = {};  // Just released this frame
+    int32_t mouseX = 0;
+    int32_t mouseY = 0;
+    uint8_t mouseDown = 0;                       // Bit per button
+    uint8_t mousePressed = 0;                    // Just pressed this frame
+
+    /**
+     * Snapshot the current state of an input manager
+     */
+    static InputFrame capture(const IInputManager& input);
+
+    bool isKeyDown(int keyCode) const { return testBit(keysDown, keyCode); }
+    bool isKeyPressed(int keyCode) const { return testBit(keysPressed, keyCode); }
+    bool isKeyReleased(int keyCode) const { return testBit(keysReleased, keyCode); }
+
+    static bool testBit(const uint64_t* bits, int index) {
+        return index >= 0 && index < KEY_COUNT && ((bits[index >> 6] >> (index & 63)) & 1ULL) != 0;
+    }
+
+    static void setBit(uint64_t* bits, int index) {
+        if (index >= 0 && index < KEY_COUNT) {
+            bits[index >> 6] |= 1ULL << (index & 63);
+        }
+    }
+};
+
+/**
+ * EventJournal - Compact binary record of per-frame events and input
+ *
+ * Registered queues are snapshotted once per frame; each non-empty queue
+ * becomes one record holding its Event<T> array memcpy'd as-is, so payloads
+ * must be trivially copyable. Types are identified by caller-chosen 16-bit
+ * tags rather than getEventTypeId<T>(), because runtime type IDs depend on
+ * first-use order and are not stable across builds.
+ *
+ * Record stream (little-endian host layout, not portable across ABIs):
+ *   [u8 FRAME][u64 frame]
+ *   [u8 INPUT][InputFrame]
+ *   [u8 EVENTS][u16 tag][u16 eventSize][u32 count][count * eventSize bytes]
+ *
+ * A seek index maps every indexInterval-th frame to its byte offset, so
+ * JournalReplayer::seek() jumps close to the target and scans forward.
+ * save() appends the index as a footer; load() reads it back (or rebuilds
+ * it by scanning if the footer is missing).
+ *
+ * Usage (recording):
+ *   journal.registerQueue<MovePayload>(1, moveQueue);
+ *   // each frame, after producers push and before consumers drain:
+ *   journal.recordFrame(frame, &inputManager);
+ */
+class EventJournal {
+public:
+    enum RecordKind : uint8_t {
+        RECORD_FRAME = 1,
+        RECORD_INPUT = 2,
+        RECORD_EVENTS = 3
+    };
+
+    struct IndexEntry {
+        uint64_t frame = 0;
+        uint64_t offset = 0;
+    };
+
+    static constexpr uint32_t FILE_MAGIC = 0x314A5645;    // "EVJ1"
+    static constexpr uint32_t FOOTER_MAGIC = 0x584A5645;  // "EVJX"
+    static constexpr uint32_t FILE_VERSION = 1;
+
+    /**
+     * @param indexInterval Frames between seek index entries
+     */
+    explicit EventJournal(uint32_t indexInterval = 30);
+
+    // Non-copyable but movable
+    EventJournal(const EventJournal&) = delete;
+    EventJournal& operator=(const EventJournal&) = delete;
+    EventJournal(EventJournal&&) = default;
+    EventJournal& operator=(EventJournal&&) = default;
+
+    /**
+     * Register a queue to snapshot on every recordEvents()
+     * The queue's back buffer (pending pushes) is recorded.
+     */
+    template <typename T>
+    void registerQueue(uint16_t tag, const EventQueue<T>& queue);
+
+    /**
+     * Register an event bus type (its queue is created if needed)
+     */
+    template <typename T>
+    void registerBusType(uint16_t tag, EventBus& bus);
+
+    /**
+     * Start a frame record (adds a seek index entry every indexInterval frames)
+     */
+    void beginFrame(uint64_t frame);
+
+    /**
+     * Record an input snapshot for the current frame
+     */
+    void recordInput(const InputFrame& input);
+
+    /**
+     * Snapshot every registered queue into the current frame
+     */
+    void recordEvents();
+
+    /**
+     * Record an explicit batch of events for the current frame
+     */
+    template <typename T>
+    void record(uint16_t tag, const Event<T>* events, size_t count);
+
+    /**
+     * beginFrame + optional input capture + recordEvents
+     */
+    void recordFrame(uint64_t frame, const IInputManager* input = nullptr);
+
+    /**
+     * Raw record stream
+     */
+    const std::vector<uint8_t>& getData() const;
+    const std::vector<IndexEntry>& getIndex() const;
+    size_t getFrameCount() const;
+    size_t getSizeBytes() const;
+
+    /**
+     * Write header, records and seek index footer
+     * @return false on stream error
+     */
+    bool save(std::ostream& out) const;
+
+    /**
+     * Replace contents from a stream written by save()
+     * @return false if the stream is not a journal
+     */
+    bool load(std::istream& in);
+
+    /**
+     * Drop all records (registrations kept)
+     */
+    void clear();
+
+private:
+    struct Source {
+        uint16_t tag = 0;
+        uint16_t eventSize = 0;
+        const void* queue = nullptr;
+        size_t (*snapshot)(const void* queue, const void** data) = nullptr;
+    };
+
+    template <typename T>
+    static size_t snapshotQueue(const void* queue, const void** data) {
+        const auto& events = static_cast<const EventQueue<T>*>(queue)->peek();
+        *data = events.data();
+        return events.size();
+    }
+
+    void writeBytes(const void* bytes, size_t size);
+    void writeEvents(uint16_t tag, uint16_t eventSize, const void* events, size_t count);
+    void rebuildIndex();
+
+    std::vector<uint8_t> data;
+    std::vector<IndexEntry> index;
+    std::vector<Source> sources;
+    uint32_t indexInterval;
+    size_t frameCount = 0;
+};
+
+/**
+ * JournalReplayer - Feeds a recorded journal back into queues frame by frame
+ *
+ * Bind each tag to a destination queue or bus; replayFrame() pushes that
+ * frame's events and exposes its input snapshot (see ReplayInputManager).
+ * Unbound tags and records whose event size no longer matches the bound
+ * type are skipped (and counted).
+ *
+ * seek() only repositions the event stream; restore world state for that
+ * frame separately (e.g. RewindBuffer or a saved scenario) before replaying.
+ *
+ * Usage (headless):
+ *   JournalReplayer replayer(journal);
+ *   replayer.bindQueue<MovePayload>(1, moveQueue);
+ *   while (replayer.replayFrame()) {
+ *       replayInput.setFrame(replayer.getInput());
+ *       systemManager.updateAll(entityManager, step);
+ *   }
+ */
+class JournalReplayer {
+public:
+    explicit JournalReplayer(const EventJournal& journal);
+
+    template <typename T>
+    void bindQueue(uint16_t tag, EventQueue<T>& queue);
+
+    template <typename T>
+    void bindBus(uint16_t tag, EventBus& bus);
+
+    /**
+     * Position at the first recorded frame >= frame
+     * @return false if no such frame exists
+     */
+    bool seek(uint64_t frame);
+
+    /**
+     * Replay the next recorded frame
+     * @return false when the journal is exhausted
+     */
+    bool replayFrame();
+
+    /**
+     * Frame number of the last replayed frame
+     */
+    uint64_t getCurrentFrame() const;
+
+    /**
+     * Input of the last replayed frame (default state if none was recorded)
+     */
+    const InputFrame& getInput() const;
+    bool hasInput() const;
+
+    bool atEnd() const;
+    size_t getSkippedRecordCount() const;
+
+private:
+    struct Sink {
+        uint16_t tag = 0;
+        uint16_t eventSize = 0;
+        void* target = nullptr;
+        void (*push)(void* target, const uint8_t* events, size_t count) = nullptr;
+    };
+
+    template <typename T>
+    static void pushToQueue(void* target, const uint8_t* events, size_t count) {
+        auto* queue = static_cast<EventQueue<T>*>(target);
+        Event<T> event;
+        for (size_t i = 0; i < count; ++i) {
+            std::memcpy(&event, events + i * sizeof(Event<T>), sizeof(Event<T>));
+            queue->push(event);
+        }
+    }
+
+    template <typename T>
+    static void pushToBus(void* target, const uint8_t* events, size_t count) {
+        pushToQueue<T>(&static_cast<EventBus*>(target)->getQueue<T>(), events, count);
+    }
+
+    void addSink(const Sink& sink);
+    const Sink* findSink(uint16_t tag) const;
+
+    const EventJournal& journal;
+    std::vector<Sink> sinks;
+    size_t cursor = 0;
+    uint64_t currentFrame = 0;
+    InputFrame input;
+    bool inputValid = false;
+    size_t skippedRecords = 0;
+};
+
+// Template implementations (must be inline for templates)
+
+template <typename T>
+void EventJournal::registerQueue(uint16_t tag, const EventQueue<T>& queue) {
+    static_assert(std::is_trivially_copyable_v<Event<T>>, "Journaled event payloads must be trivially copyable");
+    static_assert(sizeof(Event<T>) <= UINT16_MAX, "Journaled event too large");
+    sources.push_back({tag, static_cast<uint16_t>(sizeof(Event<T>)), &queue, &EventJournal::snapshotQueue<T>});
+}
+
+template <typename T>
+void EventJournal::registerBusType(uint16_t tag, EventBus& bus) {
+    registerQueue<T>(tag, bus.getQueue<T>());
+}
+
+template <typename T>
+void EventJournal::record(uint16_t tag, const Event<T>* events, size_t count) {
+    static_assert(std::is_trivially_copyable_v<Event<T>>, "Journaled event payloads must be trivially copyable");
+    writeEvents(tag, static_cast<uint16_t>(sizeof(Event<T>)), events, count);
+}
+
+template <typename T>
+void JournalReplayer::bindQueue(uint16_t tag, EventQueue<T>& queue) {
+    static_assert(std::is_trivially_copyable_v<Event<T>>, "Journaled event payloads must be trivially copyable");
+    addSink({tag, static_cast<uint16_t>(sizeof(Event<T>)), &queue, &JournalReplayer::pushToQueue<T>});
+}
+
+template <typename T>
+void JournalReplayer::bindBus(uint16_t tag, EventBus& bus) {
+    static_assert(std::is_trivially_copyable_v<Event<T>>, "Journaled event payloads must be trivially copyable");
+    addSink({tag, static_cast<uint16_t>(sizeof(Event<T>)), &bus, &JournalReplayer::pushToBus<T>});
+}
+
+} // namespace ECS
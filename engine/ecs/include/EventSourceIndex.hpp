@@ -0,0 +1,240 @@
+#pragma once
+
+#include "Event.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * EventSourceIndex<T> - Per-frame grouping of events by source entity
+ *
+ * EventQueue hands every event to every consumer; a consumer that only
+ * cares about a few entities (e.g. MoveEvents of the selected train car)
+ * would otherwise scan the whole batch. build() groups a batch by
+ * Event<T>::source once, after which getEvents(E) is O(1) + k.
+ *
+ * Build pass:
+ * - Stable LSD radix sort of the batch by source (8-bit digits; digit
+ *   passes where every key shares the same byte are skipped, so dense
+ *   entity IDs below 65536 take at most two passes)
+ * - Events are gathered into one contiguous grouped array
+ * - A range table indexed by EntityID records each source's run; entries
+ *   are frame-stamped, so the table never needs clearing between builds.
+ *   EntityIDs are dense slot indices, so the table stays small; if a batch
+ *   holds an ID past DIRECT_TABLE_LIMIT, lookups fall back to a binary
+ *   search over the sorted sources instead of growing the table
+ *
+ * Within a source, events keep their original push order.
+ * All buffers are reused, so steady-state builds do not allocate.
+ *
+ * Usage:
+ *   EventSourceIndex<MovePayload> moveIndex;
+ *   moveIndex.drain(moveQueue);                  // index and clear the queue
+ *   for (const auto& event : moveIndex.getEvents(selectedCar)) { ... }
+ */
+template <typename T>
+class EventSourceIndex {
+public:
+    static constexpr EntityID DIRECT_TABLE_LIMIT = 1u << 20;
+
+    EventSourceIndex() = default;
+
+    // Non-copyable but movable
+    EventSourceIndex(const EventSourceIndex&) = delete;
+    EventSourceIndex& operator=(const EventSourceIndex&) = delete;
+    EventSourceIndex(EventSourceIndex&&) = default;
+    EventSourceIndex& operator=(EventSourceIndex&&) = default;
+
+    /**
+     * Index a batch of events (replaces the previous build)
+     */
+    void build(EventView<T> events);
+
+    /**
+     * Index a queue's pending events, then clear the queue (both buffers, capacity kept)
+     */
+    void drain(EventQueue<T>& queue);
+
+    /**
+     * Get the events from one source, in push order
+     * @return Empty view if the source had no events in the last build
+     */
+    EventView<T> getEvents(EntityID source) const;
+
+    /**
+     * Get all events of the last build, grouped by ascending source
+     */
+    EventView<T> getAll() const;
+
+    /**
+     * Get distinct sources of the last build, ascending
+     */
+    const std::vector<EntityID>& getSources() const;
+
+    /**
+     * Get total indexed events
+     */
+    size_t size() const;
+
+    /**
+     * Drop the current build
+     */
+    void clear();
+
+private:
+    struct Range {
+        uint32_t begin = 0;
+        uint32_t count = 0;
+        uint32_t stamp = 0;   // Valid only when equal to buildStamp
+    };
+
+    void radixSort(const Event<T>* events, size_t count);
+
+    std::vector<Event<T>> grouped;
+    std::vector<Range> ranges;        // Indexed by EntityID
+    std::vector<EntityID> sources;
+    std::vector<uint32_t> sourceBegins; // Parallel to sources (fallback lookup)
+    std::vector<uint32_t> order;      // Sorted permutation of batch indices
+    std::vector<uint32_t> scratch;
+    uint32_t buildStamp = 0;
+    bool directTable = true;
+};
+
+// Template implementations (must be inline for templates)
+
+template <typename T>
+void EventSourceIndex<T>::radixSort(const Event<T>* events, size_t count) {
+    constexpr size_t DIGITS = sizeof(EntityID);
+    size_t histogram[DIGITS][256];
+    std::memset(histogram, 0, sizeof(histogram));
+
+    // One pass builds all digit histograms
+    for (size_t i = 0; i < count; ++i) {
+        EntityID key = events[i].source;
+        for (size_t digit = 0; digit < DIGITS; ++digit) {
+            histogram[digit][(key >> (8 * digit)) & 0xFF]++;
+        }
+    }
+
+    order.resize(count);
+    scratch.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        order[i] = static_cast<uint32_t>(i);
+    }
+
+    const EntityID firstKey = events[0].source;
+    for (size_t digit = 0; digit < DIGITS; ++digit) {
+        const size_t shift = 8 * digit;
+        if (histogram[digit][(firstKey >> shift) & 0xFF] == count) {
+            continue; // Every key shares this byte: pass would be a no-op
+        }
+
+        size_t offsets[256];
+        size_t running = 0;
+        for (size_t bucket = 0; bucket < 256; ++bucket) {
+            offsets[bucket] = running;
+            running += histogram[digit][bucket];
+        }
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t index = order[i];
+            scratch[offsets[(events[index].source >> shift) & 0xFF]++] = index;
+        }
+        order.swap(scratch);
+    }
+}
+
+template <typename T>
+void EventSourceIndex<T>::build(EventView<T> events) {
+    grouped.clear();
+    sources.clear();
+    sourceBegins.clear();
+    directTable = true;
+    if (++buildStamp == 0) {
+        // Stamp wrapped: stale entries could alias, so reset the table once
+        for (auto& range : ranges) {
+            range.stamp = 0;
+        }
+        buildStamp = 1;
+    }
+    if (events.empty()) {
+        return;
+    }
+
+    radixSort(events.data(), events.size());
+
+    grouped.reserve(events.size());
+    for (uint32_t index : order) {
+        grouped.push_back(events[index]);
+    }
+
+    // Runs of equal source become ranges
+    const EntityID maxSource = grouped.back().source;
+    directTable = maxSource < DIRECT_TABLE_LIMIT;
+    if (directTable && ranges.size() <= maxSource) {
+        ranges.resize(static_cast<size_t>(maxSource) + 1);
+    }
+    for (size_t i = 0; i < grouped.size();) {
+        EntityID source = grouped[i].source;
+        size_t end = i + 1;
+        while (end < grouped.size() && grouped[end].source == source) {
+            end++;
+        }
+        if (directTable) {
+            ranges[source] = {static_cast<uint32_t>(i), static_cast<uint32_t>(end - i), buildStamp};
+        }
+        sources.push_back(source);
+        sourceBegins.push_back(static_cast<uint32_t>(i));
+        i = end;
+    }
+}
+
+template <typename T>
+void EventSourceIndex<T>::drain(EventQueue<T>& queue) {
+    const auto& pending = queue.peek();
+    build(EventView<T>(pending.data(), pending.size()));
+    queue.clear();
+}
+
+template <typename T>
+EventView<T> EventSourceIndex<T>::getEvents(EntityID source) const {
+    if (!directTable) {
+        auto it = std::lower_bound(sources.begin(), sources.end(), source);
+        if (it == sources.end() || *it != source) {
+            return EventView<T>();
+        }
+        size_t slot = static_cast<size_t>(it - sources.begin());
+        size_t end = slot + 1 < sourceBegins.size() ? sourceBegins[slot + 1] : grouped.size();
+        return EventView<T>(grouped.data() + sourceBegins[slot], end - sourceBegins[slot]);
+    }
+    if (source >= ranges.size() || ranges[source].stamp != buildStamp) {
+        return EventView<T>();
+    }
+    const Range& range = ranges[source];
+    return EventView<T>(grouped.data() + range.begin, range.count);
+}
+
+template <typename T>
+EventView<T> EventSourceIndex<T>::getAll() const {
+    return EventView<T>(grouped.data(), grouped.size());
+}
+
+template <typename T>
+const std::vector<EntityID>& EventSourceIndex<T>::getSources() const {
+    return sources;
+}
+
+template <typename T>
+size_t EventSourceIndex<T>::size() const {
+    return grouped.size();
+}
+
+template <typename T>
+void EventSourceIndex<T>::clear() {
+    build(EventView<T>());
+}
+
+} // namespace ECS
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "ComponentArray.hpp"
+#include "EntityManager.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * StorageStats - Memory usage snapshot of one ECS storage container
+ *
+ * Byte counts cover heap allocations owned by the container. Hash table
+ * node sizes are estimated (one next pointer + key/value pair per node),
+ * which matches common standard library implementations closely enough
+ * for sizing arenas and spotting growth.
+ *
+ * - bytesUsed: bytes holding live data
+ * - bytesAllocated: bytes reserved from the allocator
+ * - bytesWasted: bytesAllocated - bytesUsed (slack capacity, empty buckets, dead slots)
+ * - fragmentation: share of allocated bytes that hold no live data (0.0 - 1.0)
+ */
+struct StorageStats {
+    std::string name;
+    size_t liveCount = 0;        // Live elements (components or living entities)
+    size_t capacity = 0;         // Elements storable without reallocation
+    size_t bytesUsed = 0;
+    size_t bytesAllocated = 0;
+    size_t bytesWasted = 0;
+    size_t hashBuckets = 0;      // entityIndex bucket count (0 if no hash table)
+    float hashLoadFactor = 0.0f; // entityIndex elements per bucket
+    float fragmentation = 0.0f;
+};
+
+namespace MemoryStats {
+
+/**
+ * Estimate heap bytes used by an unordered_map's nodes and bucket array
+ */
+template <typename Key, typename Value>
+size_t estimateHashNodeBytes(size_t elementCount) {
+    return elementCount * (sizeof(void*) + sizeof(std::pair<const Key, Value>));
+}
+
+/**
+ * Fill bytesWasted and fragmentation from bytesUsed/bytesAllocated
+ */
+void finalize(StorageStats& stats);
+
+/**
+ * Collect stats for a ComponentArray (component data, entity IDs, entityIndex, change tracking)
+ */
+template <typename Component>
+StorageStats collect(const ComponentArray<Component>& array, const std::string& name = "") {
+    StorageStats stats;
+    stats.name = name;
+    stats.liveCount = array.size();
+    stats.capacity = array.capacity();
+    stats.hashBuckets = array.getIndexBucketCount();
+    stats.hashLoadFactor = stats.hashBuckets > 0
+        ? static_cast<float>(array.size()) / static_cast<float>(stats.hashBuckets)
+        : 0.0f;
+
+    const size_t slotBytes = sizeof(Component) + sizeof(EntityID);
+    const size_t nodeBytes = estimateHashNodeBytes<EntityID, size_t>(array.size());
+    const size_t bucketBytes = stats.hashBuckets * sizeof(void*);
+
+    stats.bytesUsed = array.size() * slotBytes + nodeBytes;
+    stats.bytesAllocated = array.capacity() * slotBytes + nodeBytes + bucketBytes
+                         + array.getChangeTrackingBytes();
+    finalize(stats);
+    return stats;
+}
+
+/**
+ * Collect stats for EntityManager slot storage (entities, generations, alive flags, free list)
+ * Dead slots count as wasted: they are kept for reuse but hold no live entity.
+ */
+StorageStats collect(const EntityManager& entityManager, const std::string& name = "EntityManager");
+
+} // namespace MemoryStats
+
+/**
+ * MemoryReport - Registry of ECS storage to report on each frame or on demand
+ *
+ * Register component arrays once at startup; collect() refreshes all stats
+ * into a reused vector so calling it every frame does not allocate after
+ * the first call (beyond name strings on first fill).
+ *
+ * Usage:
+ *   MemoryReport report;
+ *   report.track("Position", positions);
+ *   report.trackEntityManager(entityManager);
+ *   ...
+ *   report.collect();
+ *   report.writeCsv(file, frameNumber);   // per-frame export
+ *   LOG_INFO("Memory", report.formatTable());
+ *
+ * Tracked containers must outlive the report (or be untracked via clear()).
+ */
+class MemoryReport {
+public:
+    MemoryReport() = default;
+
+    /**
+     * Track a component array under a display name
+     */
+    template <typename Component>
+    void track(const std::string& name, const ComponentArray<Component>& array);
+
+    /**
+     * Track an entity manager's slot storage
+     */
+    void trackEntityManager(const EntityManager& entityManager, const std::string& name = "EntityManager");
+
+    /**
+     * Refresh stats for every tracked container
+     * @return Stats in registration order
+     */
+    const std::vector<StorageStats>& collect();
+
+    /**
+     * Get stats from the last collect()
+     */
+    const std::vector<StorageStats>& getStats() const;
+
+    /**
+     * Sum of bytesAllocated / bytesWasted across the last collect()
+     */
+    size_t getTotalBytesAllocated() const;
+    size_t getTotalBytesWasted() const;
+
+    /**
+     * Format the last collect() as a human-readable table
+     */
+    std::string formatTable() const;
+
+    /**
+     * Append the last collect() as CSV rows tagged with a frame number
+     * The header row is written on the first call (or when writeHeader is forced).
+     */
+    void writeCsv(std::ostream& out, uint64_t frame, bool forceHeader = false);
+
+    /**
+     * Get number of tracked containers
+     */
+    size_t getTrackedCount() const;
+
+    /**
+     * Stop tracking everything
+     */
+    void clear();
+
+private:
+    struct Source {
+        std::string name;
+        const void* container = nullptr;
+        StorageStats (*collectFn)(const void*, const std::string&) = nullptr;
+    };
+
+    template <typename Component>
+    static StorageStats collectArray(const void* container, const std::string& name) {
+        return MemoryStats::collect(*static_cast<const ComponentArray<Component>*>(container), name);
+    }
+
+    static StorageStats collectEntityManager(const void* container, const std::string& name);
+
+    std::vector<Source> sources;
+    std::vector<StorageStats> stats;
+    bool csvHeaderWritten = false;
+};
+
+template <typename Component>
+void MemoryReport::track(const std::string& name, const ComponentArray<Component>& array) {
+    sources.push_back({name, &array, &MemoryReport::collectArray<Component>});
+}
+
+} // namespace ECS
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * ResourceRegistry - Automatic resource ID assignment
+ *
+ * Mirrors ComponentRegistry for singleton resources: each resource type gets a
+ * dense ID on first use. The ID indexes Resources storage directly and doubles
+ * as a bit position for system read/write dependency masks.
+ *
+ * Usage:
+ *   uint32_t id = getResourceId<TurnCounter>();
+ *   uint64_t bit = getResourceBit<TurnCounter>();
+ *
+ * Thread-safe: IDs are assigned once via static initialization.
+ * Limitation: Dependency masks cover the first 64 resource types.
+ */
+namespace ResourceRegistry {
+    // Global atomic counter for ID assignment
+    extern std::atomic<uint32_t> nextResourceId;
+}
+
+/**
+ * Get the resource ID for a given type.
+ * Assigns a new ID on first call, returns cached ID on subsequent calls.
+ */
+template <typename Resource>
+uint32_t getResourceId() {
+    static const uint32_t id = ResourceRegistry::nextResourceId.fetch_add(1);
+    return id;
+}
+
+/**
+ * Get the dependency bit for a resource type (for ISystem read/write masks)
+ */
+template <typename Resource>
+uint64_t getResourceBit() {
+    uint32_t id = getResourceId<Resource>();
+    // IDs past 63 share the top bit, which is conservative for scheduling
+    return id < 64 ? (1ULL << id) : (1ULL << 63);
+}
+
+/**
+ * Get the number of registered resource types
+ */
+inline uint32_t getRegisteredResourceCount() {
+    return ResourceRegistry::nextResourceId.load();
+}
+
+/**
+ * Resources - Typed singleton storage for global world state
+ *
+ * Holds exactly one instance per type (turn counter, era theme, camera,
+ * grid dimensions, ...). Lookup is a vector index by resource ID, so access
+ * is constant time with no hashing, unlike a one-entity ComponentArray.
+ *
+ * Usage:
+ *   Resources& resources = entityManager.getResources();
+ *   resources.emplace<TurnCounter>(TurnCounter{0});
+ *   resources.get<TurnCounter>()->turn++;
+ *
+ * Pointers returned by get() stay valid until the resource is removed or
+ * replaced; adding other resources does not move existing ones.
+ */
+class Resources {
+public:
+    Resources() = default;
+    ~Resources();
+
+    // Non-copyable but movable
+    Resources(const Resources&) = delete;
+    Resources& operator=(const Resources&) = delete;
+    Resources(Resources&& other) noexcept;
+    Resources& operator=(Resources&& other) noexcept;
+
+    /**
+     * Create (or replace) the resource of type T
+     * @return Reference to the stored resource
+     */
+    template <typename T, typename... Args>
+    T& emplace(Args&&... args);
+
+    /**
+     * Get the resource of type T (returns nullptr if not registered)
+     */
+    template <typename T>
+    T* get();
+
+    template <typename T>
+    const T* get() const;
+
+    /**
+     * Check if a resource of type T is registered
+     */
+    template <typename T>
+    bool has() const;
+
+    /**
+     * Remove the resource of type T (no-op if not registered)
+     */
+    template <typename T>
+    void remove();
+
+    /**
+     * Get number of registered resources
+     */
+    size_t size() const;
+
+    /**
+     * Check if no resources are registered
+     */
+    bool empty() const;
+
+    /**
+     * Remove all resources
+     */
+    void clear();
+
+private:
+    struct Slot {
+        void* instance = nullptr;
+        void (*destroy)(void*) = nullptr;
+    };
+
+    template <typename T>
+    static void destroyInstance(void* instance) {
+        delete static_cast<T*>(instance);
+    }
+
+    void releaseSlot(Slot& slot);
+
+    std::vector<Slot> slots;  // Indexed by resource ID
+    size_t count = 0;
+};
+
+// Template implementations (must be inline for templates)
+
+template <typename T, typename... Args>
+T& Resources::emplace(Args&&... args) {
+    uint32_t id = getResourceId<T>();
+    if (id >= slots.size()) {
+        slots.resize(id + 1);
+    }
+
+    Slot& slot = slots[id];
+    releaseSlot(slot);
+
+    T* instance = new T{std::forward<Args>(args)...};
+    slot.instance = instance;
+    slot.destroy = &destroyInstance<T>;
+    count++;
+    return *instance;
+}
+
+template <typename T>
+T* Resources::get() {
+    uint32_t id = getResourceId<T>();
+    return id < slots.size() ? static_cast<T*>(slots[id].instance) : nullptr;
+}
+
+template <typename T>
+const T* Resources::get() const {
+    uint32_t id = getResourceId<T>();
+    return id < slots.size() ? static_cast<const T*>(slots[id].instance) : nullptr;
+}
+
+template <typename T>
+bool Resources::has() const {
+    return get<T>() != nullptr;
+}
+
+template <typename T>
+void Resources::remove() {
+    uint32_t id = getResourceId<T>();
+    if (id < slots.size()) {
+        releaseSlot(slots[id]);
+    }
+}
+
+} // namespace ECS
@@ -0,0 +1,265 @@
+#pragma once
+
+#include "Entity.h"
+#include "EntityManager.hpp"
+#include "ComponentArray.hpp"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * RewindBuffer - Per-turn history of component state for the time-travel mechanic
+ *
+ * Records the state of registered ComponentArrays once per turn and can restore
+ * any retained turn. Storage is delta-compressed:
+ * - Each tracked array is serialized slot-by-slot (entity ID + component bytes)
+ * - A turn stores the XOR of its serialized state against the previous turn,
+ *   run-length encoded so unchanged slots cost only a few bytes
+ * - Every keyframeInterval turns a full copy is kept so rewinding far back
+ *   does not need to walk the whole delta chain
+ * - The oldest turns are evicted whenever the memory budget is exceeded
+ *
+ * XOR deltas are symmetric, so the same record walks the history backwards
+ * from the newest state or forwards from a keyframe, whichever is closer.
+ *
+ * Capture is deliberately full (every slot of every track, every turn) rather
+ * than driven by ComponentArray change tracking: markChanged() relies on each
+ * writer reporting in-place edits, and a missed report would silently corrupt
+ * the history. The XOR/RLE pass already reduces unchanged slots to a few
+ * bytes, so the cost is one serialization pass per turn.
+ *
+ * Limitations:
+ * - Only component data and component masks are rewound. Entity lifetimes
+ *   (create/destroy) are not; components of dead entities are restored into
+ *   the arrays without touching EntityManager.
+ * - Tracks must be registered before recording. Registering a new track
+ *   discards the existing history.
+ *
+ * Usage:
+ *   RewindBuffer rewind(1024 * 1024);          // 1 MB budget
+ *   rewind.track(positions, getComponentBit<Position>());
+ *   rewind.recordTurn();                       // end of every turn
+ *   ...
+ *   rewind.rewind(3, entityManager);           // back three turns
+ */
+class RewindBuffer {
+public:
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 4 * 1024 * 1024;
+    static constexpr uint32_t DEFAULT_KEYFRAME_INTERVAL = 16;
+
+    /**
+     * Construct a rewind buffer
+     * @param memoryBudgetBytes Upper bound for history storage (oldest turns evicted first)
+     * @param keyframeInterval Store a full copy every N turns (0 disables keyframes)
+     */
+    explicit RewindBuffer(size_t memoryBudgetBytes = DEFAULT_MEMORY_BUDGET,
+                          uint32_t keyframeInterval = DEFAULT_KEYFRAME_INTERVAL);
+    ~RewindBuffer() = default;
+
+    // Non-copyable but movable
+    RewindBuffer(const RewindBuffer&) = delete;
+    RewindBuffer& operator=(const RewindBuffer&) = delete;
+    RewindBuffer(RewindBuffer&&) = default;
+    RewindBuffer& operator=(RewindBuffer&&) = default;
+
+    /**
+     * Register a component array for recording
+     * The array must outlive the rewind buffer (or the next clear()).
+     * @param array Component array to record
+     * @param componentBit Bit used to keep entity masks in sync on restore
+     */
+    template <typename Component>
+    void track(ComponentArray<Component>& array, uint64_t componentBit);
+
+    /**
+     * Capture the current state of all tracked arrays as a new turn
+     */
+    void recordTurn();
+
+    /**
+     * Restore the state recorded N turns before the newest turn
+     * Turns newer than the restored one are discarded (the timeline branches).
+     * @param turns Number of turns to go back (0 is a no-op)
+     * @param entityManager Entity manager whose component masks are updated
+     * @return false if fewer than N turns are retained (nothing is changed)
+     */
+    bool rewind(uint32_t turns, EntityManager& entityManager);
+
+    /**
+     * Get the number of turns that can currently be rewound
+     */
+    size_t getAvailableRewindDepth() const;
+
+    /**
+     * Get the turn number of the newest recorded turn (0 if nothing recorded)
+     */
+    uint64_t getCurrentTurn() const;
+
+    /**
+     * Get the number of retained turns (including the newest)
+     */
+    size_t getRecordedTurnCount() const;
+
+    /**
+     * Get bytes currently held by the history (deltas, keyframes and working state)
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * Get/set the memory budget. Lowering it evicts old turns immediately.
+     */
+    size_t getMemoryBudget() const;
+    void setMemoryBudget(size_t memoryBudgetBytes);
+
+    /**
+     * Get number of registered tracks
+     */
+    size_t getTrackCount() const;
+
+    /**
+     * Discard all recorded history (tracks stay registered)
+     */
+    void clearHistory();
+
+    /**
+     * Discard history and unregister all tracks
+     */
+    void clear();
+
+    // Delta encoding helpers (exposed for testing)
+
+    /**
+     * XOR two byte blobs (shorter one zero-padded) and append the run-length
+     * encoding to out. Format: repeated [varint zeroRun][varint literalLen][literal bytes].
+     */
+    static void encodeXorDelta(const std::vector<uint8_t>& from, const std::vector<uint8_t>& to,
+                               std::vector<uint8_t>& out);
+
+    /**
+     * Apply an encoded XOR delta in place, resizing state to targetSize
+     * @return Pointer just past the consumed delta bytes
+     */
+    static const uint8_t* applyXorDelta(std::vector<uint8_t>& state, const uint8_t* delta,
+                                        size_t deltaSize, size_t targetSize);
+
+private:
+    /**
+     * ITrack - Type-erased serializer for one ComponentArray
+     */
+    class ITrack {
+    public:
+        virtual ~ITrack() = default;
+        virtual void capture(std::vector<uint8_t>& out) const = 0;
+        virtual void restore(const std::vector<uint8_t>& state, EntityManager& entityManager) = 0;
+    };
+
+    template <typename Component>
+    class Track : public ITrack {
+    public:
+        Track(ComponentArray<Component>& array, uint64_t componentBit)
+            : array(array), componentBit(componentBit) {}
+
+        void capture(std::vector<uint8_t>& out) const override;
+        void restore(const std::vector<uint8_t>& state, EntityManager& entityManager) override;
+
+    private:
+        ComponentArray<Component>& array;
+        uint64_t componentBit;
+    };
+
+    /**
+     * TurnRecord - Everything stored for one turn
+     * delta: per track [u32 prevSize][u32 curSize][u32 encodedSize][encoded XOR]
+     * keyframe: per track [u32 size][raw state] (empty when not a keyframe)
+     */
+    struct TurnRecord {
+        uint64_t turn = 0;
+        std::vector<uint8_t> delta;
+        std::vector<uint8_t> keyframe;
+    };
+
+    void evictToBudget();
+    size_t recordBytes(const TurnRecord& record) const;
+    void loadKeyframe(const TurnRecord& record, std::vector<std::vector<uint8_t>>& states) const;
+    void applyRecordDelta(const TurnRecord& record, std::vector<std::vector<uint8_t>>& states,
+                          bool forward) const;
+
+    std::vector<std::unique_ptr<ITrack>> tracks;
+    std::vector<std::vector<uint8_t>> currentStates;  // Serialized state of the newest turn
+    std::deque<TurnRecord> history;                   // Oldest turn at front
+    std::vector<uint8_t> scratch;                     // Reused capture buffer
+    size_t memoryBudget;
+    size_t historyBytes = 0;
+    uint32_t keyframeInterval;
+    uint64_t nextTurn = 0;
+};
+
+// Template implementations (must be inline for templates)
+
+template <typename Component>
+void RewindBuffer::track(ComponentArray<Component>& array, uint64_t componentBit) {
+    clearHistory();
+    tracks.push_back(std::make_unique<Track<Component>>(array, componentBit));
+    currentStates.emplace_back();
+}
+
+template <typename Component>
+void RewindBuffer::Track<Component>::capture(std::vector<uint8_t>& out) const {
+    // Slots are interleaved (ID, component) so adds append and swap-removes
+    // touch only the affected slots instead of shifting a whole section
+    const auto& ids = array.getEntityIDs();
+    const auto& components = array.getComponents();
+    const uint32_t count = static_cast<uint32_t>(ids.size());
+    constexpr size_t slotSize = sizeof(EntityID) + sizeof(Component);
+
+    out.resize(sizeof(uint32_t) + count * slotSize);
+    uint8_t* cursor = out.data();
+    std::memcpy(cursor, &count, sizeof(uint32_t));
+    cursor += sizeof(uint32_t);
+    for (uint32_t i = 0; i < count; ++i) {
+        std::memcpy(cursor, &ids[i], sizeof(EntityID));
+        std::memcpy(cursor + sizeof(EntityID), &components[i], sizeof(Component));
+        cursor += slotSize;
+    }
+}
+
+template <typename Component>
+void RewindBuffer::Track<Component>::restore(const std::vector<uint8_t>& state,
+                                             EntityManager& entityManager) {
+    // Drop current component bits before rebuilding the array
+    for (EntityID id : array.getEntityIDs()) {
+        Entity* stored = entityManager.getEntityByID(id);
+        if (stored) {
+            stored->componentMask &= ~componentBit;
+        }
+    }
+    array.clear();
+
+    if (state.size() < sizeof(uint32_t)) {
+        return;
+    }
+
+    uint32_t count = 0;
+    std::memcpy(&count, state.data(), sizeof(uint32_t));
+    constexpr size_t slotSize = sizeof(EntityID) + sizeof(Component);
+    assert(state.size() == sizeof(uint32_t) + count * slotSize);
+
+    array.reserve(count);
+    const uint8_t* cursor = state.data() + sizeof(uint32_t);
+    for (uint32_t i = 0; i < count; ++i) {
+        EntityID id = INVALID_ENTITY;
+        Component component;
+        std::memcpy(&id, cursor, sizeof(EntityID));
+        std::memcpy(static_cast<void*>(&component), cursor + sizeof(EntityID), sizeof(Component));
+        array.add(id, component, componentBit, entityManager);
+        cursor += slotSize;
+    }
+}
+
+} // namespace ECS
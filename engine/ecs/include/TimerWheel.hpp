@@ -0,0 +1,207 @@
+#pragma once
+
+#include "Event.hpp"
+#include "EventBus.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace ECS {
+
+// Handle returned by TimerWheel::schedule* (generation-checked, 0 is never issued)
+using TimerID = uint64_t;
+constexpr TimerID INVALID_TIMER = 0;
+
+/**
+ * TimerWheel - Hierarchical timer wheel for delayed events
+ *
+ * Schedules Event<T> to be pushed into an EventQueue<T> (or EventBus) a
+ * number of ticks in the future. A tick is whatever the caller advances by:
+ * one simulation step for "in N seconds" (ticks = seconds / step), one turn
+ * for "in N turns" (use a separate wheel per clock).
+ *
+ * Layout: 4 levels x 64 slots. Level L slot covers 64^L ticks, so delays up
+ * to 64^4 (~16.7M) ticks are placed directly; longer delays park in the top
+ * level and are re-placed when cascaded.
+ *
+ * Complexity:
+ * - schedule: O(1) - append to one slot's intrusive list
+ * - cancel: O(1) - unlink by handle (stale handles are rejected)
+ * - advance: per tick, one slot is expired as a batch; every 64^L ticks a
+ *   level-L slot is cascaded down (each timer cascades at most 3 times)
+ *
+ * Timers live in a pooled node vector with a free list, so steady-state
+ * scheduling does not allocate. Events are copied into the node inline
+ * (payload types must be trivially copyable and fit MAX_EVENT_BYTES).
+ * Timers in the same slot fire in scheduling order.
+ *
+ * Usage:
+ *   TimerWheel timers;
+ *   TimerID id = timers.scheduleEvent(hazardQueue, trap, HazardPayload{3}, 5);
+ *   timers.cancel(id);          // trap disarmed
+ *   timers.advance(1);          // once per turn: due events are pushed
+ */
+class TimerWheel {
+public:
+    static constexpr size_t LEVELS = 4;
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOTS = 1 << SLOT_BITS;
+    static constexpr uint64_t MAX_DELAY = (1ULL << (SLOT_BITS * LEVELS)) - 1;
+    static constexpr size_t MAX_EVENT_BYTES = 48;
+
+    TimerWheel();
+    ~TimerWheel() = default;
+
+    // Non-copyable but movable
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) = default;
+    TimerWheel& operator=(TimerWheel&&) = default;
+
+    /**
+     * Push an event into a queue after a delay
+     * @param delayTicks Ticks from now (0 is treated as 1: fires on the next advance)
+     * @return Handle for cancel()
+     */
+    template <typename T>
+    TimerID scheduleEvent(EventQueue<T>& queue, const Event<T>& event, uint64_t delayTicks);
+
+    template <typename T>
+    TimerID scheduleEvent(EventQueue<T>& queue, EntityID source, const T& payload, uint64_t delayTicks);
+
+    /**
+     * Push an event into a bus's queue for T after a delay
+     */
+    template <typename T>
+    TimerID scheduleEvent(EventBus& bus, EntityID source, const T& payload, uint64_t delayTicks);
+
+    /**
+     * Cancel a pending timer
+     * @return true if the timer was pending
+     */
+    bool cancel(TimerID id);
+
+    /**
+     * Check if a timer is still pending
+     */
+    bool isPending(TimerID id) const;
+
+    /**
+     * Get ticks until a pending timer fires (0 if not pending)
+     */
+    uint64_t getRemainingTicks(TimerID id) const;
+
+    /**
+     * Advance time, expiring due timers slot by slot
+     * @return Number of events fired
+     */
+    size_t advance(uint64_t ticks = 1);
+
+    /**
+     * Get current tick count
+     */
+    uint64_t getCurrentTick() const;
+
+    /**
+     * Get number of pending timers
+     */
+    size_t getPendingCount() const;
+
+    /**
+     * Pre-allocate timer nodes
+     */
+    void reserve(size_t timerCount);
+
+    /**
+     * Cancel all timers (tick count kept)
+     */
+    void clear();
+
+private:
+    static constexpr uint32_t NIL = UINT32_MAX;
+    static constexpr uint8_t FREE_LEVEL = 0xFF;
+
+    using FireFn = void (*)(void* target, const unsigned char* payload);
+
+    struct TimerNode {
+        alignas(alignof(std::max_align_t)) unsigned char payload[MAX_EVENT_BYTES];
+        uint64_t expiry = 0;
+        void* target = nullptr;
+        FireFn fire = nullptr;
+        uint32_t prev = NIL;
+        uint32_t next = NIL;         // Slot list link, or free list link when free
+        uint32_t generation = 0;
+        uint8_t level = FREE_LEVEL;
+        uint8_t slot = 0;
+    };
+
+    template <typename T>
+    static void pushToQueue(void* target, const unsigned char* payload) {
+        Event<T> event;
+        std::memcpy(&event, payload, sizeof(Event<T>));
+        static_cast<EventQueue<T>*>(target)->push(event);
+    }
+
+    template <typename T>
+    static void pushToBus(void* target, const unsigned char* payload) {
+        Event<T> event;
+        std::memcpy(&event, payload, sizeof(Event<T>));
+        static_cast<EventBus*>(target)->getQueue<T>().push(event);
+    }
+
+    template <typename T>
+    TimerID scheduleRaw(void* target, FireFn fire, const Event<T>& event, uint64_t delayTicks);
+
+    uint32_t allocateNode();
+    void placeNode(uint32_t index);
+    void unlinkNode(uint32_t index);
+    void freeNode(uint32_t index);
+    void cascade(size_t level, size_t slot);
+    size_t expireSlot(size_t slot);
+    const TimerNode* findNode(TimerID id) const;
+
+    std::vector<TimerNode> nodes;
+    uint32_t slotHead[LEVELS][SLOTS];
+    uint32_t slotTail[LEVELS][SLOTS];
+    uint32_t freeHead = NIL;
+    uint64_t currentTick = 0;
+    size_t pendingCount = 0;
+};
+
+// Template implementations (must be inline for templates)
+
+template <typename T>
+TimerID TimerWheel::scheduleRaw(void* target, FireFn fire, const Event<T>& event, uint64_t delayTicks) {
+    static_assert(std::is_trivially_copyable_v<Event<T>>, "Timed event payloads must be trivially copyable");
+    static_assert(sizeof(Event<T>) <= MAX_EVENT_BYTES, "Timed event exceeds TimerWheel::MAX_EVENT_BYTES");
+    static_assert(alignof(Event<T>) <= alignof(std::max_align_t), "Timed event is over-aligned");
+
+    uint32_t index = allocateNode();
+    TimerNode& node = nodes[index];
+    std::memcpy(node.payload, &event, sizeof(Event<T>));
+    node.expiry = currentTick + (delayTicks == 0 ? 1 : delayTicks);
+    node.target = target;
+    node.fire = fire;
+    placeNode(index);
+    pendingCount++;
+    return (static_cast<TimerID>(node.generation) << 32) | (index + 1);
+}
+
+template <typename T>
+TimerID TimerWheel::scheduleEvent(EventQueue<T>& queue, const Event<T>& event, uint64_t delayTicks) {
+    return scheduleRaw(&queue, &TimerWheel::pushToQueue<T>, event, delayTicks);
+}
+
+template <typename T>
+TimerID TimerWheel::scheduleEvent(EventQueue<T>& queue, EntityID source, const T& payload, uint64_t delayTicks) {
+    return scheduleRaw(&queue, &TimerWheel::pushToQueue<T>, Event<T>(source, payload), delayTicks);
+}
+
+template <typename T>
+TimerID TimerWheel::scheduleEvent(EventBus& bus, EntityID source, const T& payload, uint64_t delayTicks) {
+    return scheduleRaw(&bus, &TimerWheel::pushToBus<T>, Event<T>(source, payload), delayTicks);
+}
+
+} // namespace ECS
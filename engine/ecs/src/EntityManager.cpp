@@ -114,6 +114,16 @@ size_t EntityManager::getActiveEntityCount() const {
     return count;
 }
 
+size_t EntityManager::countEntitiesWith(uint64_t requiredMask) const {
+    size_t count = 0;
+    for (size_t i = 1; i < entities.size(); ++i) {
+        if (alive[i] && (entities[i].componentMask & requiredMask) == requiredMask) {
+            count++;
+        }
+    }
+    return count;
+}
+
 size_t EntityManager::getTotalEntityCount() const {
     // Return total entities ever created (excluding index 0 which is reserved)
     return entities.size() > 0 ? entities.size() - 1 : 0;
@@ -123,6 +133,17 @@ size_t EntityManager::getDeadEntityCount() const {
     return freeIds.size();
 }
 
+size_t EntityManager::getSlotCapacity() const {
+    return entities.capacity();
+}
+
+size_t EntityManager::getAllocatedBytes() const {
+    return entities.capacity() * sizeof(Entity)
+         + generations.capacity() * sizeof(uint32_t)
+         + (alive.capacity() + 7) / 8
+         + freeIds.size() * sizeof(EntityID);
+}
+
 bool EntityManager::isAlive(EntityID entityId) const {
     if (entityId == INVALID_ENTITY || entityId >= alive.size()) {
         return false;
@@ -162,6 +183,14 @@ std::vector<const Entity*> EntityManager::getAllEntitiesForIteration() const {
     return result;
 }
 
+Resources& EntityManager::getResources() {
+    return resources;
+}
+
+const Resources& EntityManager::getResources() const {
+    return resources;
+}
+
 void EntityManager::clear() {
     entities.clear();
     generations.clear();
@@ -0,0 +1,126 @@
+#include "../include/EventBus.hpp"
+#include <algorithm>
+
+namespace ECS {
+
+namespace EventTypeRegistry {
+    // Initialize the global atomic counter
+    std::atomic<uint32_t> nextEventTypeId{0};
+}
+
+EventBus::~EventBus() {
+    clear();
+}
+
+EventBus::EventBus(EventBus&& other) noexcept
+    : channels(std::move(other.channels))
+    , nextSubscriptionId(other.nextSubscriptionId) {
+    other.channels.clear();
+}
+
+EventBus& EventBus::operator=(EventBus&& other) noexcept {
+    if (this != &other) {
+        clear();
+        channels = std::move(other.channels);
+        nextSubscriptionId = other.nextSubscriptionId;
+        other.channels.clear();
+    }
+    return *this;
+}
+
+SubscriptionID EventBus::addSubscriber(Channel& channel, void* context, void (*handler)(), Thunk thunk) {
+    SubscriptionID id = nextSubscriptionId++;
+    channel.subscribers.push_back({id, context, handler, thunk});
+    return id;
+}
+
+bool EventBus::unsubscribe(SubscriptionID id) {
+    if (id == INVALID_SUBSCRIPTION) {
+        return false;
+    }
+    for (auto& channel : channels) {
+        for (auto it = channel.subscribers.begin(); it != channel.subscribers.end(); ++it) {
+            if (it->id != id || !it->thunk) {
+                continue;
+            }
+            if (dispatching) {
+                // Defer erase so the dispatch loop's iteration stays valid
+                it->thunk = nullptr;
+                pendingRemovals = true;
+            } else {
+                channel.subscribers.erase(it);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t EventBus::dispatch() {
+    size_t delivered = 0;
+    dispatching = true;
+
+    // Publish every type first so events pushed by handlers (into back
+    // buffers) wait for the next dispatch regardless of type order
+    for (auto& channel : channels) {
+        channel.frontCount = channel.queue ? channel.swap(channel.queue, &channel.front) : 0;
+    }
+
+    // Index loops: handlers may push new event types or subscribe while we
+    // iterate, which can grow channels and subscriber lists
+    for (size_t c = 0; c < channels.size(); ++c) {
+        const size_t count = channels[c].frontCount;
+        if (count == 0) {
+            continue;
+        }
+        const void* front = channels[c].front;
+        for (size_t i = 0; i < channels[c].subscribers.size(); ++i) {
+            const Subscriber subscriber = channels[c].subscribers[i];
+            if (subscriber.thunk) {
+                subscriber.thunk(subscriber.context, subscriber.handler, front, count);
+            }
+        }
+        delivered += count;
+    }
+
+    dispatching = false;
+    if (pendingRemovals) {
+        for (auto& channel : channels) {
+            auto& subscribers = channel.subscribers;
+            subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+                                             [](const Subscriber& s) { return s.thunk == nullptr; }),
+                              subscribers.end());
+        }
+        pendingRemovals = false;
+    }
+    return delivered;
+}
+
+size_t EventBus::getQueueCount() const {
+    size_t count = 0;
+    for (const auto& channel : channels) {
+        if (channel.queue) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void EventBus::clearEvents() {
+    for (auto& channel : channels) {
+        if (channel.queue) {
+            channel.clearQueue(channel.queue);
+        }
+    }
+}
+
+void EventBus::clear() {
+    for (auto& channel : channels) {
+        if (channel.queue) {
+            channel.destroy(channel.queue);
+        }
+    }
+    channels.clear();
+}
+
+} // namespace ECS
@@ -0,0 +1,333 @@
+#include "../include/EventJournal.hpp"
+#include "../systems/include/IInputManager.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace ECS {
+
+namespace {
+
+// Size of an EVENTS record header after the kind byte: tag, eventSize, count
+constexpr size_t EVENTS_HEADER_BYTES = sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint32_t);
+
+template <typename T>
+T readValue(const uint8_t* bytes) {
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    return value;
+}
+
+/**
+ * Get total size of the record starting at offset (0 if truncated or unknown)
+ */
+size_t recordSize(const std::vector<uint8_t>& data, size_t offset) {
+    if (offset >= data.size()) {
+        return 0;
+    }
+    size_t remaining = data.size() - offset - 1;
+    switch (data[offset]) {
+        case EventJournal::RECORD_FRAME:
+            return remaining >= sizeof(uint64_t) ? 1 + sizeof(uint64_t) : 0;
+        case EventJournal::RECORD_INPUT:
+            return remaining >= sizeof(InputFrame) ? 1 + sizeof(InputFrame) : 0;
+        case EventJournal::RECORD_EVENTS: {
+            if (remaining < EVENTS_HEADER_BYTES) {
+                return 0;
+            }
+            const uint8_t* header = data.data() + offset + 1;
+            size_t payload = static_cast<size_t>(readValue<uint16_t>(header + 2)) * readValue<uint32_t>(header + 4);
+            return remaining >= EVENTS_HEADER_BYTES + payload ? 1 + EVENTS_HEADER_BYTES + payload : 0;
+        }
+        default:
+            return 0;
+    }
+}
+
+} // namespace
+
+InputFrame InputFrame::capture(const IInputManager& inputManager) {
+    InputFrame frame;
+    for (int key = 0; key < KEY_COUNT; ++key) {
+        if (inputManager.isKeyPressed(key)) {
+            setBit(frame.keysDown, key);
+        }
+        if (inputManager.wasKeyPressed(key)) {
+            setBit(frame.keysPressed, key);
+        }
+        if (inputManager.wasKeyReleased(key)) {
+            setBit(frame.keysReleased, key);
+        }
+    }
+
+    int x = 0;
+    int y = 0;
+    inputManager.getMousePosition(x, y);
+    frame.mouseX = x;
+    frame.mouseY = y;
+
+    for (int button = 0; button < MOUSE_BUTTON_COUNT; ++button) {
+        if (inputManager.isMouseButtonPressed(button)) {
+            frame.mouseDown |= static_cast<uint8_t>(1u << button);
+        }
+        if (inputManager.wasMouseButtonPressed(button)) {
+            frame.mousePressed |= static_cast<uint8_t>(1u << button);
+        }
+    }
+    return frame;
+}
+
+EventJournal::EventJournal(uint32_t indexInterval)
+    : indexInterval(indexInterval > 0 ? indexInterval : 1) {
+}
+
+void EventJournal::writeBytes(const void* bytes, size_t size) {
+    const uint8_t* begin = static_cast<const uint8_t*>(bytes);
+    data.insert(data.end(), begin, begin + size);
+}
+
+void EventJournal::beginFrame(uint64_t frame) {
+    if (frameCount % indexInterval == 0) {
+        index.push_back({frame, data.size()});
+    }
+    data.push_back(RECORD_FRAME);
+    writeBytes(&frame, sizeof(frame));
+    frameCount++;
+}
+
+void EventJournal::recordInput(const InputFrame& input) {
+    data.push_back(RECORD_INPUT);
+    writeBytes(&input, sizeof(input));
+}
+
+void EventJournal::writeEvents(uint16_t tag, uint16_t eventSize, const void* events, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    uint32_t count32 = static_cast<uint32_t>(count);
+    data.push_back(RECORD_EVENTS);
+    writeBytes(&tag, sizeof(tag));
+    writeBytes(&eventSize, sizeof(eventSize));
+    writeBytes(&count32, sizeof(count32));
+    writeBytes(events, static_cast<size_t>(eventSize) * count);
+}
+
+void EventJournal::recordEvents() {
+    for (const auto& source : sources) {
+        const void* events = nullptr;
+        size_t count = source.snapshot(source.queue, &events);
+        writeEvents(source.tag, source.eventSize, events, count);
+    }
+}
+
+void EventJournal::recordFrame(uint64_t frame, const IInputManager* input) {
+    beginFrame(frame);
+    if (input) {
+        recordInput(InputFrame::capture(*input));
+    }
+    recordEvents();
+}
+
+const std::vector<uint8_t>& EventJournal::getData() const {
+    return data;
+}
+
+const std::vector<EventJournal::IndexEntry>& EventJournal::getIndex() const {
+    return index;
+}
+
+size_t EventJournal::getFrameCount() const {
+    return frameCount;
+}
+
+size_t EventJournal::getSizeBytes() const {
+    return data.size();
+}
+
+bool EventJournal::save(std::ostream& out) const {
+    uint32_t header[2] = {FILE_MAGIC, FILE_VERSION};
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+    uint64_t indexOffset = data.size();
+    out.write(reinterpret_cast<const char*>(index.data()),
+              static_cast<std::streamsize>(index.size() * sizeof(IndexEntry)));
+
+    uint64_t frames = frameCount;
+    uint32_t footer[2] = {static_cast<uint32_t>(index.size()), FOOTER_MAGIC};
+    out.write(reinterpret_cast<const char*>(&indexOffset), sizeof(indexOffset));
+    out.write(reinterpret_cast<const char*>(&frames), sizeof(frames));
+    out.write(reinterpret_cast<const char*>(footer), sizeof(footer));
+    return static_cast<bool>(out);
+}
+
+bool EventJournal::load(std::istream& in) {
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    const size_t headerBytes = 2 * sizeof(uint32_t);
+    const size_t footerBytes = 2 * sizeof(uint64_t) + 2 * sizeof(uint32_t);
+    if (bytes.size() < headerBytes || readValue<uint32_t>(bytes.data()) != FILE_MAGIC ||
+        readValue<uint32_t>(bytes.data() + 4) != FILE_VERSION) {
+        return false;
+    }
+
+    clear();
+    const uint8_t* body = bytes.data() + headerBytes;
+    const size_t bodySize = bytes.size() - headerBytes;
+
+    if (bodySize >= footerBytes &&
+        readValue<uint32_t>(body + bodySize - sizeof(uint32_t)) == FOOTER_MAGIC) {
+        const uint8_t* footer = body + bodySize - footerBytes;
+        uint64_t indexOffset = readValue<uint64_t>(footer);
+        uint64_t frames = readValue<uint64_t>(footer + 8);
+        uint32_t indexCount = readValue<uint32_t>(footer + 16);
+        size_t indexBytes = static_cast<size_t>(indexCount) * sizeof(IndexEntry);
+        if (indexOffset + indexBytes + footerBytes == bodySize) {
+            data.assign(body, body + indexOffset);
+            index.resize(indexCount);
+            std::memcpy(index.data(), body + indexOffset, indexBytes);
+            frameCount = static_cast<size_t>(frames);
+            return true;
+        }
+    }
+
+    // No usable footer (e.g. truncated after a crash): keep records, rebuild index
+    data.assign(body, body + bodySize);
+    rebuildIndex();
+    return true;
+}
+
+void EventJournal::rebuildIndex() {
+    index.clear();
+    frameCount = 0;
+    size_t offset = 0;
+    while (size_t size = recordSize(data, offset)) {
+        if (data[offset] == RECORD_FRAME) {
+            if (frameCount % indexInterval == 0) {
+                index.push_back({readValue<uint64_t>(data.data() + offset + 1), offset});
+            }
+            frameCount++;
+        }
+        offset += size;
+    }
+    data.resize(offset); // Drop a truncated trailing record
+}
+
+void EventJournal::clear() {
+    data.clear();
+    index.clear();
+    frameCount = 0;
+}
+
+JournalReplayer::JournalReplayer(const EventJournal& journal)
+    : journal(journal) {
+}
+
+void JournalReplayer::addSink(const Sink& sink) {
+    for (auto& existing : sinks) {
+        if (existing.tag == sink.tag) {
+            existing = sink;
+            return;
+        }
+    }
+    sinks.push_back(sink);
+}
+
+const JournalReplayer::Sink* JournalReplayer::findSink(uint16_t tag) const {
+    for (const auto& sink : sinks) {
+        if (sink.tag == tag) {
+            return &sink;
+        }
+    }
+    return nullptr;
+}
+
+bool JournalReplayer::seek(uint64_t frame) {
+    const auto& data = journal.getData();
+    const auto& index = journal.getIndex();
+
+    // Last index entry at or before the target frame
+    auto it = std::upper_bound(index.begin(), index.end(), frame,
+                               [](uint64_t value, const EventJournal::IndexEntry& entry) {
+                                   return value < entry.frame;
+                               });
+    size_t offset = it == index.begin() ? 0 : static_cast<size_t>((it - 1)->offset);
+
+    while (size_t size = recordSize(data, offset)) {
+        if (data[offset] == EventJournal::RECORD_FRAME &&
+            readValue<uint64_t>(data.data() + offset + 1) >= frame) {
+            cursor = offset;
+            return true;
+        }
+        offset += size;
+    }
+    cursor = data.size();
+    return false;
+}
+
+bool JournalReplayer::replayFrame() {
+    const auto& data = journal.getData();
+
+    // Skip to the next frame marker
+    while (cursor < data.size() && data[cursor] != EventJournal::RECORD_FRAME) {
+        size_t size = recordSize(data, cursor);
+        if (size == 0) {
+            cursor = data.size();
+            return false;
+        }
+        cursor += size;
+    }
+    size_t frameSize = recordSize(data, cursor);
+    if (frameSize == 0) {
+        cursor = data.size();
+        return false;
+    }
+
+    currentFrame = readValue<uint64_t>(data.data() + cursor + 1);
+    inputValid = false;
+    input = InputFrame();
+    cursor += frameSize;
+
+    while (size_t size = recordSize(data, cursor)) {
+        const uint8_t* record = data.data() + cursor;
+        if (record[0] == EventJournal::RECORD_FRAME) {
+            break;
+        }
+        if (record[0] == EventJournal::RECORD_INPUT) {
+            std::memcpy(&input, record + 1, sizeof(InputFrame));
+            inputValid = true;
+        } else {
+            uint16_t tag = readValue<uint16_t>(record + 1);
+            uint16_t eventSize = readValue<uint16_t>(record + 3);
+            uint32_t count = readValue<uint32_t>(record + 5);
+            const Sink* sink = findSink(tag);
+            if (sink && sink->eventSize == eventSize) {
+                sink->push(sink->target, record + 1 + EVENTS_HEADER_BYTES, count);
+            } else {
+                skippedRecords++;
+            }
+        }
+        cursor += size;
+    }
+    return true;
+}
+
+uint64_t JournalReplayer::getCurrentFrame() const {
+    return currentFrame;
+}
+
+const InputFrame& JournalReplayer::getInput() const {
+    return input;
+}
+
+bool JournalReplayer::hasInput() const {
+    return inputValid;
+}
+
+bool JournalReplayer::atEnd() const {
+    return recordSize(journal.getData(), cursor) == 0;
+}
+
+size_t JournalReplayer::getSkippedRecordCount() const {
+    return skippedRecords;
+}
+
+} // namespace ECS
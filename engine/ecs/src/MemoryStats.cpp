@@ -0,0 +1,111 @@
+#include "../include/MemoryStats.hpp"
+#include <cstdio>
+
+namespace ECS {
+
+namespace MemoryStats {
+
+void finalize(StorageStats& stats) {
+    stats.bytesWasted = stats.bytesAllocated > stats.bytesUsed ? stats.bytesAllocated - stats.bytesUsed : 0;
+    stats.fragmentation = stats.bytesAllocated > 0
+        ? static_cast<float>(stats.bytesWasted) / static_cast<float>(stats.bytesAllocated)
+        : 0.0f;
+}
+
+StorageStats collect(const EntityManager& entityManager, const std::string& name) {
+    StorageStats stats;
+    stats.name = name;
+    stats.liveCount = entityManager.getActiveEntityCount();
+    stats.capacity = entityManager.getSlotCapacity();
+
+    // Each living entity costs its Entity slot, a generation counter and an alive bit
+    const size_t slotBytes = sizeof(Entity) + sizeof(uint32_t);
+    stats.bytesUsed = stats.liveCount * slotBytes + (stats.liveCount + 7) / 8;
+    stats.bytesAllocated = entityManager.getAllocatedBytes();
+    finalize(stats);
+    return stats;
+}
+
+} // namespace MemoryStats
+
+void MemoryReport::trackEntityManager(const EntityManager& entityManager, const std::string& name) {
+    sources.push_back({name, &entityManager, &MemoryReport::collectEntityManager});
+}
+
+const std::vector<StorageStats>& MemoryReport::collect() {
+    stats.resize(sources.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+        stats[i] = sources[i].collectFn(sources[i].container, sources[i].name);
+    }
+    return stats;
+}
+
+const std::vector<StorageStats>& MemoryReport::getStats() const {
+    return stats;
+}
+
+size_t MemoryReport::getTotalBytesAllocated() const {
+    size_t total = 0;
+    for (const auto& entry : stats) {
+        total += entry.bytesAllocated;
+    }
+    return total;
+}
+
+size_t MemoryReport::getTotalBytesWasted() const {
+    size_t total = 0;
+    for (const auto& entry : stats) {
+        total += entry.bytesWasted;
+    }
+    return total;
+}
+
+std::string MemoryReport::formatTable() const {
+    std::string table;
+    char line[256];
+
+    std::snprintf(line, sizeof(line), "%-20s %10s %10s %12s %12s %12s %8s %8s\n",
+                  "Storage", "Live", "Capacity", "Used(B)", "Alloc(B)", "Wasted(B)", "Load", "Frag");
+    table += line;
+
+    for (const auto& entry : stats) {
+        std::snprintf(line, sizeof(line), "%-20s %10zu %10zu %12zu %12zu %12zu %8.2f %7.1f%%\n",
+                      entry.name.c_str(), entry.liveCount, entry.capacity, entry.bytesUsed,
+                      entry.bytesAllocated, entry.bytesWasted, entry.hashLoadFactor,
+                      entry.fragmentation * 100.0f);
+        table += line;
+    }
+
+    std::snprintf(line, sizeof(line), "%-20s %10s %10s %12s %12zu %12zu\n",
+                  "Total", "", "", "", getTotalBytesAllocated(), getTotalBytesWasted());
+    table += line;
+    return table;
+}
+
+void MemoryReport::writeCsv(std::ostream& out, uint64_t frame, bool forceHeader) {
+    if (!csvHeaderWritten || forceHeader) {
+        out << "frame,storage,live,capacity,bytes_used,bytes_allocated,bytes_wasted,hash_buckets,hash_load,fragmentation\n";
+        csvHeaderWritten = true;
+    }
+    for (const auto& entry : stats) {
+        out << frame << ',' << entry.name << ',' << entry.liveCount << ',' << entry.capacity << ','
+            << entry.bytesUsed << ',' << entry.bytesAllocated << ',' << entry.bytesWasted << ','
+            << entry.hashBuckets << ',' << entry.hashLoadFactor << ',' << entry.fragmentation << '\n';
+    }
+}
+
+size_t MemoryReport::getTrackedCount() const {
+    return sources.size();
+}
+
+void MemoryReport::clear() {
+    sources.clear();
+    stats.clear();
+    csvHeaderWritten = false;
+}
+
+StorageStats MemoryReport::collectEntityManager(const void* container, const std::string& name) {
+    return MemoryStats::collect(*static_cast<const EntityManager*>(container), name);
+}
+
+} // namespace ECS
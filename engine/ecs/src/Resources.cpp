@@ -0,0 +1,56 @@
+#include "../include/Resources.hpp"
+
+namespace ECS {
+
+namespace ResourceRegistry {
+    // Initialize the global atomic counter
+    std::atomic<uint32_t> nextResourceId{0};
+}
+
+Resources::~Resources() {
+    clear();
+}
+
+Resources::Resources(Resources&& other) noexcept
+    : slots(std::move(other.slots))
+    , count(other.count) {
+    other.slots.clear();
+    other.count = 0;
+}
+
+Resources& Resources::operator=(Resources&& other) noexcept {
+    if (this != &other) {
+        clear();
+        slots = std::move(other.slots);
+        count = other.count;
+        other.slots.clear();
+        other.count = 0;
+    }
+    return *this;
+}
+
+size_t Resources::size() const {
+    return count;
+}
+
+bool Resources::empty() const {
+    return count == 0;
+}
+
+void Resources::clear() {
+    for (Slot& slot : slots) {
+        releaseSlot(slot);
+    }
+    slots.clear();
+}
+
+void Resources::releaseSlot(Slot& slot) {
+    if (slot.instance) {
+        slot.destroy(slot.instance);
+        slot.instance = nullptr;
+        slot.destroy = nullptr;
+        count--;
+    }
+}
+
+} // namespace ECS
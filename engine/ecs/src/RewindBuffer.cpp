@@ -0,0 +1,304 @@
+#include "../include/RewindBuffer.hpp"
+#include <algorithm>
+
+namespace ECS {
+
+namespace {
+
+// Zero gaps shorter than this are folded into the surrounding literal run,
+// since breaking a run costs at least two varint bytes
+constexpr size_t MIN_ZERO_RUN = 4;
+
+void writeVarint(std::vector<uint8_t>& out, size_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+size_t readVarint(const uint8_t*& cursor, const uint8_t* end) {
+    size_t value = 0;
+    int shift = 0;
+    while (cursor < end) {
+        uint8_t byte = *cursor++;
+        value |= static_cast<size_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            break;
+        }
+        shift += 7;
+    }
+    return value;
+}
+
+void writeU32(std::vector<uint8_t>& out, uint32_t value) {
+    size_t offset = out.size();
+    out.resize(offset + sizeof(uint32_t));
+    std::memcpy(out.data() + offset, &value, sizeof(uint32_t));
+}
+
+uint32_t readU32(const uint8_t*& cursor) {
+    uint32_t value = 0;
+    std::memcpy(&value, cursor, sizeof(uint32_t));
+    cursor += sizeof(uint32_t);
+    return value;
+}
+
+inline uint8_t byteAt(const std::vector<uint8_t>& blob, size_t index) {
+    return index < blob.size() ? blob[index] : 0;
+}
+
+} // namespace
+
+RewindBuffer::RewindBuffer(size_t memoryBudgetBytes, uint32_t keyframeInterval)
+    : memoryBudget(memoryBudgetBytes)
+    , keyframeInterval(keyframeInterval) {
+}
+
+void RewindBuffer::recordTurn() {
+    TurnRecord record;
+    record.turn = nextTurn;
+
+    const bool firstTurn = history.empty();
+    const bool isKeyframe = firstTurn || (keyframeInterval != 0 && nextTurn % keyframeInterval == 0);
+
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        tracks[i]->capture(scratch);
+
+        if (!firstTurn) {
+            writeU32(record.delta, static_cast<uint32_t>(currentStates[i].size()));
+            writeU32(record.delta, static_cast<uint32_t>(scratch.size()));
+            size_t sizeOffset = record.delta.size();
+            writeU32(record.delta, 0);
+            encodeXorDelta(currentStates[i], scratch, record.delta);
+            uint32_t encodedSize = static_cast<uint32_t>(record.delta.size() - sizeOffset - sizeof(uint32_t));
+            std::memcpy(record.delta.data() + sizeOffset, &encodedSize, sizeof(uint32_t));
+        }
+
+        if (isKeyframe) {
+            writeU32(record.keyframe, static_cast<uint32_t>(scratch.size()));
+            record.keyframe.insert(record.keyframe.end(), scratch.begin(), scratch.end());
+        }
+
+        // Keep the fresh capture as the newest state; the old buffer becomes scratch
+        currentStates[i].swap(scratch);
+    }
+
+    record.delta.shrink_to_fit();
+    historyBytes += recordBytes(record);
+    history.push_back(std::move(record));
+    nextTurn++;
+
+    evictToBudget();
+}
+
+bool RewindBuffer::rewind(uint32_t turns, EntityManager& entityManager) {
+    if (turns == 0) {
+        return true;
+    }
+    if (turns > getAvailableRewindDepth()) {
+        return false;
+    }
+
+    const size_t newestIndex = history.size() - 1;
+    const size_t targetIndex = newestIndex - turns;
+
+    // Pick the cheapest starting point: the newest state or the closest keyframe
+    size_t startIndex = newestIndex;
+    size_t bestDistance = turns;
+    for (size_t i = 0; i < history.size(); ++i) {
+        if (history[i].keyframe.empty()) {
+            continue;
+        }
+        size_t distance = i > targetIndex ? i - targetIndex : targetIndex - i;
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            startIndex = i;
+        }
+    }
+
+    std::vector<std::vector<uint8_t>> states;
+    if (startIndex == newestIndex) {
+        states = currentStates;
+    } else {
+        loadKeyframe(history[startIndex], states);
+    }
+
+    if (startIndex > targetIndex) {
+        for (size_t i = startIndex; i > targetIndex; --i) {
+            applyRecordDelta(history[i], states, false);
+        }
+    } else {
+        for (size_t i = startIndex + 1; i <= targetIndex; ++i) {
+            applyRecordDelta(history[i], states, true);
+        }
+    }
+
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        tracks[i]->restore(states[i], entityManager);
+    }
+    currentStates = std::move(states);
+
+    // Branch the timeline: turns after the target no longer exist
+    while (history.size() > targetIndex + 1) {
+        historyBytes -= recordBytes(history.back());
+        history.pop_back();
+    }
+    nextTurn = history.back().turn + 1;
+
+    return true;
+}
+
+size_t RewindBuffer::getAvailableRewindDepth() const {
+    return history.empty() ? 0 : history.size() - 1;
+}
+
+uint64_t RewindBuffer::getCurrentTurn() const {
+    return history.empty() ? 0 : history.back().turn;
+}
+
+size_t RewindBuffer::getRecordedTurnCount() const {
+    return history.size();
+}
+
+size_t RewindBuffer::getMemoryUsage() const {
+    size_t total = historyBytes + scratch.capacity();
+    for (const auto& state : currentStates) {
+        total += state.capacity();
+    }
+    return total;
+}
+
+size_t RewindBuffer::getMemoryBudget() const {
+    return memoryBudget;
+}
+
+void RewindBuffer::setMemoryBudget(size_t memoryBudgetBytes) {
+    memoryBudget = memoryBudgetBytes;
+    evictToBudget();
+}
+
+size_t RewindBuffer::getTrackCount() const {
+    return tracks.size();
+}
+
+void RewindBuffer::clearHistory() {
+    history.clear();
+    historyBytes = 0;
+    nextTurn = 0;
+    for (auto& state : currentStates) {
+        state.clear();
+    }
+}
+
+void RewindBuffer::clear() {
+    clearHistory();
+    tracks.clear();
+    currentStates.clear();
+}
+
+void RewindBuffer::encodeXorDelta(const std::vector<uint8_t>& from, const std::vector<uint8_t>& to,
+                                  std::vector<uint8_t>& out) {
+    const size_t length = std::max(from.size(), to.size());
+    size_t i = 0;
+
+    while (i < length) {
+        // Unchanged bytes
+        size_t zeroStart = i;
+        while (i < length && byteAt(from, i) == byteAt(to, i)) {
+            ++i;
+        }
+        if (i == length) {
+            break; // Trailing zeros are implicit
+        }
+        size_t zeroRun = i - zeroStart;
+
+        // Changed bytes, absorbing short unchanged gaps
+        size_t literalStart = i;
+        size_t literalEnd = i;
+        while (i < length) {
+            if (byteAt(from, i) != byteAt(to, i)) {
+                literalEnd = ++i;
+                continue;
+            }
+            size_t gapEnd = i;
+            while (gapEnd < length && gapEnd - i < MIN_ZERO_RUN && byteAt(from, gapEnd) == byteAt(to, gapEnd)) {
+                ++gapEnd;
+            }
+            if (gapEnd - i >= MIN_ZERO_RUN || gapEnd == length) {
+                break;
+            }
+            i = gapEnd;
+        }
+        i = literalEnd;
+
+        writeVarint(out, zeroRun);
+        writeVarint(out, literalEnd - literalStart);
+        for (size_t j = literalStart; j < literalEnd; ++j) {
+            out.push_back(static_cast<uint8_t>(byteAt(from, j) ^ byteAt(to, j)));
+        }
+    }
+}
+
+const uint8_t* RewindBuffer::applyXorDelta(std::vector<uint8_t>& state, const uint8_t* delta,
+                                           size_t deltaSize, size_t targetSize) {
+    // The delta spans max(from, to); bytes past the shorter blob are zero-padded
+    state.resize(std::max(state.size(), targetSize), 0);
+
+    const uint8_t* cursor = delta;
+    const uint8_t* end = delta + deltaSize;
+    size_t position = 0;
+    while (cursor < end) {
+        position += readVarint(cursor, end);
+        size_t literalLength = readVarint(cursor, end);
+        assert(position + literalLength <= state.size());
+        for (size_t j = 0; j < literalLength; ++j) {
+            state[position + j] ^= cursor[j];
+        }
+        cursor += literalLength;
+        position += literalLength;
+    }
+
+    state.resize(targetSize);
+    return end;
+}
+
+void RewindBuffer::evictToBudget() {
+    while (history.size() > 1 && getMemoryUsage() > memoryBudget) {
+        historyBytes -= recordBytes(history.front());
+        history.pop_front();
+
+        // The new oldest turn's delta only leads to the evicted state
+        TurnRecord& oldest = history.front();
+        historyBytes -= recordBytes(oldest);
+        std::vector<uint8_t>().swap(oldest.delta);
+        historyBytes += recordBytes(oldest);
+    }
+}
+
+size_t RewindBuffer::recordBytes(const TurnRecord& record) const {
+    return sizeof(TurnRecord) + record.delta.capacity() + record.keyframe.capacity();
+}
+
+void RewindBuffer::loadKeyframe(const TurnRecord& record, std::vector<std::vector<uint8_t>>& states) const {
+    states.assign(tracks.size(), {});
+    const uint8_t* cursor = record.keyframe.data();
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        uint32_t size = readU32(cursor);
+        states[i].assign(cursor, cursor + size);
+        cursor += size;
+    }
+}
+
+void RewindBuffer::applyRecordDelta(const TurnRecord& record, std::vector<std::vector<uint8_t>>& states,
+                                    bool forward) const {
+    const uint8_t* cursor = record.delta.data();
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        uint32_t previousSize = readU32(cursor);
+        uint32_t currentSize = readU32(cursor);
+        uint32_t encodedSize = readU32(cursor);
+        cursor = applyXorDelta(states[i], cursor, encodedSize, forward ? currentSize : previousSize);
+    }
+}
+
+} // namespace ECS
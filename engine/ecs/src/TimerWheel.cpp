@@ -0,0 +1,187 @@
+#include "../include/TimerWheel.hpp"
+
+namespace ECS {
+
+TimerWheel::TimerWheel() {
+    for (size_t level = 0; level < LEVELS; ++level) {
+        for (size_t slot = 0; slot < SLOTS; ++slot) {
+            slotHead[level][slot] = NIL;
+            slotTail[level][slot] = NIL;
+        }
+    }
+}
+
+uint32_t TimerWheel::allocateNode() {
+    if (freeHead != NIL) {
+        uint32_t index = freeHead;
+        freeHead = nodes[index].next;
+        return index;
+    }
+    nodes.emplace_back();
+    return static_cast<uint32_t>(nodes.size() - 1);
+}
+
+void TimerWheel::freeNode(uint32_t index) {
+    TimerNode& node = nodes[index];
+    node.level = FREE_LEVEL;
+    node.generation++; // Invalidate outstanding handles
+    node.prev = NIL;
+    node.next = freeHead;
+    freeHead = index;
+}
+
+void TimerWheel::placeNode(uint32_t index) {
+    TimerNode& node = nodes[index];
+    uint64_t delta = node.expiry - currentTick;
+    // Park over-long delays at the far edge of the top level; re-placed on cascade
+    uint64_t slotTime = delta > MAX_DELAY ? currentTick + MAX_DELAY : node.expiry;
+    if (delta > MAX_DELAY) {
+        delta = MAX_DELAY;
+    }
+
+    size_t level = 0;
+    while (level + 1 < LEVELS && delta >= (1ULL << (SLOT_BITS * (level + 1)))) {
+        level++;
+    }
+    size_t slot = (slotTime >> (SLOT_BITS * level)) & (SLOTS - 1);
+
+    node.level = static_cast<uint8_t>(level);
+    node.slot = static_cast<uint8_t>(slot);
+    node.next = NIL;
+    node.prev = slotTail[level][slot];
+    if (node.prev != NIL) {
+        nodes[node.prev].next = index;
+    } else {
+        slotHead[level][slot] = index;
+    }
+    slotTail[level][slot] = index;
+}
+
+void TimerWheel::unlinkNode(uint32_t index) {
+    TimerNode& node = nodes[index];
+    if (node.prev != NIL) {
+        nodes[node.prev].next = node.next;
+    } else {
+        slotHead[node.level][node.slot] = node.next;
+    }
+    if (node.next != NIL) {
+        nodes[node.next].prev = node.prev;
+    } else {
+        slotTail[node.level][node.slot] = node.prev;
+    }
+}
+
+const TimerWheel::TimerNode* TimerWheel::findNode(TimerID id) const {
+    uint32_t low = static_cast<uint32_t>(id & 0xFFFFFFFFu);
+    if (low == 0 || low > nodes.size()) {
+        return nullptr;
+    }
+    const TimerNode& node = nodes[low - 1];
+    if (node.level == FREE_LEVEL || node.generation != static_cast<uint32_t>(id >> 32)) {
+        return nullptr;
+    }
+    return &node;
+}
+
+bool TimerWheel::cancel(TimerID id) {
+    if (!findNode(id)) {
+        return false;
+    }
+    uint32_t index = static_cast<uint32_t>(id & 0xFFFFFFFFu) - 1;
+    unlinkNode(index);
+    freeNode(index);
+    pendingCount--;
+    return true;
+}
+
+bool TimerWheel::isPending(TimerID id) const {
+    return findNode(id) != nullptr;
+}
+
+uint64_t TimerWheel::getRemainingTicks(TimerID id) const {
+    const TimerNode* node = findNode(id);
+    return node ? node->expiry - currentTick : 0;
+}
+
+void TimerWheel::cascade(size_t level, size_t slot) {
+    // Detach the whole slot, then re-place each timer at a finer level
+    uint32_t index = slotHead[level][slot];
+    slotHead[level][slot] = NIL;
+    slotTail[level][slot] = NIL;
+    while (index != NIL) {
+        uint32_t next = nodes[index].next;
+        placeNode(index);
+        index = next;
+    }
+}
+
+size_t TimerWheel::expireSlot(size_t slot) {
+    uint32_t index = slotHead[0][slot];
+    slotHead[0][slot] = NIL;
+    slotTail[0][slot] = NIL;
+
+    size_t fired = 0;
+    while (index != NIL) {
+        TimerNode& node = nodes[index];
+        uint32_t next = node.next;
+        node.fire(node.target, node.payload);
+        freeNode(index);
+        fired++;
+        index = next;
+    }
+    pendingCount -= fired;
+    return fired;
+}
+
+size_t TimerWheel::advance(uint64_t ticks) {
+    size_t fired = 0;
+    for (uint64_t i = 0; i < ticks; ++i) {
+        if (pendingCount == 0) {
+            // Nothing scheduled: skip the remaining ticks outright
+            currentTick += ticks - i;
+            break;
+        }
+        currentTick++;
+
+        // Cascade each level whose lower levels just wrapped
+        for (size_t level = 1; level < LEVELS; ++level) {
+            if ((currentTick & ((1ULL << (SLOT_BITS * level)) - 1)) != 0) {
+                break;
+            }
+            cascade(level, (currentTick >> (SLOT_BITS * level)) & (SLOTS - 1));
+        }
+
+        fired += expireSlot(currentTick & (SLOTS - 1));
+    }
+    return fired;
+}
+
+uint64_t TimerWheel::getCurrentTick() const {
+    return currentTick;
+}
+
+size_t TimerWheel::getPendingCount() const {
+    return pendingCount;
+}
+
+void TimerWheel::reserve(size_t timerCount) {
+    nodes.reserve(timerCount);
+}
+
+void TimerWheel::clear() {
+    for (size_t level = 0; level < LEVELS; ++level) {
+        for (size_t slot = 0; slot < SLOTS; ++slot) {
+            uint32_t index = slotHead[level][slot];
+            while (index != NIL) {
+                uint32_t next = nodes[index].next;
+                freeNode(index);
+                index = next;
+            }
+            slotHead[level][slot] = NIL;
+            slotTail[level][slot] = NIL;
+        }
+    }
+    pendingCount = 0;
+}
+
+} // namespace ECS
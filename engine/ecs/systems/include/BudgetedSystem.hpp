@@ -0,0 +1,114 @@
+#pragma once
+
+#include "ISystem.hpp"
+#include <chrono>
+
+namespace ECS {
+
+/**
+ * TimeSlice - Wall-clock allowance for one slice of budgeted work
+ *
+ * Holds a deadline rather than a duration, so checking it is one clock read.
+ * Reading the clock is not free: check expired() every few dozen items of
+ * work, not after every item.
+ */
+class TimeSlice {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Slice ending seconds from now
+     * @param seconds Allowance (<= 0 expires immediately)
+     */
+    explicit TimeSlice(double seconds)
+        : deadline(Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds > 0.0 ? seconds : 0.0)))
+        , seconds(seconds > 0.0 ? seconds : 0.0)
+        , limited(true) {}
+
+    /**
+     * Slice that never expires (work runs to completion)
+     */
+    static TimeSlice unlimited() {
+        TimeSlice slice(0.0);
+        slice.limited = false;
+        return slice;
+    }
+
+    /**
+     * Check whether the allowance is used up
+     * @return true once the deadline has passed (never for unlimited slices)
+     */
+    bool expired() const { return limited && Clock::now() >= deadline; }
+
+    /**
+     * Get time left before the deadline
+     * @return Remaining seconds (0 once expired)
+     */
+    double getRemainingSeconds() const {
+        if (!limited) {
+            return seconds;
+        }
+        double remaining = std::chrono::duration<double>(deadline - Clock::now()).count();
+        return remaining > 0.0 ? remaining : 0.0;
+    }
+
+    /**
+     * Get the allowance this slice was created with
+     * @return Seconds (0 for unlimited slices)
+     */
+    double getSeconds() const { return seconds; }
+
+    bool isUnlimited() const { return !limited; }
+
+private:
+    Clock::time_point deadline;
+    double seconds;
+    bool limited;
+};
+
+/**
+ * BudgetedSystem - Base for expensive systems that work in resumable slices
+ *
+ * AI evaluation, pathfinding rebuilds or fog-of-war updates may not fit in
+ * one frame. A budgeted system keeps its own cursor (next entity, open list,
+ * dirty region) as member state and advances it in updateSlice() until the
+ * slice expires, then resumes from the cursor next frame.
+ *
+ * SystemManager hands each budgeted system a slice of its frame budget (see
+ * SystemManager::setFrameBudget). Without a budget, or when update() is
+ * called directly, the pass runs to completion in one call.
+ *
+ * Contract for updateSlice():
+ * - Do at least one unit of work per call, so progress is guaranteed even
+ *   with an expired slice
+ * - Return true when the current pass is complete; the next call starts a
+ *   new pass
+ */
+class BudgetedSystem : public ISystem {
+public:
+    /**
+     * Run the current pass to completion
+     */
+    void update(float deltaTime, EntityManager& entityManager) final {
+        TimeSlice slice = TimeSlice::unlimited();
+        while (!updateSlice(deltaTime, entityManager, slice)) {
+        }
+    }
+
+    /**
+     * Advance the current pass until done or the slice expires
+     * @param deltaTime Time elapsed since last update (in seconds)
+     * @param entityManager Reference to entity manager for component queries
+     * @param slice Time allowance for this call
+     * @return true if the pass completed during this call
+     */
+    virtual bool updateSlice(float deltaTime, EntityManager& entityManager, const TimeSlice& slice) = 0;
+
+    /**
+     * Get relative share of the frame budget versus other budgeted systems
+     * @return Weight (> 0; default 1)
+     */
+    virtual float getBudgetWeight() const { return 1.0f; }
+};
+
+} // namespace ECS
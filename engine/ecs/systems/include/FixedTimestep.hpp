@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ECS {
+
+/**
+ * FixedTimestep - Game-loop driver decoupling simulation rate from render rate
+ * 
+ * Accumulates real frame time and releases it in fixed simulation steps, so
+ * movement and timers advance identically at 30, 60 or 144 FPS.
+ * 
+ * Features:
+ * - Fixed step size (default 1/60 s) passed to every simulation update
+ * - Max catch-up: at most maxStepsPerFrame steps per frame; excess time is
+ *   dropped (and counted) instead of spiralling after a hitch
+ * - Large frame times are clamped before accumulation (debugger breaks,
+ *   window drags)
+ * - getAlpha() gives the leftover fraction of a step for render
+ *   interpolation between the previous and current simulation state
+ * 
+ * Usage:
+ *   FixedTimestep timestep(1.0f / 60.0f, 5);
+ *   while (running) {
+ *       timestep.run(frameSeconds, [&](float step) {
+ *           TransformUtils::storePreviousPositions(...);
+ *           systemManager.updateAll(step, entityManager);
+ *       });
+ *       renderSystem.setInterpolationAlpha(timestep.getAlpha());
+ *       renderSystem.update(frameSeconds, entityManager);
+ *   }
+ */
+class FixedTimestep {
+public:
+    static constexpr float DEFAULT_STEP = 1.0f / 60.0f;
+    static constexpr uint32_t DEFAULT_MAX_STEPS = 5;
+    static constexpr float MAX_FRAME_TIME = 0.25f;
+    
+    /**
+     * Constructor
+     * @param stepSeconds Fixed simulation step (must be > 0)
+     * @param maxStepsPerFrame Upper bound on steps run per frame (at least 1)
+     */
+    explicit FixedTimestep(float stepSeconds = DEFAULT_STEP, uint32_t maxStepsPerFrame = DEFAULT_MAX_STEPS);
+    
+    /**
+     * Add a frame's elapsed time and consume whole steps
+     * @param frameSeconds Real time since the previous frame
+     * @return Number of simulation steps to run this frame
+     */
+    uint32_t advance(float frameSeconds);
+    
+    /**
+     * advance() and invoke step(stepSeconds) once per simulation step
+     * @return Number of steps run
+     */
+    template <typename StepFunc>
+    uint32_t run(float frameSeconds, StepFunc&& step);
+    
+    /**
+     * Get interpolation factor between previous and current state [0, 1)
+     * @return Accumulated remainder as a fraction of one step
+     */
+    float getAlpha() const;
+    
+    /**
+     * Get fixed step size in seconds
+     * @return Step size
+     */
+    float getStep() const;
+    
+    /**
+     * Get total simulation steps run since construction or reset()
+     * @return Tick count
+     */
+    uint64_t getTickCount() const;
+    
+    /**
+     * Get simulation steps skipped by the catch-up limit since reset()
+     * @return Dropped step count
+     */
+    uint64_t getDroppedSteps() const;
+    
+    /**
+     * Clear accumulator and counters
+     */
+    void reset();
+
+private:
+    float step;
+    uint32_t maxStepsPerFrame;
+    float accumulator = 0.0f;
+    uint64_t tickCount = 0;
+    uint64_t droppedSteps = 0;
+};
+
+// Template implementations (must be inline for templates)
+
+template <typename StepFunc>
+uint32_t FixedTimestep::run(float frameSeconds, StepFunc&& stepFunc) {
+    uint32_t steps = advance(frameSeconds);
+    for (uint32_t i = 0; i < steps; ++i) {
+        stepFunc(step);
+    }
+    return steps;
+}
+
+} // namespace ECS
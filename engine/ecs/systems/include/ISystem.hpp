@@ -5,6 +5,23 @@
 
 namespace ECS {
 
+/**
+ * SystemPhase - Coarse frame stages, executed in declaration order
+ * 
+ * SystemManager runs every system of one phase before any system of the
+ * next; priority only orders systems within a phase. Systems of the same
+ * phase that opt in via canRunInParallel() and have no conflicting access
+ * may run concurrently.
+ */
+enum class SystemPhase : uint8_t {
+    Input = 0,          // Poll devices, translate input into commands
+    Simulation,         // Gameplay, movement, AI
+    PostSimulation,     // Reactions to simulation results (triggers, cleanup)
+    RenderPrep,         // Culling, sorting, interpolation snapshots
+    Render,             // Draw calls
+    Count
+};
+
 /**
  * ISystem - Base interface for all ECS systems
  * 
@@ -37,6 +54,40 @@ public:
      */
     virtual int getPriority() const { return 1000; }
     
+    /**
+     * Get the frame phase this system belongs to
+     * Default: Simulation
+     * @return Phase (phases execute Input -> Simulation -> PostSimulation -> RenderPrep -> Render)
+     */
+    virtual SystemPhase getPhase() const { return SystemPhase::Simulation; }
+    
+    /**
+     * Check if this system may run concurrently with others of its phase
+     * Opt in only if update() touches nothing beyond its declared component
+     * and resource access and does not create or destroy entities.
+     * @return true to allow parallel execution (default false)
+     */
+    virtual bool canRunInParallel() const { return false; }
+    
+    /**
+     * Get bitmask of components this system reads
+     * Default: getRequiredComponents()
+     */
+    virtual uint64_t getComponentReads() const { return getRequiredComponents(); }
+    
+    /**
+     * Get bitmask of components this system writes
+     * Default: getRequiredComponents() (conservative)
+     */
+    virtual uint64_t getComponentWrites() const { return getRequiredComponents(); }
+    
+    /**
+     * Get display name for profiling and diagnostics
+     * The returned string must outlive the system (a literal is typical).
+     * @return System name
+     */
+    virtual const char* getName() const { return "System"; }
+    
     /**
      * Check if system should be updated this frame
      * Useful for systems that run every N frames or have other conditions
@@ -47,6 +98,20 @@ public:
         (void)deltaTime; // Suppress unused parameter warning
         return true; 
     }
+    
+    /**
+     * Get bitmask of singleton resources this system reads
+     * Used by the scheduler to decide which systems may run concurrently
+     * @return Resource bitmask (use getResourceBit<Resource>() to build)
+     */
+    virtual uint64_t getResourceReads() const { return 0; }
+    
+    /**
+     * Get bitmask of singleton resources this system writes
+     * A written resource conflicts with any other read or write of it
+     * @return Resource bitmask (use getResourceBit<Resource>() to build)
+     */
+    virtual uint64_t getResourceWrites() const { return 0; }
 };
 
 } // namespace ECS
\ No newline at end of file
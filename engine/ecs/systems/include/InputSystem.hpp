@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IInputManager.hpp"
+#include "ISystem.hpp"
 #include "../../include/EntityManager.hpp"
 #include "../../components/include/Transform.hpp"
 
@@ -11,15 +12,16 @@ namespace ECS {
  * 
  * Processes input events and updates entity positions/states based on user input.
  * Designed to work with any IInputManager implementation (SFML, mock, etc.).
+ * Runs first, in the Input phase, so later phases see this frame's input.
  */
-class InputSystem {
+class InputSystem : public ISystem {
 public:
     /**
      * Constructor with dependency injection
      * @param inputManager Input manager to use for input queries
      */
     explicit InputSystem(IInputManager* inputManager);
-    ~InputSystem() = default;
+    ~InputSystem() override = default;
     
     /**
      * Update system - processes input and updates entity states
@@ -28,6 +30,19 @@ public:
      */
     void update(EntityManager& entityManager, float deltaTime = 1.0f);
     
+    /**
+     * ISystem entry point (same as update(entityManager, deltaTime))
+     */
+    void update(float deltaTime, EntityManager& entityManager) override;
+    
+    /**
+     * Get required components (none: input is polled once per frame)
+     */
+    uint64_t getRequiredComponents() const override;
+    
+    SystemPhase getPhase() const override;
+    const char* getName() const override;
+    
     /**
      * Set which entity should be controlled by keyboard input
      * @param entityId ID of entity to control (or invalid entity to disable)
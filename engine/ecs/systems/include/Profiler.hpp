@@ -0,0 +1,239 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace ECS {
+
+using ZoneID = uint32_t;
+
+/**
+ * ZoneStats - Timing summary of one profiled zone (system or scoped zone)
+ * All times are in seconds; percentiles cover the last Profiler::HISTORY samples.
+ */
+struct ZoneStats {
+    const char* name = "";
+    uint64_t samples = 0;
+    double last = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    double p50 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    size_t lastEntityCount = 0;
+};
+
+/**
+ * Profiler - Per-zone frame timings and Chrome trace capture
+ *
+ * A zone is a named, repeatedly-timed region. SystemManager registers one
+ * zone per system (see SystemManager::setProfiler) plus a whole-frame zone;
+ * code inside systems adds its own with ECS_PROFILE_ZONE("name").
+ *
+ * For each zone the profiler keeps last/min/max, a ring of the last HISTORY
+ * samples for rolling p50/p95/p99, and the entity count of the last sample.
+ * While capturing, every sample is also appended to a trace buffer (capped)
+ * that writeChromeTrace() emits as trace-event JSON, loadable in
+ * chrome://tracing or Perfetto.
+ *
+ * Zone names are stored as pointers and must outlive the profiler (string
+ * literals or system-owned names). Recording is guarded by a mutex, so
+ * zones may be timed from worker threads.
+ *
+ * Usage:
+ *   Profiler profiler;
+ *   systemManager.setProfiler(&profiler);
+ *   profiler.beginCapture();
+ *   ... frames ...
+ *   profiler.endCapture();
+ *   profiler.writeChromeTrace(file);
+ *   ZoneStats movement = profiler.getStats("MovementSystem");
+ */
+class Profiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t HISTORY = 128;
+    static constexpr size_t DEFAULT_CAPTURE_EVENTS = 1u << 20;
+
+    Profiler();
+
+    // Non-copyable and non-movable (zones hold the address via getCurrent)
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    /**
+     * Get the process-unique serial of this profiler (never 0)
+     * Lets call sites cache zone IDs per profiler (see ZoneSite).
+     */
+    uint32_t getSerial() const;
+
+    /**
+     * Find or create the zone for (name, owner)
+     * Takes the lock and scans all zones: resolve IDs once, not per sample.
+     * Zones with the same name but different owners (e.g. two instances of a
+     * system) are kept apart.
+     * @return Stable zone ID
+     */
+    ZoneID registerZone(const char* name, const void* owner = nullptr);
+
+    /**
+     * Record one timed sample
+     * @param entityCount Entities processed (0 if not applicable)
+     */
+    void record(ZoneID zone, Clock::time_point begin, Clock::time_point end, size_t entityCount = 0);
+
+    /**
+     * Get statistics for a zone
+     */
+    ZoneStats getStats(ZoneID zone) const;
+
+    /**
+     * Get statistics of the first zone with this name
+     * @return Stats with samples == 0 if no such zone exists
+     */
+    ZoneStats getStats(const char* name) const;
+
+    /**
+     * Get statistics for every zone, in registration order
+     */
+    std::vector<ZoneStats> getAllStats() const;
+
+    size_t getZoneCount() const;
+
+    /**
+     * Start collecting trace events (previous capture is discarded)
+     * @param maxEvents Events kept; later samples are counted as dropped
+     */
+    void beginCapture(size_t maxEvents = DEFAULT_CAPTURE_EVENTS);
+    void endCapture();
+    bool isCapturing() const;
+    size_t getCapturedEventCount() const;
+    size_t getDroppedEventCount() const;
+
+    /**
+     * Write captured events as Chrome trace-event JSON ("X" complete events)
+     * @return false on stream error
+     */
+    bool writeChromeTrace(std::ostream& out) const;
+
+    /**
+     * Write a plain-text table of zone statistics (milliseconds)
+     */
+    void writeSummary(std::ostream& out) const;
+
+    /**
+     * Drop all statistics and captured events (zones stay registered)
+     */
+    void reset();
+
+    /**
+     * Profiler that ECS_PROFILE_ZONE records into (nullptr disables zones)
+     * SystemManager installs its profiler for the duration of updateAll().
+     */
+    static Profiler* getCurrent();
+    static void setCurrent(Profiler* profiler);
+
+private:
+    struct Zone {
+        const char* name = "";
+        const void* owner = nullptr;
+        uint64_t samples = 0;
+        double last = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+        size_t lastEntityCount = 0;
+        double history[HISTORY] = {};
+    };
+
+    struct TraceEvent {
+        ZoneID zone = 0;
+        uint32_t thread = 0;
+        int64_t beginNs = 0;
+        int64_t durationNs = 0;
+    };
+
+    ZoneStats buildStats(const Zone& zone) const;
+    static uint32_t getThreadIndex();
+
+    mutable std::mutex mutex;
+    std::vector<Zone> zones;
+    std::vector<TraceEvent> trace;
+    Clock::time_point epoch;
+    size_t maxTraceEvents = 0;
+    size_t droppedEvents = 0;
+    bool capturing = false;
+    uint32_t serial;
+
+    static std::atomic<Profiler*> current;
+};
+
+/**
+ * ZoneSite - Zone ID of one ECS_PROFILE_ZONE call site, cached per profiler
+ *
+ * The first sample under a profiler registers the zone; later samples read
+ * the cached (profiler serial, ZoneID) pair with one atomic load. A
+ * different profiler re-registers once and replaces the cache.
+ */
+class ZoneSite {
+public:
+    explicit ZoneSite(const char* name);
+
+    ZoneSite(const ZoneSite&) = delete;
+    ZoneSite& operator=(const ZoneSite&) = delete;
+
+    /**
+     * Get this site's zone in a profiler (registers on first use)
+     */
+    ZoneID resolve(Profiler& profiler);
+
+private:
+    const char* name;
+    std::atomic<uint64_t> cached{0};  // Profiler serial << 32 | ZoneID
+};
+
+/**
+ * ScopedZone - RAII sample of a zone
+ * Does nothing (no clock reads) when no profiler is installed.
+ */
+class ScopedZone {
+public:
+    /**
+     * Time a pre-registered zone of a profiler (nullptr: no-op)
+     */
+    ScopedZone(Profiler* profiler, ZoneID zone);
+
+    /**
+     * Time a call site's zone in the current profiler
+     */
+    explicit ScopedZone(ZoneSite& site);
+
+    ~ScopedZone();
+
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+    Profiler* profiler;
+    ZoneID zone = 0;
+    Profiler::Clock::time_point begin;
+};
+
+} // namespace ECS
+
+#define ECS_PROFILE_CONCAT_INNER(a, b) a##b
+#define ECS_PROFILE_CONCAT(a, b) ECS_PROFILE_CONCAT_INNER(a, b)
+
+/**
+ * Time the enclosing scope as a named zone of the current profiler
+ * The zone ID is resolved once per call site and profiler.
+ * @param name String literal
+ */
+#define ECS_PROFILE_ZONE(name)                                                            \
+    static ::ECS::ZoneSite ECS_PROFILE_CONCAT(profileSite_, __LINE__)(name);              \
+    ::ECS::ScopedZone ECS_PROFILE_CONCAT(profileZone_, __LINE__)(ECS_PROFILE_CONCAT(profileSite_, __LINE__))
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "ISystem.hpp"
+#include "BudgetedSystem.hpp"
+#include "Profiler.hpp"
+#include "WorkerPool.hpp"
 #include "../../include/EntityManager.hpp"
 #include <memory>
 #include <vector>
+#include <utility>
 
 namespace ECS {
 
@@ -14,17 +18,40 @@ namespace ECS {
  * dependency injection capabilities for systems that need external interfaces.
  * 
  * Key Features:
- * - Priority-based system execution (lower priority values execute first)
+ * - Phase-ordered execution (Input -> Simulation -> PostSimulation ->
+ *   RenderPrep -> Render), then priority within a phase (lower values first)
+ * - Parallel batches: with a WorkerPool attached, consecutive systems of one
+ *   phase that opt in via canRunInParallel() and have no conflicting
+ *   component/resource access run concurrently
  * - Conditional system updates (systems can skip frames via shouldUpdate)
+ * - Frame budget: BudgetedSystems get weighted time slices of whatever the
+ *   budget has left when their turn comes, so expensive work spreads over
+ *   frames instead of causing hitches
+ * - Optional profiler: per-system timings and entity counts every frame
  * - Integration with EntityManager for entity filtering
  * - Dependency injection support for testability
  */
 class SystemManager {
 private:
     std::vector<std::unique_ptr<ISystem>> systems;
+    std::vector<BudgetedSystem*> budgeted;   // Parallel to systems (nullptr if not budgeted)
+    std::vector<ZoneID> systemZones;         // Parallel to systems (valid when profiling)
+    std::vector<SystemPhase> phases;         // Parallel to systems
+    std::vector<char> parallelSafe;          // Parallel to systems
+    std::vector<size_t> batch;               // Scratch: system indices of the current batch
+    std::vector<Profiler::Clock::time_point> batchTimes; // Scratch: begin/end per batch member
+    std::vector<char> runThisFrame;          // Scratch for updateAll
+    std::vector<std::pair<uint64_t, size_t>> entityCounts; // Per-frame count cache by mask
+    Profiler* profiler = nullptr;
+    WorkerPool* workerPool = nullptr;
+    ZoneID frameZone = 0;
     bool systemsNeedSorting = false;
+    double frameBudget = 0.0;                // Seconds; <= 0 disables slicing
+    double minimumSlice = DEFAULT_MIN_SLICE;
 
 public:
+    static constexpr double DEFAULT_MIN_SLICE = 0.0001;
+
     /**
      * Construct SystemManager
      */
@@ -46,13 +73,61 @@ public:
     void registerSystem(std::unique_ptr<ISystem> system);
     
     /**
-     * Update all registered systems in priority order
+     * Update all registered systems in phase, then priority order
      * Only systems where shouldUpdate() returns true will be executed
      * @param deltaTime Time elapsed since last update (in seconds)
      * @param entityManager Reference to entity manager for systems to use
      */
     void updateAll(float deltaTime, EntityManager& entityManager);
     
+    /**
+     * Set the wall-clock budget for one updateAll() call
+     * 
+     * When a BudgetedSystem's turn comes, it receives the budget still left
+     * (after the systems before it) split by weight among the budgeted systems
+     * yet to run, but never less than minSliceSeconds so every one advances.
+     * Time a system leaves unused flows to the ones after it.
+     * @param seconds Budget per updateAll (<= 0 runs budgeted systems to completion)
+     * @param minSliceSeconds Floor for any single slice
+     */
+    void setFrameBudget(double seconds, double minSliceSeconds = DEFAULT_MIN_SLICE);
+    
+    /**
+     * Get the frame budget
+     * @return Seconds per updateAll (0 when disabled)
+     */
+    double getFrameBudget() const;
+    
+    /**
+     * Attach a profiler (nullptr detaches)
+     * Each updateAll() then records one sample per system that ran (named by
+     * ISystem::getName(), with the count of entities matching its required
+     * components) plus a "SystemManager::updateAll" frame sample, and
+     * installs the profiler as Profiler::getCurrent() so ECS_PROFILE_ZONE
+     * inside systems records into it.
+     * @param profiler Profiler to record into (must outlive its attachment)
+     */
+    void setProfiler(Profiler* profiler);
+    
+    /**
+     * Get the attached profiler
+     * @return Profiler, or nullptr if none
+     */
+    Profiler* getProfiler() const;
+    
+    /**
+     * Attach a worker pool for parallel batches (nullptr runs everything serially)
+     * Budgeted systems and systems that do not opt in always run alone.
+     * @param pool Pool to run batches on (must outlive its attachment)
+     */
+    void setWorkerPool(WorkerPool* pool);
+    
+    /**
+     * Get the attached worker pool
+     * @return Pool, or nullptr if none
+     */
+    WorkerPool* getWorkerPool() const;
+    
     /**
      * Remove all registered systems
      */
@@ -63,12 +138,57 @@ public:
      * @return Count of registered systems
      */
     size_t getSystemCount() const;
+    
+    /**
+     * Check if two systems have conflicting resource access
+     * Systems conflict when either writes a resource the other reads or writes.
+     * Non-conflicting systems are candidates for concurrent execution.
+     * @param a First system
+     * @param b Second system
+     * @return true if the systems must not run concurrently
+     */
+    static bool hasResourceConflict(const ISystem& a, const ISystem& b);
+    
+    /**
+     * Check if two systems conflict on components or resources
+     * Same rule as hasResourceConflict, applied to getComponentReads/Writes too.
+     * @return true if the systems must not run concurrently
+     */
+    static bool hasAccessConflict(const ISystem& a, const ISystem& b);
+    
+    /**
+     * Get display name of a phase
+     * @return Phase name (e.g. "Simulation")
+     */
+    static const char* getPhaseName(SystemPhase phase);
 
 private:
     /**
-     * Sort systems by priority if needed
+     * Sort systems by phase, then priority if needed
      */
     void sortSystemsIfNeeded();
+    
+    /**
+     * Rebuild per-system views (budgeted pointers, profiler zones) after reordering
+     */
+    void refreshSystemViews();
+    
+    /**
+     * Count entities matching a component mask, cached for the current frame
+     */
+    size_t getCachedEntityCount(uint64_t mask, const EntityManager& entityManager);
+    
+    /**
+     * Collect the batch starting at system index first
+     * @return Index just past the batch
+     */
+    size_t collectBatch(size_t first);
+    
+    /**
+     * Run the collected batch (serially, sliced, or on the worker pool)
+     */
+    void runBatch(float deltaTime, EntityManager& entityManager,
+                  Profiler::Clock::time_point frameStart, double& pendingWeight);
 };
 
 } // namespace ECS
\ No newline at end of file
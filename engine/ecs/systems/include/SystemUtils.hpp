@@ -2,6 +2,7 @@
 
 #include "../../include/EntityManager.hpp"
 #include "../../include/ComponentRegistry.hpp"
+#include "../../include/Resources.hpp"
 #include <vector>
 #include <functional>
 
@@ -113,5 +114,23 @@ inline uint64_t getRequiredMask() {
     return getComponentBit<Component1>() | getRequiredMask<Component2, Components...>();
 }
 
+/**
+ * Create a resource bitmask for a single resource type
+ * @return Resource bitmask for ISystem::getResourceReads/getResourceWrites
+ */
+template<typename Resource>
+inline uint64_t getResourceMask() {
+    return getResourceBit<Resource>();
+}
+
+/**
+ * Create a resource bitmask for multiple resource types
+ * @return Combined resource bitmask for all specified types
+ */
+template<typename Resource1, typename Resource2, typename... Resources>
+inline uint64_t getResourceMask() {
+    return getResourceBit<Resource1>() | getResourceMask<Resource2, Resources...>();
+}
+
 } // namespace SystemUtils
 } // namespace ECS
\ No newline at end of file
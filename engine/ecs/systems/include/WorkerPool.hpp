@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * WorkerPool - Persistent threads for blocking parallel-for jobs
+ *
+ * Threads are created once and sleep between jobs, so per-frame parallel
+ * work (system batches, bulk path requests) pays no thread start-up cost.
+ * parallelFor() blocks until every index has run; the calling thread takes
+ * indices too, so a pool of N workers runs on N + 1 threads.
+ *
+ * One job runs at a time: parallelFor() is not reentrant and must not be
+ * called from inside a job.
+ *
+ * Usage:
+ *   WorkerPool pool(std::thread::hardware_concurrency() - 1);
+ *   pool.parallelFor(requests.size(), [&](size_t i) { solve(requests[i]); });
+ */
+class WorkerPool {
+public:
+    /**
+     * Constructor
+     * @param workerCount Extra threads to start (0 runs every job on the caller)
+     */
+    explicit WorkerPool(size_t workerCount);
+
+    /**
+     * Stops and joins all workers
+     */
+    ~WorkerPool();
+
+    // Non-copyable and non-movable (workers hold a pointer to the pool)
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * Run func(index) for every index in [0, count), then return
+     * Indices are handed out dynamically, so uneven items balance themselves.
+     */
+    template <typename Func>
+    void parallelFor(size_t count, Func&& func);
+
+    /**
+     * Get number of worker threads (excluding the caller)
+     */
+    size_t getWorkerCount() const;
+
+private:
+    using JobThunk = void (*)(void* context, size_t index);
+
+    template <typename Func>
+    static void invokeJob(void* context, size_t index) {
+        (*static_cast<Func*>(context))(index);
+    }
+
+    void run(size_t count, JobThunk thunk, void* context);
+    void workerLoop();
+    void drainJob();
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable jobReady;
+    std::condition_variable jobDone;
+
+    // Current job (written under mutex before generation is bumped)
+    JobThunk jobThunk = nullptr;
+    void* jobContext = nullptr;
+    size_t jobCount = 0;
+    std::atomic<size_t> nextIndex{0};
+    uint64_t generation = 0;
+    size_t activeWorkers = 0;
+    bool stopping = false;
+};
+
+// Template implementations (must be inline for templates)
+
+template <typename Func>
+void WorkerPool::parallelFor(size_t count, Func&& func) {
+    using FuncType = std::remove_reference_t<Func>;
+    run(count, &WorkerPool::invokeJob<FuncType>, const_cast<void*>(static_cast<const void*>(&func)));
+}
+
+} // namespace ECS
@@ -0,0 +1,58 @@
+#include "../include/FixedTimestep.hpp"
+
+namespace ECS {
+
+FixedTimestep::FixedTimestep(float stepSeconds, uint32_t maxStepsPerFrame)
+    : step(stepSeconds > 0.0f ? stepSeconds : DEFAULT_STEP)
+    , maxStepsPerFrame(maxStepsPerFrame > 0 ? maxStepsPerFrame : 1) {
+}
+
+uint32_t FixedTimestep::advance(float frameSeconds) {
+    // Ignore negative time and clamp long stalls
+    if (frameSeconds < 0.0f) {
+        frameSeconds = 0.0f;
+    }
+    if (frameSeconds > MAX_FRAME_TIME) {
+        frameSeconds = MAX_FRAME_TIME;
+    }
+    accumulator += frameSeconds;
+    
+    uint32_t steps = 0;
+    while (accumulator >= step && steps < maxStepsPerFrame) {
+        accumulator -= step;
+        steps++;
+    }
+    
+    // Catch-up limit reached: drop whole steps, keep the fractional remainder
+    while (accumulator >= step) {
+        accumulator -= step;
+        droppedSteps++;
+    }
+    
+    tickCount += steps;
+    return steps;
+}
+
+float FixedTimestep::getAlpha() const {
+    return accumulator / step;
+}
+
+float FixedTimestep::getStep() const {
+    return step;
+}
+
+uint64_t FixedTimestep::getTickCount() const {
+    return tickCount;
+}
+
+uint64_t FixedTimestep::getDroppedSteps() const {
+    return droppedSteps;
+}
+
+void FixedTimestep::reset() {
+    accumulator = 0.0f;
+    tickCount = 0;
+    droppedSteps = 0;
+}
+
+} // namespace ECS
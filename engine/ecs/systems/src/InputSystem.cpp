@@ -28,6 +28,22 @@ void InputSystem::update(EntityManager& entityManager, float deltaTime) {
     processMouseInput();
 }
 
+void InputSystem::update(float deltaTime, EntityManager& entityManager) {
+    update(entityManager, deltaTime);
+}
+
+uint64_t InputSystem::getRequiredComponents() const {
+    return 0;
+}
+
+SystemPhase InputSystem::getPhase() const {
+    return SystemPhase::Input;
+}
+
+const char* InputSystem::getName() const {
+    return "InputSystem";
+}
+
 void InputSystem::setControlledEntity(EntityID entityId) {
     controlledEntity = entityId;
     if (entityId != INVALID_ENTITY) {
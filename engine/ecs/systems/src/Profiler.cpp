@@ -0,0 +1,278 @@
+#include "../include/Profiler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace ECS {
+
+std::atomic<Profiler*> Profiler::current{nullptr};
+
+namespace {
+
+/**
+ * Write a zone name as a JSON string body (quotes and control characters escaped)
+ */
+void writeJsonString(std::ostream& out, const char* text) {
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            out << '\\' << *c;
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(*c));
+            out << escaped;
+        } else {
+            out << *c;
+        }
+    }
+}
+
+} // namespace
+
+Profiler::Profiler()
+    : epoch(Clock::now()) {
+    static std::atomic<uint32_t> nextSerial{1};
+    serial = nextSerial.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t Profiler::getSerial() const {
+    return serial;
+}
+
+ZoneID Profiler::registerZone(const char* name, const void* owner) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < zones.size(); ++i) {
+        const Zone& zone = zones[i];
+        if (zone.owner == owner && (zone.name == name || std::strcmp(zone.name, name) == 0)) {
+            return static_cast<ZoneID>(i);
+        }
+    }
+    zones.emplace_back();
+    zones.back().name = name;
+    zones.back().owner = owner;
+    return static_cast<ZoneID>(zones.size() - 1);
+}
+
+void Profiler::record(ZoneID zoneId, Clock::time_point begin, Clock::time_point end, size_t entityCount) {
+    double seconds = std::chrono::duration<double>(end - begin).count();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (zoneId >= zones.size()) {
+        return;
+    }
+    Zone& zone = zones[zoneId];
+    if (zone.samples == 0 || seconds < zone.min) {
+        zone.min = seconds;
+    }
+    if (zone.samples == 0 || seconds > zone.max) {
+        zone.max = seconds;
+    }
+    zone.last = seconds;
+    zone.lastEntityCount = entityCount;
+    zone.history[zone.samples % HISTORY] = seconds;
+    zone.samples++;
+
+    if (capturing) {
+        if (trace.size() < maxTraceEvents) {
+            TraceEvent event;
+            event.zone = zoneId;
+            event.thread = getThreadIndex();
+            event.beginNs = std::chrono::duration_cast<std::chrono::nanoseconds>(begin - epoch).count();
+            event.durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+            trace.push_back(event);
+        } else {
+            droppedEvents++;
+        }
+    }
+}
+
+ZoneStats Profiler::buildStats(const Zone& zone) const {
+    ZoneStats stats;
+    stats.name = zone.name;
+    stats.samples = zone.samples;
+    stats.last = zone.last;
+    stats.min = zone.min;
+    stats.max = zone.max;
+    stats.lastEntityCount = zone.lastEntityCount;
+    if (zone.samples == 0) {
+        return stats;
+    }
+
+    // Nearest-rank percentiles over the rolling window
+    size_t count = static_cast<size_t>(std::min<uint64_t>(zone.samples, HISTORY));
+    double sorted[HISTORY];
+    std::copy(zone.history, zone.history + count, sorted);
+    std::sort(sorted, sorted + count);
+    auto percentile = [&](double fraction) {
+        size_t rank = static_cast<size_t>(fraction * static_cast<double>(count) + 0.999999);
+        return sorted[std::min(std::max<size_t>(rank, 1), count) - 1];
+    };
+    stats.p50 = percentile(0.50);
+    stats.p95 = percentile(0.95);
+    stats.p99 = percentile(0.99);
+    return stats;
+}
+
+ZoneStats Profiler::getStats(ZoneID zone) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (zone >= zones.size()) {
+        return ZoneStats();
+    }
+    return buildStats(zones[zone]);
+}
+
+ZoneStats Profiler::getStats(const char* name) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& zone : zones) {
+        if (std::strcmp(zone.name, name) == 0) {
+            return buildStats(zone);
+        }
+    }
+    return ZoneStats();
+}
+
+std::vector<ZoneStats> Profiler::getAllStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<ZoneStats> result;
+    result.reserve(zones.size());
+    for (const auto& zone : zones) {
+        result.push_back(buildStats(zone));
+    }
+    return result;
+}
+
+size_t Profiler::getZoneCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return zones.size();
+}
+
+void Profiler::beginCapture(size_t maxEvents) {
+    std::lock_guard<std::mutex> lock(mutex);
+    trace.clear();
+    trace.reserve(std::min<size_t>(maxEvents, 4096));
+    maxTraceEvents = maxEvents;
+    droppedEvents = 0;
+    capturing = true;
+}
+
+void Profiler::endCapture() {
+    std::lock_guard<std::mutex> lock(mutex);
+    capturing = false;
+}
+
+bool Profiler::isCapturing() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return capturing;
+}
+
+size_t Profiler::getCapturedEventCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return trace.size();
+}
+
+size_t Profiler::getDroppedEventCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return droppedEvents;
+}
+
+bool Profiler::writeChromeTrace(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    out << "{\"traceEvents\":[";
+    char timing[96];
+    for (size_t i = 0; i < trace.size(); ++i) {
+        const TraceEvent& event = trace[i];
+        out << (i == 0 ? "\n" : ",\n") << "{\"name\":\"";
+        writeJsonString(out, zones[event.zone].name);
+        // Trace-event timestamps are microseconds
+        std::snprintf(timing, sizeof(timing), "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                      static_cast<double>(event.beginNs) / 1000.0,
+                      static_cast<double>(event.durationNs) / 1000.0,
+                      event.thread);
+        out << timing;
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return static_cast<bool>(out);
+}
+
+void Profiler::writeSummary(std::ostream& out) const {
+    std::vector<ZoneStats> all = getAllStats();
+    char line[160];
+    std::snprintf(line, sizeof(line), "%-24s %8s %9s %9s %9s %9s %9s %9s\n",
+                  "zone (ms)", "entities", "last", "min", "p50", "p95", "p99", "max");
+    out << line;
+    for (const auto& stats : all) {
+        if (stats.samples == 0) {
+            continue;
+        }
+        std::snprintf(line, sizeof(line), "%-24.24s %8zu %9.4f %9.4f %9.4f %9.4f %9.4f %9.4f\n",
+                      stats.name, stats.lastEntityCount,
+                      stats.last * 1000.0, stats.min * 1000.0, stats.p50 * 1000.0,
+                      stats.p95 * 1000.0, stats.p99 * 1000.0, stats.max * 1000.0);
+        out << line;
+    }
+}
+
+void Profiler::reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& zone : zones) {
+        const char* name = zone.name;
+        const void* owner = zone.owner;
+        zone = Zone();
+        zone.name = name;
+        zone.owner = owner;
+    }
+    trace.clear();
+    droppedEvents = 0;
+}
+
+Profiler* Profiler::getCurrent() {
+    return current.load(std::memory_order_acquire);
+}
+
+void Profiler::setCurrent(Profiler* profiler) {
+    current.store(profiler, std::memory_order_release);
+}
+
+uint32_t Profiler::getThreadIndex() {
+    // Small sequential IDs read better in trace viewers than hashed thread IDs
+    static std::atomic<uint32_t> nextIndex{1};
+    thread_local uint32_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+ZoneSite::ZoneSite(const char* name)
+    : name(name) {
+}
+
+ZoneID ZoneSite::resolve(Profiler& profiler) {
+    uint64_t entry = cached.load(std::memory_order_acquire);
+    if (static_cast<uint32_t>(entry >> 32) == profiler.getSerial()) {
+        return static_cast<ZoneID>(entry);
+    }
+    ZoneID zone = profiler.registerZone(name);
+    cached.store((static_cast<uint64_t>(profiler.getSerial()) << 32) | zone, std::memory_order_release);
+    return zone;
+}
+
+ScopedZone::ScopedZone(Profiler* profiler, ZoneID zone)
+    : profiler(profiler)
+    , zone(zone) {
+    if (profiler) {
+        begin = Profiler::Clock::now();
+    }
+}
+
+ScopedZone::ScopedZone(ZoneSite& site)
+    : profiler(Profiler::getCurrent()) {
+    if (profiler) {
+        zone = site.resolve(*profiler);
+        begin = Profiler::Clock::now();
+    }
+}
+
+ScopedZone::~ScopedZone() {
+    if (profiler) {
+        profiler->record(zone, begin, Profiler::Clock::now());
+    }
+}
+
+} // namespace ECS
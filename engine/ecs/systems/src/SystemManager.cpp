@@ -1,5 +1,6 @@
 #include "../include/SystemManager.hpp"
 #include <algorithm>
+#include <chrono>
 
 namespace ECS {
 
@@ -11,19 +12,164 @@ void SystemManager::registerSystem(std::unique_ptr<ISystem> system) {
 }
 
 void SystemManager::updateAll(float deltaTime, EntityManager& entityManager) {
-    // Sort systems by priority if needed
+    // Sort systems by phase and priority if needed
     sortSystemsIfNeeded();
     
-    // Update all systems that should run this frame
-    for (auto& system : systems) {
-        if (system->shouldUpdate(deltaTime)) {
-            system->update(deltaTime, entityManager);
+    using Clock = Profiler::Clock;
+    const Clock::time_point frameStart = Clock::now();
+    Profiler* outerProfiler = Profiler::getCurrent();
+    if (profiler) {
+        Profiler::setCurrent(profiler);
+        entityCounts.clear();
+    }
+    
+    // Decide who runs up front, so slices are split only among those
+    double pendingWeight = 0.0;
+    runThisFrame.assign(systems.size(), 0);
+    for (size_t i = 0; i < systems.size(); ++i) {
+        if (systems[i]->shouldUpdate(deltaTime)) {
+            runThisFrame[i] = 1;
+            if (budgeted[i]) {
+                pendingWeight += std::max(budgeted[i]->getBudgetWeight(), 0.0f);
+            }
         }
     }
+    
+    // Update all systems that should run this frame, batch by batch
+    size_t next = 0;
+    while (next < systems.size()) {
+        if (!runThisFrame[next]) {
+            next++;
+            continue;
+        }
+        next = collectBatch(next);
+        runBatch(deltaTime, entityManager, frameStart, pendingWeight);
+    }
+    
+    if (profiler) {
+        profiler->record(frameZone, frameStart, Clock::now(), entityManager.getActiveEntityCount());
+        Profiler::setCurrent(outerProfiler);
+    }
+}
+
+size_t SystemManager::collectBatch(size_t first) {
+    batch.clear();
+    batch.push_back(first);
+    if (!workerPool || !parallelSafe[first]) {
+        return first + 1;
+    }
+    
+    // Extend with following same-phase systems until one conflicts or opts out;
+    // a conflicting system then starts the next batch, preserving its order
+    size_t next = first + 1;
+    for (; next < systems.size() && phases[next] == phases[first]; ++next) {
+        if (!runThisFrame[next]) {
+            continue;
+        }
+        if (!parallelSafe[next]) {
+            break;
+        }
+        bool conflict = false;
+        for (size_t member : batch) {
+            if (hasAccessConflict(*systems[member], *systems[next])) {
+                conflict = true;
+                break;
+            }
+        }
+        if (conflict) {
+            break;
+        }
+        batch.push_back(next);
+    }
+    return next;
+}
+
+void SystemManager::runBatch(float deltaTime, EntityManager& entityManager,
+                             Profiler::Clock::time_point frameStart, double& pendingWeight) {
+    using Clock = Profiler::Clock;
+    batchTimes.resize(batch.size() * 2);
+    
+    if (batch.size() == 1) {
+        size_t index = batch[0];
+        batchTimes[0] = profiler ? Clock::now() : frameStart;
+        
+        BudgetedSystem* sliced = budgeted[index];
+        if (sliced && frameBudget > 0.0) {
+            double weight = std::max(sliced->getBudgetWeight(), 0.0f);
+            double elapsed = std::chrono::duration<double>(Clock::now() - frameStart).count();
+            double remaining = std::max(frameBudget - elapsed, 0.0);
+            double share = pendingWeight > 0.0 ? remaining * weight / pendingWeight : remaining;
+            pendingWeight -= weight;
+            
+            sliced->updateSlice(deltaTime, entityManager, TimeSlice(std::max(share, minimumSlice)));
+        } else {
+            systems[index]->update(deltaTime, entityManager);
+        }
+        batchTimes[1] = profiler ? Clock::now() : frameStart;
+    } else {
+        workerPool->parallelFor(batch.size(), [&](size_t member) {
+            batchTimes[member * 2] = Clock::now();
+            systems[batch[member]]->update(deltaTime, entityManager);
+            batchTimes[member * 2 + 1] = Clock::now();
+        });
+    }
+    
+    // Recorded here rather than on workers: the entity count cache is not thread-safe
+    if (profiler) {
+        for (size_t member = 0; member < batch.size(); ++member) {
+            size_t index = batch[member];
+            size_t entities = getCachedEntityCount(systems[index]->getRequiredComponents(), entityManager);
+            profiler->record(systemZones[index], batchTimes[member * 2], batchTimes[member * 2 + 1], entities);
+        }
+    }
+}
+
+void SystemManager::setFrameBudget(double seconds, double minSliceSeconds) {
+    frameBudget = seconds > 0.0 ? seconds : 0.0;
+    minimumSlice = minSliceSeconds > 0.0 ? minSliceSeconds : 0.0;
+}
+
+double SystemManager::getFrameBudget() const {
+    return frameBudget;
+}
+
+void SystemManager::setProfiler(Profiler* newProfiler) {
+    profiler = newProfiler;
+    if (profiler) {
+        frameZone = profiler->registerZone("SystemManager::updateAll");
+    }
+    refreshSystemViews();
+}
+
+Profiler* SystemManager::getProfiler() const {
+    return profiler;
+}
+
+void SystemManager::setWorkerPool(WorkerPool* pool) {
+    workerPool = pool;
+}
+
+WorkerPool* SystemManager::getWorkerPool() const {
+    return workerPool;
+}
+
+size_t SystemManager::getCachedEntityCount(uint64_t mask, const EntityManager& entityManager) {
+    for (const auto& entry : entityCounts) {
+        if (entry.first == mask) {
+            return entry.second;
+        }
+    }
+    size_t count = entityManager.countEntitiesWith(mask);
+    entityCounts.emplace_back(mask, count);
+    return count;
 }
 
 void SystemManager::clearSystems() {
     systems.clear();
+    budgeted.clear();
+    systemZones.clear();
+    phases.clear();
+    parallelSafe.clear();
     systemsNeedSorting = false;
 }
 
@@ -31,15 +177,62 @@ size_t SystemManager::getSystemCount() const {
     return systems.size();
 }
 
+bool SystemManager::hasResourceConflict(const ISystem& a, const ISystem& b) {
+    uint64_t aAccess = a.getResourceReads() | a.getResourceWrites();
+    uint64_t bAccess = b.getResourceReads() | b.getResourceWrites();
+    return (a.getResourceWrites() & bAccess) != 0 || (b.getResourceWrites() & aAccess) != 0;
+}
+
+bool SystemManager::hasAccessConflict(const ISystem& a, const ISystem& b) {
+    if (hasResourceConflict(a, b)) {
+        return true;
+    }
+    uint64_t aAccess = a.getComponentReads() | a.getComponentWrites();
+    uint64_t bAccess = b.getComponentReads() | b.getComponentWrites();
+    return (a.getComponentWrites() & bAccess) != 0 || (b.getComponentWrites() & aAccess) != 0;
+}
+
+const char* SystemManager::getPhaseName(SystemPhase phase) {
+    switch (phase) {
+        case SystemPhase::Input: return "Input";
+        case SystemPhase::Simulation: return "Simulation";
+        case SystemPhase::PostSimulation: return "PostSimulation";
+        case SystemPhase::RenderPrep: return "RenderPrep";
+        case SystemPhase::Render: return "Render";
+        default: return "Unknown";
+    }
+}
+
 // getEntityManager() method removed - EntityManager now passed as parameter
 
 void SystemManager::sortSystemsIfNeeded() {
     if (systemsNeedSorting) {
-        std::sort(systems.begin(), systems.end(),
-                  [](const std::unique_ptr<ISystem>& a, const std::unique_ptr<ISystem>& b) {
-                      return a->getPriority() < b->getPriority();
-                  });
+        // Stable, so equal phase and priority keep registration order
+        std::stable_sort(systems.begin(), systems.end(),
+                         [](const std::unique_ptr<ISystem>& a, const std::unique_ptr<ISystem>& b) {
+                             if (a->getPhase() != b->getPhase()) {
+                                 return a->getPhase() < b->getPhase();
+                             }
+                             return a->getPriority() < b->getPriority();
+                         });
         systemsNeedSorting = false;
+        refreshSystemViews();
+    }
+}
+
+void SystemManager::refreshSystemViews() {
+    budgeted.resize(systems.size());
+    systemZones.assign(systems.size(), 0);
+    phases.resize(systems.size());
+    parallelSafe.resize(systems.size());
+    for (size_t i = 0; i < systems.size(); ++i) {
+        budgeted[i] = dynamic_cast<BudgetedSystem*>(systems[i].get());
+        phases[i] = systems[i]->getPhase();
+        parallelSafe[i] = systems[i]->canRunInParallel() && !budgeted[i];
+        if (profiler) {
+            // Keyed by instance, so re-registering after a re-sort finds the same zone
+            systemZones[i] = profiler->registerZone(systems[i]->getName(), systems[i].get());
+        }
     }
 }
 
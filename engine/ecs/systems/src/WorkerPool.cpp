@@ -0,0 +1,84 @@
+#include "../include/WorkerPool.hpp"
+
+namespace ECS {
+
+WorkerPool::WorkerPool(size_t workerCount) {
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back(&WorkerPool::workerLoop, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    jobReady.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t WorkerPool::getWorkerCount() const {
+    return workers.size();
+}
+
+void WorkerPool::run(size_t count, JobThunk thunk, void* context) {
+    if (count == 0) {
+        return;
+    }
+    if (workers.empty() || count == 1) {
+        for (size_t i = 0; i < count; ++i) {
+            thunk(context, i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobThunk = thunk;
+        jobContext = context;
+        jobCount = count;
+        nextIndex.store(0, std::memory_order_relaxed);
+        activeWorkers = workers.size();
+        generation++;
+    }
+    jobReady.notify_all();
+
+    drainJob();
+
+    // Every worker must leave the job before its state can be reused
+    std::unique_lock<std::mutex> lock(mutex);
+    jobDone.wait(lock, [this] { return activeWorkers == 0; });
+}
+
+void WorkerPool::workerLoop() {
+    uint64_t seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobReady.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) {
+                return;
+            }
+            seenGeneration = generation;
+        }
+
+        drainJob();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--activeWorkers == 0) {
+            jobDone.notify_one();
+        }
+    }
+}
+
+void WorkerPool::drainJob() {
+    size_t index;
+    while ((index = nextIndex.fetch_add(1, std::memory_order_relaxed)) < jobCount) {
+        jobThunk(jobContext, index);
+    }
+}
+
+} // namespace ECS
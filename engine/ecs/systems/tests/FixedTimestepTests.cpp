@@ -0,0 +1,58 @@
+#include "../include/FixedTimestep.hpp"
+#include <gtest/gtest.h>
+
+using namespace ECS;
+
+// Test steps are released only once a full step has accumulated
+TEST(FixedTimestepTest, AccumulatesToWholeSteps) {
+    FixedTimestep timestep(0.01f, 5);
+    
+    EXPECT_EQ(timestep.advance(0.004f), 0u);
+    EXPECT_NEAR(timestep.getAlpha(), 0.4f, 1e-4f);
+    
+    EXPECT_EQ(timestep.advance(0.008f), 1u);
+    EXPECT_NEAR(timestep.getAlpha(), 0.2f, 1e-4f);
+    
+    EXPECT_EQ(timestep.advance(0.025f), 2u);
+    EXPECT_EQ(timestep.getTickCount(), 3u);
+}
+
+// Test simulation rate is independent of render frame rate
+TEST(FixedTimestepTest, FrameRateIndependent) {
+    FixedTimestep slow(1.0f / 60.0f);
+    FixedTimestep fast(1.0f / 60.0f);
+    
+    // One second at 30 FPS vs 144 FPS
+    for (int i = 0; i < 30; ++i) {
+        slow.advance(1.0f / 30.0f);
+    }
+    for (int i = 0; i < 144; ++i) {
+        fast.advance(1.0f / 144.0f);
+    }
+    EXPECT_NEAR(static_cast<double>(slow.getTickCount()), 60.0, 1.0);
+    EXPECT_NEAR(static_cast<double>(fast.getTickCount()), 60.0, 1.0);
+}
+
+// Test catch-up limit and stall clamping
+TEST(FixedTimestepTest, MaxCatchUp) {
+    FixedTimestep timestep(0.01f, 3);
+    
+    uint32_t calls = 0;
+    uint32_t steps = timestep.run(0.1f, [&calls](float step) {
+        EXPECT_FLOAT_EQ(step, 0.01f);
+        calls++;
+    });
+    EXPECT_EQ(steps, 3u);
+    EXPECT_EQ(calls, 3u);
+    EXPECT_GE(timestep.getDroppedSteps(), 6u);
+    EXPECT_LT(timestep.getAlpha(), 1.0f);
+    
+    // A multi-second stall is clamped, still bounded by the catch-up limit
+    EXPECT_EQ(timestep.advance(10.0f), 3u);
+    EXPECT_EQ(timestep.advance(-1.0f), 0u);
+    
+    timestep.reset();
+    EXPECT_EQ(timestep.getTickCount(), 0u);
+    EXPECT_EQ(timestep.getDroppedSteps(), 0u);
+    EXPECT_FLOAT_EQ(timestep.getAlpha(), 0.0f);
+}
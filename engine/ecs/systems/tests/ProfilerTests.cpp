@@ -0,0 +1,167 @@
+#include "../../include/EntityManager.hpp"
+#include "../include/Profiler.hpp"
+#include "../include/SystemManager.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+
+using namespace ECS;
+
+// Named system that opens a scoped zone while updating
+class ProfiledSystem : public ISystem {
+private:
+    const char* name;
+    uint64_t required;
+
+public:
+    ProfiledSystem(const char* systemName, uint64_t requiredMask)
+        : name(systemName), required(requiredMask) {}
+
+    void update(float deltaTime, EntityManager& entityManager) override {
+        (void)deltaTime;
+        (void)entityManager;
+        ECS_PROFILE_ZONE("ProfiledSystem::inner");
+    }
+
+    uint64_t getRequiredComponents() const override { return required; }
+    const char* getName() const override { return name; }
+};
+
+// Test last/min/max and rolling percentiles from known durations
+TEST(ProfilerTest, ZoneStatistics) {
+    Profiler profiler;
+    ZoneID zone = profiler.registerZone("Synthetic");
+    EXPECT_EQ(profiler.registerZone("Synthetic"), zone);
+
+    Profiler::Clock::time_point origin;
+    for (int ms = 1; ms <= 100; ++ms) {
+        profiler.record(zone, origin, origin + std::chrono::milliseconds(ms), static_cast<size_t>(ms));
+    }
+
+    ZoneStats stats = profiler.getStats(zone);
+    EXPECT_EQ(stats.samples, 100u);
+    EXPECT_DOUBLE_EQ(stats.last, 0.100);
+    EXPECT_DOUBLE_EQ(stats.min, 0.001);
+    EXPECT_DOUBLE_EQ(stats.max, 0.100);
+    EXPECT_DOUBLE_EQ(stats.p50, 0.050);
+    EXPECT_DOUBLE_EQ(stats.p95, 0.095);
+    EXPECT_DOUBLE_EQ(stats.p99, 0.099);
+    EXPECT_EQ(stats.lastEntityCount, 100u);
+
+    // Window rolls: old samples leave the percentiles, not min/max
+    for (size_t i = 0; i < Profiler::HISTORY; ++i) {
+        profiler.record(zone, origin, origin + std::chrono::milliseconds(2));
+    }
+    stats = profiler.getStats("Synthetic");
+    EXPECT_DOUBLE_EQ(stats.p99, 0.002);
+    EXPECT_DOUBLE_EQ(stats.max, 0.100);
+
+    profiler.reset();
+    EXPECT_EQ(profiler.getStats(zone).samples, 0u);
+    EXPECT_EQ(profiler.getStats("Missing").samples, 0u);
+}
+
+// Test SystemManager records per-system samples, entity counts and inner zones
+TEST(ProfilerTest, SystemManagerIntegration) {
+    EntityManager entityManager;
+    for (int i = 0; i < 5; ++i) {
+        Entity entity = entityManager.createEntity();
+        entityManager.getEntityByID(entity.id)->addComponent(i < 3 ? 0b11 : 0b01);
+    }
+
+    Profiler profiler;
+    SystemManager systemManager;
+    systemManager.registerSystem(std::make_unique<ProfiledSystem>("Movement", 0b11));
+    systemManager.registerSystem(std::make_unique<ProfiledSystem>("Input", 0b01));
+    systemManager.setProfiler(&profiler);
+    EXPECT_EQ(systemManager.getProfiler(), &profiler);
+
+    for (int frame = 0; frame < 3; ++frame) {
+        systemManager.updateAll(0.016f, entityManager);
+    }
+    EXPECT_EQ(Profiler::getCurrent(), nullptr); // Only installed during updateAll
+
+    EXPECT_EQ(profiler.getStats("Movement").samples, 3u);
+    EXPECT_EQ(profiler.getStats("Movement").lastEntityCount, 3u);
+    EXPECT_EQ(profiler.getStats("Input").lastEntityCount, 5u);
+    EXPECT_EQ(profiler.getStats("ProfiledSystem::inner").samples, 6u);
+    EXPECT_EQ(profiler.getStats("SystemManager::updateAll").samples, 3u);
+    EXPECT_GE(profiler.getStats("SystemManager::updateAll").last, profiler.getStats("Movement").last);
+
+    // Zones persist across detach/attach
+    size_t zoneCount = profiler.getZoneCount();
+    systemManager.setProfiler(nullptr);
+    systemManager.updateAll(0.016f, entityManager);
+    systemManager.setProfiler(&profiler);
+    EXPECT_EQ(profiler.getZoneCount(), zoneCount);
+    EXPECT_EQ(profiler.getStats("Movement").samples, 3u);
+}
+
+// Test Chrome trace-event export and the capture cap
+TEST(ProfilerTest, ChromeTraceExport) {
+    Profiler profiler;
+    ZoneID quoted = profiler.registerZone("Say \"hi\"");
+    Profiler::Clock::time_point origin = Profiler::Clock::now();
+
+    profiler.record(quoted, origin, origin + std::chrono::microseconds(5)); // Not capturing yet
+    profiler.beginCapture(2);
+    EXPECT_TRUE(profiler.isCapturing());
+    {
+        Profiler::setCurrent(&profiler);
+        ECS_PROFILE_ZONE("Scoped");
+        Profiler::setCurrent(nullptr);
+    }
+    profiler.record(quoted, origin, origin + std::chrono::microseconds(250));
+    profiler.record(quoted, origin, origin + std::chrono::microseconds(1)); // Over the cap
+    profiler.endCapture();
+
+    EXPECT_EQ(profiler.getCapturedEventCount(), 2u);
+    EXPECT_EQ(profiler.getDroppedEventCount(), 1u);
+
+    std::ostringstream out;
+    ASSERT_TRUE(profiler.writeChromeTrace(out));
+    std::string json = out.str();
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\"name\":\"Scoped\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Say \\\"hi\\\"\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"dur\":250.000"), std::string::npos);
+
+    std::ostringstream summary;
+    profiler.writeSummary(summary);
+    EXPECT_NE(summary.str().find("Scoped"), std::string::npos);
+}
+
+// Test that a call site resolves its zone once per profiler
+TEST(ProfilerTest, ZoneSitesCachePerProfiler) {
+    auto timedScope = []() {
+        ECS_PROFILE_ZONE("CachedSite");
+    };
+    Profiler first;
+    Profiler second;
+    first.registerZone("Other");
+    EXPECT_NE(first.getSerial(), second.getSerial());
+
+    for (Profiler* profiler : {&first, &second, &first}) {
+        Profiler::setCurrent(profiler);
+        timedScope();
+        timedScope();
+    }
+    Profiler::setCurrent(nullptr);
+    timedScope();
+
+    EXPECT_EQ(first.getZoneCount(), 2u);
+    EXPECT_EQ(second.getZoneCount(), 1u);
+    EXPECT_EQ(first.getStats("CachedSite").samples, 4u);
+    EXPECT_EQ(second.getStats("CachedSite").samples, 2u);
+
+    // Pre-registered IDs skip the site cache entirely
+    ZoneID zone = second.registerZone("Direct");
+    {
+        ScopedZone scoped(&second, zone);
+    }
+    {
+        ScopedZone disabled(nullptr, zone);
+    }
+    EXPECT_EQ(second.getStats(zone).samples, 1u);
+}
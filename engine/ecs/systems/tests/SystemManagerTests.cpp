@@ -1,9 +1,15 @@
 #include "../../include/EntityManager.hpp"
 #include "../include/ISystem.hpp"
 #include "../include/SystemManager.hpp"
+#include "../include/BudgetedSystem.hpp"
+#include "../include/WorkerPool.hpp"
+#include "../include/SystemUtils.hpp"
 #include <gtest/gtest.h>
 #include <vector>
 #include <memory>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 using namespace ECS;
 
@@ -322,4 +328,225 @@ TEST_F(SystemManagerTest, MultipleEntityManagerSupport) {
     EXPECT_EQ(systemPtr->getLastEntityManager(), &secondEntityManager);
     EXPECT_EQ(systemPtr->getUpdateCallCount(), 2); // Called twice
     EXPECT_FLOAT_EQ(systemPtr->getLastDeltaTime(), 0.032f); // Last delta time
-}
\ No newline at end of file
+}
+
+// Resource types for dependency testing
+struct SchedCamera { float x = 0.0f; };
+struct SchedTurn { int turn = 0; };
+
+// System with configurable resource access
+class ResourceSystem : public MockSystem {
+private:
+    uint64_t reads;
+    uint64_t writes;
+
+public:
+    ResourceSystem(uint64_t readMask, uint64_t writeMask)
+        : MockSystem(0), reads(readMask), writes(writeMask) {}
+
+    uint64_t getResourceReads() const override { return reads; }
+    uint64_t getResourceWrites() const override { return writes; }
+};
+
+// Test resource read/write conflict detection
+TEST_F(SystemManagerTest, ResourceConflicts) {
+    uint64_t camera = SystemUtils::getResourceMask<SchedCamera>();
+    uint64_t turn = SystemUtils::getResourceMask<SchedTurn>();
+    uint64_t both = SystemUtils::getResourceMask<SchedCamera, SchedTurn>();
+    EXPECT_EQ(both, camera | turn);
+
+    ResourceSystem readerA(camera, 0);
+    ResourceSystem readerB(camera, 0);
+    ResourceSystem writer(0, camera);
+    ResourceSystem otherWriter(0, turn);
+
+    EXPECT_FALSE(SystemManager::hasResourceConflict(readerA, readerB)); // Shared reads are fine
+    EXPECT_TRUE(SystemManager::hasResourceConflict(readerA, writer));   // Read vs write
+    EXPECT_TRUE(SystemManager::hasResourceConflict(writer, readerB));   // Symmetric
+    EXPECT_TRUE(SystemManager::hasResourceConflict(writer, writer));    // Write vs write
+    EXPECT_FALSE(SystemManager::hasResourceConflict(writer, otherWriter)); // Disjoint resources
+}
+
+// Budgeted system that walks a fixed item count, one item per expiry check
+class ChunkedSystem : public BudgetedSystem {
+private:
+    size_t itemCount;
+    size_t cursor = 0;
+    float weight;
+
+public:
+    int completedPasses = 0;
+    int sliceCalls = 0;
+    std::vector<double> sliceSeconds;
+
+    ChunkedSystem(size_t items, float budgetWeight = 1.0f)
+        : itemCount(items), weight(budgetWeight) {}
+
+    bool updateSlice(float deltaTime, EntityManager& entityManager, const TimeSlice& slice) override {
+        (void)deltaTime;
+        (void)entityManager;
+        sliceCalls++;
+        sliceSeconds.push_back(slice.getSeconds());
+        do {
+            cursor++;
+        } while (cursor < itemCount && !slice.expired());
+
+        if (cursor < itemCount) {
+            return false;
+        }
+        cursor = 0;
+        completedPasses++;
+        return true;
+    }
+
+    uint64_t getRequiredComponents() const override { return 0; }
+    float getBudgetWeight() const override { return weight; }
+    size_t getCursor() const { return cursor; }
+};
+
+// Test budgeted systems resume across frames and run whole passes without a budget
+TEST_F(SystemManagerTest, BudgetedSystemResumesAcrossFrames) {
+    auto chunked = std::make_unique<ChunkedSystem>(10);
+    ChunkedSystem* chunkedPtr = chunked.get();
+    systemManager->registerSystem(std::move(chunked));
+
+    // No budget: whole pass in one frame
+    systemManager->updateAll(0.016f, *entityManager);
+    EXPECT_EQ(chunkedPtr->completedPasses, 1);
+
+    // Vanishing budget: one item per frame, progress kept between frames
+    systemManager->setFrameBudget(1e-12, 0.0);
+    for (int frame = 1; frame < 10; ++frame) {
+        systemManager->updateAll(0.016f, *entityManager);
+        EXPECT_EQ(chunkedPtr->getCursor(), static_cast<size_t>(frame));
+    }
+    systemManager->updateAll(0.016f, *entityManager);
+    EXPECT_EQ(chunkedPtr->completedPasses, 2);
+    EXPECT_EQ(chunkedPtr->sliceCalls, 11);
+}
+
+// Test the frame budget is split by weight with a minimum slice
+TEST_F(SystemManagerTest, FrameBudgetSplitByWeight) {
+    auto heavy = std::make_unique<ChunkedSystem>(1, 3.0f);
+    auto light = std::make_unique<ChunkedSystem>(1, 1.0f);
+    auto plain = std::make_unique<MockSystem>(0, 500);
+    ChunkedSystem* heavyPtr = heavy.get();
+    ChunkedSystem* lightPtr = light.get();
+    MockSystem* plainPtr = plain.get();
+    systemManager->registerSystem(std::move(heavy));
+    systemManager->registerSystem(std::move(light));
+    systemManager->registerSystem(std::move(plain));
+
+    systemManager->setFrameBudget(1.0);
+    EXPECT_DOUBLE_EQ(systemManager->getFrameBudget(), 1.0);
+    systemManager->updateAll(0.016f, *entityManager);
+    EXPECT_EQ(plainPtr->getUpdateCallCount(), 1);
+    ASSERT_EQ(heavyPtr->sliceSeconds.size(), 1u);
+    ASSERT_EQ(lightPtr->sliceSeconds.size(), 1u);
+    EXPECT_LE(heavyPtr->sliceSeconds[0], 0.75);
+    EXPECT_GT(heavyPtr->sliceSeconds[0], 0.7);
+    EXPECT_GT(lightPtr->sliceSeconds[0], 0.2); // Its quarter plus heavy's unused time
+    EXPECT_LE(lightPtr->sliceSeconds[0], 1.0);
+
+    // An exhausted budget still grants the minimum slice
+    systemManager->setFrameBudget(1e-12, 0.01);
+    systemManager->updateAll(0.016f, *entityManager);
+    EXPECT_DOUBLE_EQ(heavyPtr->sliceSeconds[1], 0.01);
+    EXPECT_DOUBLE_EQ(lightPtr->sliceSeconds[1], 0.01);
+}
+
+// System with a configurable phase that records a global sequence number
+class PhasedSystem : public ISystem {
+private:
+    SystemPhase phase;
+    int priority;
+    uint64_t writes;
+    bool parallel;
+    std::atomic<int>* sequence;
+    std::atomic<int>* rendezvous;
+
+public:
+    int ranAt = -1;
+    bool sawPartner = false;
+
+    PhasedSystem(SystemPhase systemPhase, int prio, std::atomic<int>* counter,
+                 uint64_t writeMask = 0, bool allowParallel = false, std::atomic<int>* meet = nullptr)
+        : phase(systemPhase), priority(prio), writes(writeMask), parallel(allowParallel),
+          sequence(counter), rendezvous(meet) {}
+
+    void update(float deltaTime, EntityManager& entityManager) override {
+        (void)deltaTime;
+        (void)entityManager;
+        ranAt = sequence->fetch_add(1);
+        if (rendezvous) {
+            // Wait (bounded) for the batch partner: only succeeds if both run concurrently
+            rendezvous->fetch_add(1);
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            while (rendezvous->load() < 2 && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+            sawPartner = rendezvous->load() >= 2;
+        }
+    }
+
+    uint64_t getRequiredComponents() const override { return 0; }
+    uint64_t getComponentWrites() const override { return writes; }
+    int getPriority() const override { return priority; }
+    SystemPhase getPhase() const override { return phase; }
+    bool canRunInParallel() const override { return parallel; }
+};
+
+// Test phases run in order regardless of priority
+TEST_F(SystemManagerTest, PhaseOrdering) {
+    std::atomic<int> sequence{0};
+    auto render = std::make_unique<PhasedSystem>(SystemPhase::Render, 0, &sequence);
+    auto simulation = std::make_unique<PhasedSystem>(SystemPhase::Simulation, 5000, &sequence);
+    auto input = std::make_unique<PhasedSystem>(SystemPhase::Input, 9000, &sequence);
+    auto renderPrep = std::make_unique<PhasedSystem>(SystemPhase::RenderPrep, 1, &sequence);
+    auto postSim = std::make_unique<PhasedSystem>(SystemPhase::PostSimulation, 2, &sequence);
+    PhasedSystem* ptrs[] = {input.get(), simulation.get(), postSim.get(), renderPrep.get(), render.get()};
+
+    systemManager->registerSystem(std::move(render));
+    systemManager->registerSystem(std::move(simulation));
+    systemManager->registerSystem(std::move(input));
+    systemManager->registerSystem(std::move(renderPrep));
+    systemManager->registerSystem(std::move(postSim));
+    systemManager->updateAll(0.016f, *entityManager);
+
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(ptrs[i]->ranAt, i);
+    }
+    EXPECT_STREQ(SystemManager::getPhaseName(SystemPhase::PostSimulation), "PostSimulation");
+}
+
+// Test non-conflicting opt-in systems of one phase share a parallel batch
+TEST_F(SystemManagerTest, ParallelBatchesWithinPhase) {
+    WorkerPool pool(2);
+    systemManager->setWorkerPool(&pool);
+    EXPECT_EQ(systemManager->getWorkerPool(), &pool);
+
+    std::atomic<int> sequence{0};
+    std::atomic<int> rendezvous{0};
+    auto a = std::make_unique<PhasedSystem>(SystemPhase::Simulation, 10, &sequence, 0b001, true, &rendezvous);
+    auto b = std::make_unique<PhasedSystem>(SystemPhase::Simulation, 20, &sequence, 0b010, true, &rendezvous);
+    auto conflicting = std::make_unique<PhasedSystem>(SystemPhase::Simulation, 30, &sequence, 0b001, true);
+    auto nextPhase = std::make_unique<PhasedSystem>(SystemPhase::PostSimulation, 0, &sequence, 0b100, true);
+    PhasedSystem* aPtr = a.get();
+    PhasedSystem* bPtr = b.get();
+    PhasedSystem* conflictingPtr = conflicting.get();
+    PhasedSystem* nextPtr = nextPhase.get();
+
+    EXPECT_FALSE(SystemManager::hasAccessConflict(*aPtr, *bPtr));
+    EXPECT_TRUE(SystemManager::hasAccessConflict(*aPtr, *conflictingPtr));
+
+    systemManager->registerSystem(std::move(nextPhase));
+    systemManager->registerSystem(std::move(conflicting));
+    systemManager->registerSystem(std::move(b));
+    systemManager->registerSystem(std::move(a));
+    systemManager->updateAll(0.016f, *entityManager);
+
+    EXPECT_TRUE(aPtr->sawPartner);
+    EXPECT_TRUE(bPtr->sawPartner);
+    EXPECT_EQ(conflictingPtr->ranAt, 2); // Waits for the batch it conflicts with
+    EXPECT_EQ(nextPtr->ranAt, 3);        // Phases never overlap
+}
@@ -0,0 +1,33 @@
+#include "../include/WorkerPool.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+
+using namespace ECS;
+
+// Test every index runs exactly once, across repeated jobs
+TEST(WorkerPoolTest, ParallelForCoversEveryIndex) {
+    WorkerPool pool(3);
+    EXPECT_EQ(pool.getWorkerCount(), 3u);
+
+    for (int job = 0; job < 50; ++job) {
+        std::vector<std::atomic<int>> hits(257);
+        pool.parallelFor(hits.size(), [&](size_t index) {
+            hits[index].fetch_add(1, std::memory_order_relaxed);
+        });
+        for (const auto& hit : hits) {
+            ASSERT_EQ(hit.load(), 1);
+        }
+    }
+}
+
+// Test a pool without workers runs jobs on the caller, in order
+TEST(WorkerPoolTest, NoWorkersRunsSerially) {
+    WorkerPool pool(0);
+    std::vector<size_t> order;
+    pool.parallelFor(5, [&](size_t index) { order.push_back(index); });
+    EXPECT_EQ(order, (std::vector<size_t>{0, 1, 2, 3, 4}));
+
+    pool.parallelFor(0, [&](size_t index) { order.push_back(index); });
+    EXPECT_EQ(order.size(), 5u);
+}
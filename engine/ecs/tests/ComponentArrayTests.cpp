@@ -492,3 +492,110 @@ TEST_F(ComponentArrayEntityManagerIntegrationTest,
   EXPECT_FALSE(storedEntity->hasComponent(positionBit))
       << "Stored entity should have component bit cleared after removal";
 }
+
+// Observer that records batch calls for change tracking tests
+class RecordingObserver : public ComponentObserver {
+public:
+  void onComponentsAdded(const EntityID *ids, size_t count) override {
+    addedCalls++;
+    added.insert(added.end(), ids, ids + count);
+  }
+  void onComponentsRemoved(const EntityID *ids, size_t count) override {
+    removedCalls++;
+    removed.insert(removed.end(), ids, ids + count);
+  }
+  void onComponentsChanged(const EntityID *ids, size_t count) override {
+    changedCalls++;
+    changed.insert(changed.end(), ids, ids + count);
+  }
+
+  int addedCalls = 0, removedCalls = 0, changedCalls = 0;
+  std::vector<EntityID> added, removed, changed;
+};
+
+// Test change tracking is off by default and records nothing
+TEST_F(ComponentArrayTest, ChangeTrackingDisabledByDefault) {
+  ComponentArray<Position> positions;
+  positions.add(entity1.id, {1.0f, 2.0f, 3.0f}, positionBit, *entityManager);
+  positions.markChanged(entity1.id);
+  positions.remove(entity1.id, positionBit, *entityManager);
+
+  EXPECT_FALSE(positions.isChangeTrackingEnabled());
+  EXPECT_TRUE(positions.getChanges().empty());
+}
+
+// Test added/removed/changed lists are recorded in order
+TEST_F(ComponentArrayTest, ChangeTrackingRecordsLifecycle) {
+  ComponentArray<Position> positions;
+  positions.setChangeTracking(true);
+
+  positions.add(entity1.id, {1.0f, 0.0f, 0.0f}, positionBit, *entityManager);
+  positions.add(entity2.id, {2.0f, 0.0f, 0.0f}, positionBit, *entityManager);
+  positions.add(entity1.id, {5.0f, 0.0f, 0.0f}, positionBit, *entityManager); // Overwrite
+  positions.remove(entity2.id, positionBit, *entityManager);
+
+  const ComponentChanges &changes = positions.getChanges();
+  EXPECT_EQ(changes.added, (std::vector<EntityID>{entity1.id, entity2.id}));
+  EXPECT_EQ(changes.removed, (std::vector<EntityID>{entity2.id}));
+  EXPECT_EQ(changes.changed, (std::vector<EntityID>{entity1.id}));
+
+  positions.clearChanges();
+  EXPECT_TRUE(positions.getChanges().empty());
+}
+
+// Test markChanged deduplicates within a batch and resets after clear
+TEST_F(ComponentArrayTest, MarkChangedDeduplicates) {
+  ComponentArray<Position> positions;
+  positions.add(entity1.id, {}, positionBit, *entityManager);
+  positions.add(entity2.id, {}, positionBit, *entityManager);
+  positions.add(entity3.id, {}, positionBit, *entityManager);
+  positions.setChangeTracking(true);
+
+  positions.get(entity1.id)->x = 1.0f;
+  positions.markChanged(entity1.id);
+  positions.markChanged(entity1.id);
+  positions.markChanged(entity3.id);
+  positions.markChanged(999); // Unknown entity ignored
+
+  // Swap-remove moves entity3 into entity1's slot; its flag must follow
+  positions.remove(entity1.id, positionBit, *entityManager);
+  positions.markChanged(entity3.id);
+
+  EXPECT_EQ(positions.getChanges().changed,
+            (std::vector<EntityID>{entity1.id, entity3.id}));
+
+  positions.clearChanges();
+  positions.markChanged(entity3.id);
+  EXPECT_EQ(positions.getChanges().changed,
+            (std::vector<EntityID>{entity3.id}));
+}
+
+// Test observers receive one call per list per dispatch
+TEST_F(ComponentArrayTest, ObserversReceiveBatches) {
+  ComponentArray<Position> positions;
+  RecordingObserver observer;
+  positions.addObserver(&observer);
+  EXPECT_TRUE(positions.isChangeTrackingEnabled());
+  EXPECT_EQ(positions.getObserverCount(), 1u);
+
+  positions.add(entity1.id, {}, positionBit, *entityManager);
+  positions.add(entity2.id, {}, positionBit, *entityManager);
+  positions.add(entity3.id, {}, positionBit, *entityManager);
+  positions.dispatchChanges();
+
+  EXPECT_EQ(observer.addedCalls, 1);
+  EXPECT_EQ(observer.added.size(), 3u);
+  EXPECT_EQ(observer.removedCalls, 0);
+  EXPECT_EQ(observer.changedCalls, 0);
+  EXPECT_TRUE(positions.getChanges().empty());
+
+  positions.clear();
+  positions.dispatchChanges();
+  EXPECT_EQ(observer.removedCalls, 1);
+  EXPECT_EQ(observer.removed.size(), 3u);
+
+  positions.removeObserver(&observer);
+  positions.add(entity1.id, {}, positionBit, *entityManager);
+  positions.dispatchChanges();
+  EXPECT_EQ(observer.addedCalls, 1);
+}
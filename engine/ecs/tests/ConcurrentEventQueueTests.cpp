@@ -0,0 +1,94 @@
+#include "../include/ConcurrentEventQueue.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace ECS;
+
+// Test payload type
+struct HitPayload {
+    int job = 0;
+    int sequence = 0;
+
+    bool operator==(const HitPayload& other) const {
+        return job == other.job && sequence == other.sequence;
+    }
+};
+
+// Test basic push and drain from a single thread
+TEST(ConcurrentEventQueueTest, PushAndDrain) {
+    ConcurrentEventQueue<HitPayload> queue(2);
+    EXPECT_EQ(queue.getProducerCount(), 2u);
+    EXPECT_TRUE(queue.empty());
+
+    queue.push(1, 10, HitPayload{1, 0});
+    queue.push(0, 20, HitPayload{0, 0});
+    queue.push(1, HitPayload{1, 1});
+    EXPECT_EQ(queue.size(), 3u);
+
+    EventQueue<HitPayload> target;
+    EXPECT_EQ(queue.drainInto(target), 3u);
+    EXPECT_TRUE(queue.empty());
+
+    // Slot order first, then push order
+    const auto& events = target.peek();
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_EQ(events[0].source, 20u);
+    EXPECT_EQ(events[1].payload, (HitPayload{1, 0}));
+    EXPECT_EQ(events[2].source, INVALID_ENTITY);
+}
+
+// Test callback drain and clear
+TEST(ConcurrentEventQueueTest, DrainWithCallback) {
+    ConcurrentEventQueue<HitPayload> queue(3);
+    queue.push(2, 1, HitPayload{2, 0});
+    queue.push(0, 2, HitPayload{0, 0});
+
+    std::vector<EntityID> sources;
+    size_t processed = queue.drain([&](const Event<HitPayload>& event) {
+        sources.push_back(event.source);
+    });
+
+    EXPECT_EQ(processed, 2u);
+    EXPECT_EQ(sources, (std::vector<EntityID>{2, 1}));
+
+    queue.push(1, 3, HitPayload{});
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+}
+
+// Test concurrent producers drain in a deterministic order
+TEST(ConcurrentEventQueueTest, ConcurrentProducersDeterministicOrder) {
+    constexpr int jobCount = 4;
+    constexpr int eventsPerJob = 5000;
+
+    for (int run = 0; run < 3; ++run) {
+        ConcurrentEventQueue<HitPayload> queue(jobCount);
+        std::vector<std::thread> workers;
+        for (int job = 0; job < jobCount; ++job) {
+            workers.emplace_back([&queue, job]() {
+                for (int i = 0; i < eventsPerJob; ++i) {
+                    queue.push(static_cast<size_t>(job), static_cast<EntityID>(job + 1), HitPayload{job, i});
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        ASSERT_EQ(queue.size(), static_cast<size_t>(jobCount * eventsPerJob));
+
+        int expectedJob = 0;
+        int expectedSequence = 0;
+        bool ordered = true;
+        queue.drain([&](const Event<HitPayload>& event) {
+            ordered = ordered && event.payload.job == expectedJob && event.payload.sequence == expectedSequence;
+            if (++expectedSequence == eventsPerJob) {
+                expectedSequence = 0;
+                expectedJob++;
+            }
+        });
+        EXPECT_TRUE(ordered);
+        EXPECT_EQ(expectedJob, jobCount);
+    }
+}
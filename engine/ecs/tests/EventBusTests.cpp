@@ -0,0 +1,154 @@
+#include "../include/EventBus.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace ECS;
+
+// Test payload types
+struct BusMovePayload {
+    int dx = 0;
+    int dy = 0;
+};
+
+struct BusSoundPayload {
+    int soundId = 0;
+};
+
+// Subscriber recording each batch it receives
+class MoveListener {
+public:
+    void onMoves(EventView<BusMovePayload> events) {
+        batches++;
+        for (const auto& event : events) {
+            sources.push_back(event.source);
+        }
+    }
+
+    int batches = 0;
+    std::vector<EntityID> sources;
+};
+
+// Subscriber that reacts to moves by emitting sounds
+struct SoundEmitter {
+    EventBus* bus = nullptr;
+
+    void onMoves(EventView<BusMovePayload> events) {
+        for (const auto& event : events) {
+            bus->push<BusSoundPayload>(event.source, BusSoundPayload{1});
+        }
+    }
+};
+
+static void countSounds(void* context, EventView<BusSoundPayload> events) {
+    *static_cast<size_t*>(context) += events.size();
+}
+
+// Test queues are created per type on first use
+TEST(EventBusTest, QueuesPerType) {
+    EventBus bus;
+    EXPECT_EQ(bus.findQueue<BusMovePayload>(), nullptr);
+
+    bus.push<BusMovePayload>(1, BusMovePayload{1, 0});
+    bus.push(BusSoundPayload{3});
+
+    ASSERT_NE(bus.findQueue<BusMovePayload>(), nullptr);
+    EXPECT_EQ(&bus.getQueue<BusMovePayload>(), bus.findQueue<BusMovePayload>());
+    EXPECT_EQ(bus.getQueue<BusMovePayload>().size(), 1u);
+    EXPECT_EQ(bus.getQueue<BusSoundPayload>().size(), 1u);
+    EXPECT_EQ(bus.getQueueCount(), 2u);
+}
+
+// Test each subscriber receives one batch per dispatch
+TEST(EventBusTest, BatchedDispatch) {
+    EventBus bus;
+    MoveListener first;
+    MoveListener second;
+    bus.subscribe<BusMovePayload, MoveListener, &MoveListener::onMoves>(&first);
+    bus.subscribe<BusMovePayload, MoveListener, &MoveListener::onMoves>(&second);
+    EXPECT_EQ(bus.getSubscriberCount<BusMovePayload>(), 2u);
+
+    for (EntityID id = 1; id <= 5; ++id) {
+        bus.push<BusMovePayload>(id, BusMovePayload{1, 0});
+    }
+
+    EXPECT_EQ(bus.dispatch(), 5u);
+    EXPECT_EQ(first.batches, 1);
+    EXPECT_EQ(second.batches, 1);
+    EXPECT_EQ(first.sources, (std::vector<EntityID>{1, 2, 3, 4, 5}));
+
+    // Nothing pending: subscribers are not called
+    EXPECT_EQ(bus.dispatch(), 0u);
+    EXPECT_EQ(first.batches, 1);
+}
+
+// Test events pushed by handlers are delivered on the next dispatch
+TEST(EventBusTest, ChainedEventsDeferred) {
+    EventBus bus;
+    SoundEmitter emitter{&bus};
+    size_t soundCount = 0;
+
+    bus.subscribe<BusSoundPayload>(&countSounds, &soundCount);
+    bus.subscribe<BusMovePayload, SoundEmitter, &SoundEmitter::onMoves>(&emitter);
+
+    bus.push<BusMovePayload>(7, BusMovePayload{0, 1});
+    bus.push<BusMovePayload>(8, BusMovePayload{0, 1});
+
+    bus.dispatch();
+    EXPECT_EQ(soundCount, 0u);
+
+    bus.dispatch();
+    EXPECT_EQ(soundCount, 2u);
+}
+
+// Test unsubscribe, including from inside a dispatch
+TEST(EventBusTest, Unsubscribe) {
+    EventBus bus;
+    MoveListener listener;
+    SubscriptionID id = bus.subscribe<BusMovePayload, MoveListener, &MoveListener::onMoves>(&listener);
+    EXPECT_NE(id, INVALID_SUBSCRIPTION);
+
+    EXPECT_TRUE(bus.unsubscribe(id));
+    EXPECT_FALSE(bus.unsubscribe(id));
+    EXPECT_EQ(bus.getSubscriberCount<BusMovePayload>(), 0u);
+
+    bus.push<BusMovePayload>(1, BusMovePayload{});
+    bus.dispatch();
+    EXPECT_EQ(listener.batches, 0);
+
+    // Self-removal during dispatch
+    struct OneShot {
+        EventBus* bus = nullptr;
+        SubscriptionID id = INVALID_SUBSCRIPTION;
+        int calls = 0;
+        void onMoves(EventView<BusMovePayload> events) {
+            (void)events; // Suppress unused parameter warning
+            calls++;
+            bus->unsubscribe(id);
+        }
+    };
+    OneShot oneShot{&bus};
+    oneShot.id = bus.subscribe<BusMovePayload, OneShot, &OneShot::onMoves>(&oneShot);
+
+    bus.push<BusMovePayload>(1, BusMovePayload{});
+    bus.dispatch();
+    bus.push<BusMovePayload>(2, BusMovePayload{});
+    bus.dispatch();
+    EXPECT_EQ(oneShot.calls, 1);
+    EXPECT_EQ(bus.getSubscriberCount<BusMovePayload>(), 0u);
+}
+
+// Test clearEvents drops pending events but keeps subscriptions
+TEST(EventBusTest, ClearEvents) {
+    EventBus bus;
+    MoveListener listener;
+    bus.subscribe<BusMovePayload, MoveListener, &MoveListener::onMoves>(&listener);
+
+    bus.push<BusMovePayload>(1, BusMovePayload{});
+    bus.clearEvents();
+    EXPECT_EQ(bus.dispatch(), 0u);
+    EXPECT_EQ(bus.getSubscriberCount<BusMovePayload>(), 1u);
+
+    bus.clear();
+    EXPECT_EQ(bus.getQueueCount(), 0u);
+    EXPECT_EQ(bus.getSubscriberCount<BusMovePayload>(), 0u);
+}
@@ -0,0 +1,151 @@
+#include "../include/EventJournal.hpp"
+#include "../systems/include/IInputManager.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+
+using namespace ECS;
+
+// Test payload types
+struct JournalMovePayload {
+    int32_t dx = 0;
+    int32_t dy = 0;
+
+    bool operator==(const JournalMovePayload& other) const {
+        return dx == other.dx && dy == other.dy;
+    }
+};
+
+struct JournalDamagePayload {
+    float amount = 0.0f;
+};
+
+class EventJournalTest : public ::testing::Test {
+protected:
+    static constexpr uint16_t MOVE_TAG = 1;
+    static constexpr uint16_t DAMAGE_TAG = 2;
+
+    void SetUp() override {
+        journal.registerQueue<JournalMovePayload>(MOVE_TAG, moves);
+        journal.registerQueue<JournalDamagePayload>(DAMAGE_TAG, damage);
+    }
+
+    // Record frames where frame N pushes N moves from entity N
+    void recordFrames(uint64_t count) {
+        for (uint64_t frame = 0; frame < count; ++frame) {
+            for (uint64_t i = 0; i < frame; ++i) {
+                moves.push(static_cast<EntityID>(frame), JournalMovePayload{static_cast<int32_t>(i), 1});
+            }
+            journal.recordFrame(frame);
+            moves.clear();
+        }
+    }
+
+    EventJournal journal{4};
+    EventQueue<JournalMovePayload> moves;
+    EventQueue<JournalDamagePayload> damage;
+};
+
+// Test recording and replaying reproduces events frame by frame
+TEST_F(EventJournalTest, RecordAndReplay) {
+    recordFrames(6);
+    EXPECT_EQ(journal.getFrameCount(), 6u);
+    EXPECT_EQ(journal.getIndex().size(), 2u); // Frames 0 and 4
+
+    EventQueue<JournalMovePayload> replayed;
+    JournalReplayer replayer(journal);
+    replayer.bindQueue<JournalMovePayload>(MOVE_TAG, replayed);
+
+    for (uint64_t frame = 0; frame < 6; ++frame) {
+        ASSERT_TRUE(replayer.replayFrame());
+        EXPECT_EQ(replayer.getCurrentFrame(), frame);
+        ASSERT_EQ(replayed.size(), frame);
+        for (uint64_t i = 0; i < frame; ++i) {
+            EXPECT_EQ(replayed.peek()[i].source, frame);
+            EXPECT_EQ(replayed.peek()[i].payload, (JournalMovePayload{static_cast<int32_t>(i), 1}));
+        }
+        replayed.clear();
+    }
+    EXPECT_FALSE(replayer.replayFrame());
+    EXPECT_TRUE(replayer.atEnd());
+}
+
+// Test seek jumps to a frame through the index
+TEST_F(EventJournalTest, SeekToFrame) {
+    recordFrames(10);
+
+    EventQueue<JournalMovePayload> replayed;
+    JournalReplayer replayer(journal);
+    replayer.bindQueue<JournalMovePayload>(MOVE_TAG, replayed);
+
+    ASSERT_TRUE(replayer.seek(7));
+    ASSERT_TRUE(replayer.replayFrame());
+    EXPECT_EQ(replayer.getCurrentFrame(), 7u);
+    EXPECT_EQ(replayed.size(), 7u);
+
+    // Seeking backwards works too
+    replayed.clear();
+    ASSERT_TRUE(replayer.seek(2));
+    ASSERT_TRUE(replayer.replayFrame());
+    EXPECT_EQ(replayer.getCurrentFrame(), 2u);
+    EXPECT_EQ(replayed.size(), 2u);
+
+    EXPECT_FALSE(replayer.seek(100));
+}
+
+// Test unbound or mismatched records are skipped
+TEST_F(EventJournalTest, SkipsUnboundRecords) {
+    damage.push(5, JournalDamagePayload{2.5f});
+    journal.recordFrame(0);
+
+    JournalReplayer replayer(journal);
+    ASSERT_TRUE(replayer.replayFrame());
+    EXPECT_EQ(replayer.getSkippedRecordCount(), 1u);
+
+    // Same tag bound to a differently sized type
+    EventQueue<JournalMovePayload> wrong;
+    JournalReplayer mismatched(journal);
+    mismatched.bindQueue<JournalMovePayload>(DAMAGE_TAG, wrong);
+    ASSERT_TRUE(mismatched.replayFrame());
+    EXPECT_TRUE(wrong.empty());
+    EXPECT_EQ(mismatched.getSkippedRecordCount(), 1u);
+}
+
+// Test save/load round trip, including a journal with a missing footer
+TEST_F(EventJournalTest, SaveAndLoad) {
+    InputFrame input;
+    InputFrame::setBit(input.keysDown, KeyCode::W);
+    input.mouseX = 12;
+    journal.beginFrame(0);
+    journal.recordInput(input);
+    moves.push(3, JournalMovePayload{1, 2});
+    journal.recordEvents();
+    journal.beginFrame(1);
+
+    std::stringstream stream;
+    ASSERT_TRUE(journal.save(stream));
+
+    EventJournal loaded;
+    ASSERT_TRUE(loaded.load(stream));
+    EXPECT_EQ(loaded.getData(), journal.getData());
+    EXPECT_EQ(loaded.getFrameCount(), 2u);
+
+    JournalReplayer replayer(loaded);
+    EventQueue<JournalMovePayload> replayed;
+    replayer.bindQueue<JournalMovePayload>(MOVE_TAG, replayed);
+    ASSERT_TRUE(replayer.replayFrame());
+    ASSERT_TRUE(replayer.hasInput());
+    EXPECT_TRUE(replayer.getInput().isKeyDown(KeyCode::W));
+    EXPECT_EQ(replayer.getInput().mouseX, 12);
+    EXPECT_EQ(replayed.size(), 1u);
+
+    // Truncated file: footer lost, index rebuilt from the records
+    std::string bytes = stream.str();
+    std::stringstream truncated(bytes.substr(0, 8 + journal.getSizeBytes() - 3));
+    EventJournal recovered;
+    ASSERT_TRUE(recovered.load(truncated));
+    EXPECT_EQ(recovered.getFrameCount(), 1u);
+    EXPECT_EQ(recovered.getIndex().size(), 1u);
+
+    std::stringstream garbage("not a journal");
+    EXPECT_FALSE(recovered.load(garbage));
+}
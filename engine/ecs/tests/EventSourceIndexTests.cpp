@@ -0,0 +1,85 @@
+#include "../include/EventSourceIndex.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace ECS;
+
+// Test payload type
+struct IndexedMovePayload {
+    int sequence = 0;
+};
+
+class EventSourceIndexTest : public ::testing::Test {
+protected:
+    EventQueue<IndexedMovePayload> moves;
+    EventSourceIndex<IndexedMovePayload> index;
+};
+
+// Test events are grouped by source with push order kept
+TEST_F(EventSourceIndexTest, GroupsBySource) {
+    const EntityID pushOrder[] = {5, 2, 5, 9, 2, 5};
+    for (int i = 0; i < 6; ++i) {
+        moves.push(pushOrder[i], IndexedMovePayload{i});
+    }
+
+    index.drain(moves);
+    EXPECT_TRUE(moves.empty());
+    EXPECT_EQ(index.size(), 6u);
+    EXPECT_EQ(index.getSources(), (std::vector<EntityID>{2, 5, 9}));
+
+    EventView<IndexedMovePayload> fives = index.getEvents(5);
+    ASSERT_EQ(fives.size(), 3u);
+    EXPECT_EQ(fives[0].payload.sequence, 0);
+    EXPECT_EQ(fives[1].payload.sequence, 2);
+    EXPECT_EQ(fives[2].payload.sequence, 5);
+
+    EXPECT_EQ(index.getEvents(2).size(), 2u);
+    EXPECT_EQ(index.getEvents(9).size(), 1u);
+    EXPECT_TRUE(index.getEvents(3).empty());
+    EXPECT_TRUE(index.getEvents(1000).empty());
+}
+
+// Test multi-byte IDs sort correctly across radix passes (and past the direct table)
+TEST_F(EventSourceIndexTest, WideEntityIds) {
+    const std::vector<EntityID> ids = {70000, 3, 256, 70000, 65536, 255, 3, 16777217};
+    for (size_t i = 0; i < ids.size(); ++i) {
+        moves.push(ids[i], IndexedMovePayload{static_cast<int>(i)});
+    }
+    index.drain(moves);
+
+    EXPECT_EQ(index.getSources(), (std::vector<EntityID>{3, 255, 256, 65536, 70000, 16777217}));
+    EventView<IndexedMovePayload> all = index.getAll();
+    for (size_t i = 1; i < all.size(); ++i) {
+        EXPECT_LE(all[i - 1].source, all[i].source);
+    }
+    ASSERT_EQ(index.getEvents(70000).size(), 2u);
+    EXPECT_EQ(index.getEvents(70000)[0].payload.sequence, 0);
+    EXPECT_EQ(index.getEvents(70000)[1].payload.sequence, 3);
+}
+
+// Test a new build hides sources from the previous frame
+TEST_F(EventSourceIndexTest, RebuildPerFrame) {
+    moves.push(4, IndexedMovePayload{1});
+    index.drain(moves);
+    EXPECT_EQ(index.getEvents(4).size(), 1u);
+
+    moves.push(7, IndexedMovePayload{2});
+    index.drain(moves);
+    EXPECT_TRUE(index.getEvents(4).empty());
+    EXPECT_EQ(index.getEvents(7).size(), 1u);
+
+    index.clear();
+    EXPECT_EQ(index.size(), 0u);
+    EXPECT_TRUE(index.getEvents(7).empty());
+}
+
+// Test building from a double-buffered front view
+TEST_F(EventSourceIndexTest, BuildFromFrontBuffer) {
+    moves.push(1, IndexedMovePayload{0});
+    moves.push(1, IndexedMovePayload{1});
+    moves.swapBuffers();
+
+    index.build(moves.readFront());
+    EXPECT_EQ(index.getEvents(1).size(), 2u);
+    EXPECT_EQ(moves.frontSize(), 2u);
+}
@@ -320,4 +320,101 @@ TEST_F(EventTest, ComplexProcessingScenario) {
     EXPECT_EQ(damagedEntities.size(), 1);
     EXPECT_TRUE(moveQueue.empty());
     EXPECT_TRUE(damageQueue.empty());
-}
\ No newline at end of file
+}
+
+// Test double-buffered swap publishes pending events to the front buffer
+TEST_F(EventTest, DoubleBufferSwap) {
+    EventQueue<MovePayload> queue;
+    EXPECT_TRUE(queue.readFront().empty());
+    
+    queue.push(entity1, MovePayload{1.0f, 0.0f});
+    queue.push(entity2, MovePayload{0.0f, 1.0f});
+    queue.swapBuffers();
+    
+    EXPECT_TRUE(queue.empty());        // Back buffer is ready for new events
+    EXPECT_EQ(queue.frontSize(), 2);
+    
+    EventView<MovePayload> front = queue.readFront();
+    ASSERT_EQ(front.size(), 2);
+    EXPECT_EQ(front[0].source, entity1);
+    EXPECT_EQ(front[1].payload, MovePayload(0.0f, 1.0f));
+    
+    // Pushing during the frame does not disturb the front view
+    queue.push(entity1, MovePayload{9.0f, 9.0f});
+    EXPECT_EQ(front.size(), 2);
+    EXPECT_EQ(front[0].payload, MovePayload(1.0f, 0.0f));
+    
+    // Next swap replaces the front with the new events
+    queue.swapBuffers();
+    ASSERT_EQ(queue.frontSize(), 1);
+    EXPECT_EQ(queue.readFront()[0].payload, MovePayload(9.0f, 9.0f));
+    
+    // Empty frame clears the front
+    queue.swapBuffers();
+    EXPECT_TRUE(queue.readFront().empty());
+}
+
+// Test clear() drops both pending and published events
+TEST_F(EventTest, DoubleBufferClear) {
+    EventQueue<MovePayload> queue;
+    queue.push(entity1, MovePayload{1.0f, 0.0f});
+    queue.swapBuffers();
+    queue.push(entity2, MovePayload{0.0f, 1.0f});
+    ASSERT_EQ(queue.frontSize(), 1);
+    ASSERT_EQ(queue.size(), 1);
+    
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.frontSize(), 0);
+    EXPECT_TRUE(queue.readFront().empty());
+    
+    // Next swap publishes only events pushed after the clear
+    queue.push(entity1, MovePayload{2.0f, 2.0f});
+    queue.swapBuffers();
+    ASSERT_EQ(queue.frontSize(), 1);
+    EXPECT_EQ(queue.readFront()[0].payload, MovePayload(2.0f, 2.0f));
+}
+
+// Test range-for iteration over the front view
+TEST_F(EventTest, DoubleBufferIteration) {
+    EventQueue<DamagePayload> queue;
+    queue.push(entity1, DamagePayload{10, entity2});
+    queue.push(entity2, DamagePayload{5, entity1});
+    queue.swapBuffers();
+    
+    int total = 0;
+    for (const auto& event : queue.readFront()) {
+        total += event.payload.amount;
+    }
+    EXPECT_EQ(total, 15);
+}
+
+// Test steady-state traffic reuses both buffers without reallocating
+TEST_F(EventTest, DoubleBufferKeepsCapacity) {
+    EventQueue<MovePayload> queue;
+    
+    // Warm up both buffers
+    for (int frame = 0; frame < 2; ++frame) {
+        for (int i = 0; i < 64; ++i) {
+            queue.push(entity1, MovePayload{static_cast<float>(i), 0.0f});
+        }
+        queue.swapBuffers();
+    }
+    
+    const Event<MovePayload>* bufferA = queue.readFront().data();
+    queue.swapBuffers();
+    const Event<MovePayload>* bufferB = queue.readFront().data();
+    EXPECT_NE(bufferA, bufferB);
+    
+    for (int frame = 0; frame < 10; ++frame) {
+        for (int i = 0; i < 64; ++i) {
+            queue.push(entity1, MovePayload{static_cast<float>(i), 0.0f});
+        }
+        queue.swapBuffers();
+        
+        // Front always lands in one of the two warmed-up allocations
+        const Event<MovePayload>* front = queue.readFront().data();
+        EXPECT_TRUE(front == bufferA || front == bufferB);
+        EXPECT_GE(queue.peek().capacity(), 64u);
+    }
+}
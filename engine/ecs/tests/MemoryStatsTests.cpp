@@ -0,0 +1,126 @@
+#include "../include/MemoryStats.hpp"
+#include "../include/ComponentArray.hpp"
+#include "../include/EntityManager.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+
+using namespace ECS;
+
+// Test component structures
+struct StatsPosition {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+class MemoryStatsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        positionBit = 1ULL << 0;
+    }
+
+    void addPositions(size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            Entity entity = entityManager.createEntity();
+            positions.add(entity.id, {}, positionBit, entityManager);
+        }
+    }
+
+    EntityManager entityManager;
+    ComponentArray<StatsPosition> positions;
+    uint64_t positionBit;
+};
+
+// Test empty array reports nothing live
+TEST_F(MemoryStatsTest, EmptyArray) {
+    StorageStats stats = MemoryStats::collect(positions, "Position");
+
+    EXPECT_EQ(stats.name, "Position");
+    EXPECT_EQ(stats.liveCount, 0u);
+    EXPECT_EQ(stats.bytesUsed, 0u);
+    EXPECT_EQ(stats.bytesWasted, stats.bytesAllocated);
+}
+
+// Test used/allocated/wasted accounting for component arrays
+TEST_F(MemoryStatsTest, ComponentArrayAccounting) {
+    positions.reserve(100);
+    addPositions(10);
+
+    StorageStats stats = MemoryStats::collect(positions);
+    EXPECT_EQ(stats.liveCount, 10u);
+    EXPECT_GE(stats.capacity, 100u);
+    EXPECT_GE(stats.bytesUsed, 10 * (sizeof(StatsPosition) + sizeof(EntityID)));
+    EXPECT_GT(stats.bytesAllocated, stats.bytesUsed);
+    EXPECT_EQ(stats.bytesWasted, stats.bytesAllocated - stats.bytesUsed);
+    EXPECT_GT(stats.hashBuckets, 0u);
+    EXPECT_GT(stats.hashLoadFactor, 0.0f);
+    EXPECT_GT(stats.fragmentation, 0.5f); // 90% of reserved slots are empty
+    EXPECT_LT(stats.fragmentation, 1.0f);
+}
+
+// Test entity manager dead slots count as waste
+TEST_F(MemoryStatsTest, EntityManagerDeadSlots) {
+    std::vector<Entity> entities;
+    for (int i = 0; i < 20; ++i) {
+        entities.push_back(entityManager.createEntity());
+    }
+    StorageStats before = MemoryStats::collect(entityManager);
+
+    for (int i = 0; i < 10; ++i) {
+        entityManager.destroyEntity(entities[i]);
+    }
+    StorageStats after = MemoryStats::collect(entityManager);
+
+    EXPECT_EQ(before.liveCount, 20u);
+    EXPECT_EQ(after.liveCount, 10u);
+    EXPECT_LT(after.bytesUsed, before.bytesUsed);
+    EXPECT_GT(after.fragmentation, before.fragmentation);
+    EXPECT_GE(after.capacity, 21u);
+}
+
+// Test report collects every tracked container and formats output
+TEST_F(MemoryStatsTest, ReportCollectAndExport) {
+    addPositions(5);
+
+    MemoryReport report;
+    report.track("Position", positions);
+    report.trackEntityManager(entityManager);
+    EXPECT_EQ(report.getTrackedCount(), 2u);
+
+    const auto& stats = report.collect();
+    ASSERT_EQ(stats.size(), 2u);
+    EXPECT_EQ(stats[0].name, "Position");
+    EXPECT_EQ(stats[0].liveCount, 5u);
+    EXPECT_EQ(stats[1].name, "EntityManager");
+    EXPECT_EQ(stats[1].liveCount, 5u);
+    EXPECT_EQ(report.getTotalBytesAllocated(), stats[0].bytesAllocated + stats[1].bytesAllocated);
+
+    std::string table = report.formatTable();
+    EXPECT_NE(table.find("Position"), std::string::npos);
+    EXPECT_NE(table.find("Total"), std::string::npos);
+
+    std::ostringstream csv;
+    report.writeCsv(csv, 1);
+    report.collect();
+    report.writeCsv(csv, 2);
+    std::string output = csv.str();
+
+    // One header + two rows per frame
+    EXPECT_EQ(std::count(output.begin(), output.end(), '\n'), 5);
+    EXPECT_EQ(output.find("frame,"), 0u);
+    EXPECT_NE(output.find("2,Position,5"), std::string::npos);
+}
+
+// Test change tracking buffers are included in allocated bytes
+TEST_F(MemoryStatsTest, ChangeTrackingCounted) {
+    addPositions(8);
+    size_t without = MemoryStats::collect(positions).bytesAllocated;
+
+    positions.setChangeTracking(true);
+    for (EntityID id : positions.getEntityIDs()) {
+        positions.markChanged(id);
+    }
+    size_t with = MemoryStats::collect(positions).bytesAllocated;
+
+    EXPECT_GT(with, without);
+}
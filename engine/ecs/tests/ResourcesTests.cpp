@@ -0,0 +1,113 @@
+#include "../include/Resources.hpp"
+#include "../include/EntityManager.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace ECS;
+
+// Test resource types
+struct TurnCounter {
+    int turn = 0;
+};
+
+struct EraTheme {
+    std::string name;
+    int palette = 0;
+};
+
+struct GridDimensions {
+    int width = 0;
+    int height = 0;
+};
+
+// Test resource IDs are stable per type and distinct across types
+TEST(ResourcesTest, ResourceIdsAreStable) {
+    uint32_t turnId = getResourceId<TurnCounter>();
+    uint32_t eraId = getResourceId<EraTheme>();
+
+    EXPECT_EQ(turnId, getResourceId<TurnCounter>());
+    EXPECT_NE(turnId, eraId);
+    EXPECT_NE(getResourceBit<TurnCounter>(), getResourceBit<EraTheme>());
+    EXPECT_GE(getRegisteredResourceCount(), 2u);
+}
+
+// Test emplace and typed access
+TEST(ResourcesTest, EmplaceAndGet) {
+    Resources resources;
+    EXPECT_TRUE(resources.empty());
+    EXPECT_EQ(resources.get<TurnCounter>(), nullptr);
+
+    TurnCounter& counter = resources.emplace<TurnCounter>(TurnCounter{3});
+    EXPECT_EQ(counter.turn, 3);
+    EXPECT_TRUE(resources.has<TurnCounter>());
+    EXPECT_FALSE(resources.has<GridDimensions>());
+    EXPECT_EQ(resources.size(), 1u);
+
+    resources.get<TurnCounter>()->turn++;
+    EXPECT_EQ(counter.turn, 4);
+
+    const Resources& constResources = resources;
+    EXPECT_EQ(constResources.get<TurnCounter>()->turn, 4);
+}
+
+// Test non-POD resources and replacement
+TEST(ResourcesTest, ReplaceNonTrivialResource) {
+    Resources resources;
+    resources.emplace<EraTheme>(EraTheme{"Wild West", 1});
+    resources.emplace<EraTheme>(EraTheme{"Steampunk", 2});
+
+    EXPECT_EQ(resources.size(), 1u);
+    EXPECT_EQ(resources.get<EraTheme>()->name, "Steampunk");
+    EXPECT_EQ(resources.get<EraTheme>()->palette, 2);
+}
+
+// Test pointers remain stable when other resources are added
+TEST(ResourcesTest, PointersStableAcrossInsertions) {
+    Resources resources;
+    TurnCounter* counter = &resources.emplace<TurnCounter>();
+    resources.emplace<EraTheme>();
+    resources.emplace<GridDimensions>(GridDimensions{16, 12});
+
+    EXPECT_EQ(resources.get<TurnCounter>(), counter);
+    EXPECT_EQ(resources.get<GridDimensions>()->width, 16);
+}
+
+// Test removal and clear
+TEST(ResourcesTest, RemoveAndClear) {
+    Resources resources;
+    resources.emplace<TurnCounter>();
+    resources.emplace<GridDimensions>();
+
+    resources.remove<TurnCounter>();
+    EXPECT_FALSE(resources.has<TurnCounter>());
+    EXPECT_EQ(resources.size(), 1u);
+
+    resources.remove<TurnCounter>(); // No-op
+    EXPECT_EQ(resources.size(), 1u);
+
+    resources.clear();
+    EXPECT_TRUE(resources.empty());
+    EXPECT_FALSE(resources.has<GridDimensions>());
+}
+
+// Test move transfers ownership
+TEST(ResourcesTest, MoveTransfersOwnership) {
+    Resources source;
+    source.emplace<TurnCounter>(TurnCounter{7});
+
+    Resources destination = std::move(source);
+    EXPECT_EQ(destination.get<TurnCounter>()->turn, 7);
+    EXPECT_TRUE(source.empty());
+}
+
+// Test resources are reachable from EntityManager and survive entity clear
+TEST(ResourcesTest, EntityManagerOwnsResources) {
+    EntityManager entityManager;
+    entityManager.getResources().emplace<GridDimensions>(GridDimensions{32, 32});
+    entityManager.createEntity();
+
+    entityManager.clear();
+    EXPECT_EQ(entityManager.getActiveEntityCount(), 0u);
+    ASSERT_TRUE(entityManager.getResources().has<GridDimensions>());
+    EXPECT_EQ(entityManager.getResources().get<GridDimensions>()->height, 32);
+}
@@ -0,0 +1,219 @@
+#include "../include/RewindBuffer.hpp"
+#include "../include/ComponentArray.hpp"
+#include "../include/EntityManager.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace ECS;
+
+// Test component structures
+struct RewindPosition {
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct RewindHealth {
+    int hp = 0;
+};
+
+class RewindBufferTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        entityManager = std::make_unique<EntityManager>();
+        entity1 = entityManager->createEntity();
+        entity2 = entityManager->createEntity();
+        entity3 = entityManager->createEntity();
+
+        positionBit = 1ULL << 0;
+        healthBit = 1ULL << 1;
+    }
+
+    std::unique_ptr<EntityManager> entityManager;
+    Entity entity1, entity2, entity3;
+    uint64_t positionBit, healthBit;
+    ComponentArray<RewindPosition> positions;
+    ComponentArray<RewindHealth> healths;
+};
+
+// Test XOR/RLE encoding round trip in both directions
+TEST_F(RewindBufferTest, XorDeltaRoundTrip) {
+    std::vector<uint8_t> from(100, 7);
+    std::vector<uint8_t> to = from;
+    to[10] = 1;
+    to[11] = 2;
+    to[90] = 3;
+    to.resize(120, 9);
+
+    std::vector<uint8_t> delta;
+    RewindBuffer::encodeXorDelta(from, to, delta);
+    EXPECT_LT(delta.size(), to.size());
+
+    std::vector<uint8_t> forward = from;
+    RewindBuffer::applyXorDelta(forward, delta.data(), delta.size(), to.size());
+    EXPECT_EQ(forward, to);
+
+    std::vector<uint8_t> backward = to;
+    RewindBuffer::applyXorDelta(backward, delta.data(), delta.size(), from.size());
+    EXPECT_EQ(backward, from);
+}
+
+// Test identical blobs encode to nothing
+TEST_F(RewindBufferTest, UnchangedStateEncodesEmpty) {
+    std::vector<uint8_t> blob(256, 42);
+    std::vector<uint8_t> delta;
+    RewindBuffer::encodeXorDelta(blob, blob, delta);
+    EXPECT_TRUE(delta.empty());
+}
+
+// Test rewinding a single turn restores component values
+TEST_F(RewindBufferTest, RewindOneTurn) {
+    RewindBuffer rewind;
+    rewind.track(positions, positionBit);
+
+    positions.add(entity1.id, {1.0f, 2.0f}, positionBit, *entityManager);
+    rewind.recordTurn();
+
+    positions.get(entity1.id)->x = 5.0f;
+    rewind.recordTurn();
+
+    EXPECT_EQ(rewind.getAvailableRewindDepth(), 1);
+    EXPECT_TRUE(rewind.rewind(1, *entityManager));
+    EXPECT_FLOAT_EQ(positions.get(entity1.id)->x, 1.0f);
+    EXPECT_FLOAT_EQ(positions.get(entity1.id)->y, 2.0f);
+    EXPECT_EQ(rewind.getCurrentTurn(), 0);
+    EXPECT_EQ(rewind.getAvailableRewindDepth(), 0);
+}
+
+// Test rewinding restores added and removed components and entity masks
+TEST_F(RewindBufferTest, RewindRestoresMembership) {
+    RewindBuffer rewind;
+    rewind.track(positions, positionBit);
+
+    positions.add(entity1.id, {1.0f, 1.0f}, positionBit, *entityManager);
+    positions.add(entity2.id, {2.0f, 2.0f}, positionBit, *entityManager);
+    rewind.recordTurn();
+
+    positions.remove(entity1.id, positionBit, *entityManager);
+    positions.add(entity3.id, {3.0f, 3.0f}, positionBit, *entityManager);
+    rewind.recordTurn();
+
+    ASSERT_TRUE(rewind.rewind(1, *entityManager));
+    EXPECT_TRUE(positions.has(entity1.id));
+    EXPECT_TRUE(positions.has(entity2.id));
+    EXPECT_FALSE(positions.has(entity3.id));
+    EXPECT_TRUE(entityManager->getEntityByID(entity1.id)->hasComponent(positionBit));
+    EXPECT_FALSE(entityManager->getEntityByID(entity3.id)->hasComponent(positionBit));
+    EXPECT_FLOAT_EQ(positions.get(entity1.id)->x, 1.0f);
+}
+
+// Test rewinding several turns across multiple tracks and keyframes
+TEST_F(RewindBufferTest, RewindManyTurnsMultipleTracks) {
+    RewindBuffer rewind(RewindBuffer::DEFAULT_MEMORY_BUDGET, 4);
+    rewind.track(positions, positionBit);
+    rewind.track(healths, healthBit);
+
+    positions.add(entity1.id, {0.0f, 0.0f}, positionBit, *entityManager);
+    healths.add(entity1.id, {100}, healthBit, *entityManager);
+
+    for (int turn = 0; turn < 20; ++turn) {
+        positions.get(entity1.id)->x = static_cast<float>(turn);
+        healths.get(entity1.id)->hp = 100 - turn;
+        rewind.recordTurn();
+    }
+
+    EXPECT_EQ(rewind.getCurrentTurn(), 19);
+    ASSERT_TRUE(rewind.rewind(13, *entityManager));
+    EXPECT_FLOAT_EQ(positions.get(entity1.id)->x, 6.0f);
+    EXPECT_EQ(healths.get(entity1.id)->hp, 94);
+    EXPECT_EQ(rewind.getCurrentTurn(), 6);
+
+    // Recording continues from the restored turn
+    positions.get(entity1.id)->x = 42.0f;
+    rewind.recordTurn();
+    EXPECT_EQ(rewind.getCurrentTurn(), 7);
+    ASSERT_TRUE(rewind.rewind(1, *entityManager));
+    EXPECT_FLOAT_EQ(positions.get(entity1.id)->x, 6.0f);
+}
+
+// Test rewinding further than the retained history fails without side effects
+TEST_F(RewindBufferTest, RewindBeyondHistoryFails) {
+    RewindBuffer rewind;
+    rewind.track(positions, positionBit);
+
+    positions.add(entity1.id, {1.0f, 1.0f}, positionBit, *entityManager);
+    rewind.recordTurn();
+    positions.get(entity1.id)->x = 9.0f;
+
+    EXPECT_FALSE(rewind.rewind(1, *entityManager));
+    EXPECT_FLOAT_EQ(positions.get(entity1.id)->x, 9.0f);
+    EXPECT_TRUE(rewind.rewind(0, *entityManager));
+}
+
+// Test memory budget evicts the oldest turns
+TEST_F(RewindBufferTest, MemoryBudgetEvictsOldTurns) {
+    for (uint32_t i = 0; i < 64; ++i) {
+        Entity entity = entityManager->createEntity();
+        positions.add(entity.id, {static_cast<float>(i), 0.0f}, positionBit, *entityManager);
+    }
+
+    RewindBuffer unlimited(64 * 1024 * 1024, 8);
+    RewindBuffer limited(4 * 1024, 8);
+    unlimited.track(positions, positionBit);
+    limited.track(positions, positionBit);
+
+    for (int turn = 0; turn < 50; ++turn) {
+        for (size_t i = 0; i < positions.size(); ++i) {
+            positions.getByIndex(i).y += 1.0f;
+        }
+        unlimited.recordTurn();
+        limited.recordTurn();
+    }
+
+    EXPECT_EQ(unlimited.getRecordedTurnCount(), 50);
+    EXPECT_LT(limited.getRecordedTurnCount(), 50);
+    EXPECT_GE(limited.getRecordedTurnCount(), 1);
+    EXPECT_LE(limited.getMemoryUsage(), 4 * 1024);
+    EXPECT_GT(unlimited.getMemoryUsage(), limited.getMemoryUsage());
+
+    // Whatever is retained can still be restored
+    size_t depth = limited.getAvailableRewindDepth();
+    float expectedY = 50.0f - static_cast<float>(depth);
+    ASSERT_TRUE(limited.rewind(static_cast<uint32_t>(depth), *entityManager));
+    EXPECT_FLOAT_EQ(positions.getByIndex(0).y, expectedY);
+}
+
+// Test sparse changes produce small deltas
+TEST_F(RewindBufferTest, SparseChangesAreCompact) {
+    for (uint32_t i = 0; i < 1000; ++i) {
+        Entity entity = entityManager->createEntity();
+        positions.add(entity.id, {static_cast<float>(i), 0.0f}, positionBit, *entityManager);
+    }
+
+    RewindBuffer rewind(64 * 1024 * 1024, 0);
+    rewind.track(positions, positionBit);
+    rewind.recordTurn();
+    rewind.recordTurn(); // Warm up the capture buffers
+    size_t before = rewind.getMemoryUsage();
+
+    positions.getByIndex(500).y = 1.0f;
+    rewind.recordTurn();
+    size_t after = rewind.getMemoryUsage();
+
+    EXPECT_LT(after - before, 128u);
+}
+
+// Test registering a track discards history
+TEST_F(RewindBufferTest, TrackResetsHistory) {
+    RewindBuffer rewind;
+    rewind.track(positions, positionBit);
+    rewind.recordTurn();
+    rewind.recordTurn();
+    EXPECT_EQ(rewind.getRecordedTurnCount(), 2);
+
+    rewind.track(healths, healthBit);
+    EXPECT_EQ(rewind.getRecordedTurnCount(), 0);
+    EXPECT_EQ(rewind.getTrackCount(), 2);
+
+    rewind.clear();
+    EXPECT_EQ(rewind.getTrackCount(), 0);
+}
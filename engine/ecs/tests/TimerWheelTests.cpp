@@ -0,0 +1,126 @@
+#include "../include/TimerWheel.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace ECS;
+
+// Test payload types
+struct TimerHazardPayload {
+    int damage = 0;
+
+    bool operator==(const TimerHazardPayload& other) const {
+        return damage == other.damage;
+    }
+};
+
+struct TimerDepartPayload {
+    uint32_t trainId = 0;
+};
+
+class TimerWheelTest : public ::testing::Test {
+protected:
+    TimerWheel timers;
+    EventQueue<TimerHazardPayload> hazards;
+};
+
+// Test an event fires exactly at its delay
+TEST_F(TimerWheelTest, FiresAtDelay) {
+    TimerID id = timers.scheduleEvent(hazards, 7, TimerHazardPayload{3}, 5);
+    EXPECT_TRUE(timers.isPending(id));
+    EXPECT_EQ(timers.getRemainingTicks(id), 5u);
+
+    EXPECT_EQ(timers.advance(4), 0u);
+    EXPECT_TRUE(hazards.empty());
+    EXPECT_EQ(timers.getRemainingTicks(id), 1u);
+
+    EXPECT_EQ(timers.advance(1), 1u);
+    ASSERT_EQ(hazards.size(), 1u);
+    EXPECT_EQ(hazards.peek()[0].source, 7u);
+    EXPECT_EQ(hazards.peek()[0].payload, TimerHazardPayload{3});
+    EXPECT_FALSE(timers.isPending(id));
+    EXPECT_EQ(timers.getPendingCount(), 0u);
+}
+
+// Test delays spanning every wheel level fire on the right tick
+TEST_F(TimerWheelTest, CascadesAcrossLevels) {
+    const std::vector<uint64_t> delays = {1, 63, 64, 65, 200, 4095, 4096, 4097, 70000, 300000};
+    for (uint64_t delay : delays) {
+        timers.scheduleEvent(hazards, 1, TimerHazardPayload{static_cast<int>(delay)}, delay);
+    }
+
+    std::vector<uint64_t> firedAt;
+    for (uint64_t tick = 1; tick <= 300000; ++tick) {
+        if (timers.advance(1) > 0) {
+            for (const auto& event : hazards.peek()) {
+                EXPECT_EQ(static_cast<uint64_t>(event.payload.damage), tick);
+                firedAt.push_back(tick);
+            }
+            hazards.clear();
+        }
+    }
+    EXPECT_EQ(firedAt, delays);
+}
+
+// Test scheduling from a non-zero tick and beyond the wheel range
+TEST_F(TimerWheelTest, OffsetAndLongDelays) {
+    timers.scheduleEvent(hazards, 1, TimerHazardPayload{0}, 1);
+    timers.advance(37);
+    hazards.clear();
+
+    TimerID near = timers.scheduleEvent(hazards, 2, TimerHazardPayload{1}, 100);
+    TimerID far = timers.scheduleEvent(hazards, 3, TimerHazardPayload{2}, TimerWheel::MAX_DELAY + 10);
+    EXPECT_EQ(timers.getRemainingTicks(far), TimerWheel::MAX_DELAY + 10);
+
+    timers.advance(99);
+    EXPECT_TRUE(hazards.empty());
+    timers.advance(1);
+    EXPECT_EQ(hazards.size(), 1u);
+    EXPECT_FALSE(timers.isPending(near));
+
+    timers.advance(TimerWheel::MAX_DELAY + 10 - 101);
+    EXPECT_EQ(hazards.size(), 1u);
+    timers.advance(1);
+    EXPECT_EQ(hazards.size(), 2u);
+    EXPECT_EQ(hazards.peek()[1].source, 3u);
+}
+
+// Test O(1) cancel, stale handles and node reuse
+TEST_F(TimerWheelTest, CancelAndReuse) {
+    TimerID a = timers.scheduleEvent(hazards, 1, TimerHazardPayload{1}, 10);
+    TimerID b = timers.scheduleEvent(hazards, 2, TimerHazardPayload{2}, 10);
+    TimerID c = timers.scheduleEvent(hazards, 3, TimerHazardPayload{3}, 10);
+
+    EXPECT_TRUE(timers.cancel(b));
+    EXPECT_FALSE(timers.cancel(b));
+    EXPECT_FALSE(timers.cancel(INVALID_TIMER));
+    EXPECT_EQ(timers.getPendingCount(), 2u);
+
+    // Reused node must not honour the old handle
+    TimerID d = timers.scheduleEvent(hazards, 4, TimerHazardPayload{4}, 20);
+    EXPECT_NE(d, b);
+    EXPECT_FALSE(timers.isPending(b));
+    EXPECT_TRUE(timers.isPending(d));
+
+    timers.advance(10);
+    ASSERT_EQ(hazards.size(), 2u);
+    EXPECT_EQ(hazards.peek()[0].source, 1u); // Same-slot timers fire in scheduling order
+    EXPECT_EQ(hazards.peek()[1].source, 3u);
+    EXPECT_FALSE(timers.isPending(a));
+    EXPECT_FALSE(timers.isPending(c));
+
+    timers.clear();
+    EXPECT_FALSE(timers.isPending(d));
+    EXPECT_EQ(timers.advance(20), 0u);
+}
+
+// Test scheduling into an event bus queue
+TEST_F(TimerWheelTest, ScheduleIntoBus) {
+    EventBus bus;
+    timers.scheduleEvent(bus, 9, TimerDepartPayload{42}, 3);
+    timers.advance(3);
+
+    EventQueue<TimerDepartPayload>* queue = bus.findQueue<TimerDepartPayload>();
+    ASSERT_NE(queue, nullptr);
+    ASSERT_EQ(queue->size(), 1u);
+    EXPECT_EQ(queue->peek()[0].payload.trainId, 42u);
+}
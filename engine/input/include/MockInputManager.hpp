@@ -3,6 +3,7 @@
 #include "../../ecs/systems/include/IInputManager.hpp"
 #include <unordered_map>
 #include <unordered_set>
+#include <cstddef>
 
 namespace ECS {
 
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "../../ecs/systems/include/IInputManager.hpp"
+#include "../../ecs/include/EventJournal.hpp"
+#include <cstddef>
+
+namespace ECS {
+
+/**
+ * ReplayInputManager - IInputManager backed by recorded InputFrames
+ * 
+ * Drives systems from an EventJournal during headless replay: each frame,
+ * feed it the replayer's input snapshot and systems see exactly the key
+ * and mouse state that was recorded.
+ * 
+ * Usage:
+ *   ReplayInputManager replayInput;
+ *   InputSystem inputSystem(&replayInput);
+ *   while (replayer.replayFrame()) {
+ *       replayInput.setFrame(replayer.getInput());
+ *       ...
+ *   }
+ */
+class ReplayInputManager : public IInputManager {
+public:
+    ReplayInputManager() = default;
+    ~ReplayInputManager() override = default;
+    
+    // IInputManager interface implementation
+    bool isKeyPressed(int keyCode) const override;
+    bool wasKeyPressed(int keyCode) const override;
+    bool wasKeyReleased(int keyCode) const override;
+    void getMousePosition(int& x, int& y) const override;
+    bool isMouseButtonPressed(int button) const override;
+    bool wasMouseButtonPressed(int button) const override;
+    void update() override;
+    
+    /**
+     * Set the input state to present until the next setFrame()
+     * @param frame Recorded input snapshot
+     */
+    void setFrame(const InputFrame& frame);
+    
+    /**
+     * Get the current input snapshot
+     * @return Current frame
+     */
+    const InputFrame& getFrame() const;
+    
+    /**
+     * Get number of update() calls made
+     * @return Update call count
+     */
+    size_t getUpdateCount() const;
+
+private:
+    InputFrame current;
+    size_t updateCount = 0;
+};
+
+} // namespace ECS
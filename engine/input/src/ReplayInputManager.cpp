@@ -0,0 +1,47 @@
+#include "../include/ReplayInputManager.hpp"
+
+namespace ECS {
+
+bool ReplayInputManager::isKeyPressed(int keyCode) const {
+    return current.isKeyDown(keyCode);
+}
+
+bool ReplayInputManager::wasKeyPressed(int keyCode) const {
+    return current.isKeyPressed(keyCode);
+}
+
+bool ReplayInputManager::wasKeyReleased(int keyCode) const {
+    return current.isKeyReleased(keyCode);
+}
+
+void ReplayInputManager::getMousePosition(int& x, int& y) const {
+    x = current.mouseX;
+    y = current.mouseY;
+}
+
+bool ReplayInputManager::isMouseButtonPressed(int button) const {
+    return button >= 0 && button < InputFrame::MOUSE_BUTTON_COUNT && (current.mouseDown & (1u << button)) != 0;
+}
+
+bool ReplayInputManager::wasMouseButtonPressed(int button) const {
+    return button >= 0 && button < InputFrame::MOUSE_BUTTON_COUNT && (current.mousePressed & (1u << button)) != 0;
+}
+
+void ReplayInputManager::update() {
+    // State is driven by setFrame(); just count frames like MockInputManager
+    updateCount++;
+}
+
+void ReplayInputManager::setFrame(const InputFrame& frame) {
+    current = frame;
+}
+
+const InputFrame& ReplayInputManager::getFrame() const {
+    return current;
+}
+
+size_t ReplayInputManager::getUpdateCount() const {
+    return updateCount;
+}
+
+} // namespace ECS
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include "../include/ReplayInputManager.hpp"
+#include "../include/MockInputManager.hpp"
+
+using namespace ECS;
+
+/**
+ * Test a captured frame replays the same state through the interface
+ */
+TEST(ReplayInputManagerTest, ReplaysCapturedFrame) {
+    MockInputManager mock;
+    mock.setKeyPressed(KeyCode::A);
+    mock.simulateKeyPress(KeyCode::Space);
+    mock.simulateKeyRelease(KeyCode::D);
+    mock.simulateMousePress(1);
+    mock.setMousePosition(320, 240);
+
+    ReplayInputManager replay;
+    replay.setFrame(InputFrame::capture(mock));
+
+    EXPECT_TRUE(replay.isKeyPressed(KeyCode::A));
+    EXPECT_FALSE(replay.wasKeyPressed(KeyCode::A));
+    EXPECT_TRUE(replay.isKeyPressed(KeyCode::Space));
+    EXPECT_TRUE(replay.wasKeyPressed(KeyCode::Space));
+    EXPECT_TRUE(replay.wasKeyReleased(KeyCode::D));
+    EXPECT_FALSE(replay.isKeyPressed(KeyCode::D));
+    EXPECT_TRUE(replay.isMouseButtonPressed(1));
+    EXPECT_TRUE(replay.wasMouseButtonPressed(1));
+    EXPECT_FALSE(replay.isMouseButtonPressed(0));
+
+    int x = 0;
+    int y = 0;
+    replay.getMousePosition(x, y);
+    EXPECT_EQ(x, 320);
+    EXPECT_EQ(y, 240);
+}
+
+/**
+ * Test out-of-range codes are reported as not pressed
+ */
+TEST(ReplayInputManagerTest, OutOfRangeCodes) {
+    ReplayInputManager replay;
+    replay.update();
+    EXPECT_EQ(replay.getUpdateCount(), 1u);
+    EXPECT_FALSE(replay.isKeyPressed(-1));
+    EXPECT_FALSE(replay.isKeyPressed(InputFrame::KEY_COUNT));
+    EXPECT_FALSE(replay.isMouseButtonPressed(7));
+}
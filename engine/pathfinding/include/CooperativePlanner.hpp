@@ -0,0 +1,181 @@
+#pragma once
+
+#include "../../physics/include/MovementSystem.hpp"
+#include "../../physics/include/OccupancyGrid.hpp"
+#include "../../physics/include/TileMap.hpp"
+#include "GridSearch.hpp"
+#include "ReservationTable.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * CooperativePlan - Timed route of one unit for a turn
+ *
+ * steps[t - 1] is the unit's cell at tick t; a repeated cell is a wait.
+ * Waiting at the final cell is trimmed, so an empty plan means the unit
+ * stays where it is.
+ */
+struct CooperativePlan {
+    EntityID unit = INVALID_ENTITY;
+    std::vector<TileCoord> steps;
+    bool reachedGoal = false;
+    bool stuck = false;  // No conflict-free route; waits in place for the turn
+};
+
+/**
+ * CooperativePlanner - Resolves all moves of a turn together (WHCA*)
+ *
+ * Units are planned one at a time in priority order with a space-time A*
+ * limited to a window of ticks (one step per tick, straight 1, diagonal
+ * sqrt(2), waiting 1, no corner cutting). Each route is written to a
+ * ReservationTable before the next unit is planned, so lower-priority
+ * units route around or wait for higher-priority ones.
+ *
+ * A unit on cell c at tick t holds (c, t) and (c, t + 1): no two units
+ * share a cell, units never swap, and no unit enters a cell in the tick
+ * its previous occupant leaves it. That last rule matches OccupancyGrid,
+ * which holds a cell until the move out of it completes, so every planned
+ * step validates when MovementSystem starts it.
+ *
+ * Before planning, every unit of the batch holds its start cell at tick 0.
+ * A unit that cannot get out of the way of earlier routes is marked stuck
+ * and parked on its start; routes crossing that cell are dropped and
+ * planned again around it. The parked set only grows, so the batch settles
+ * in at most one extra round per stuck unit. A unit reaching its goal parks
+ * there; one that does not stops at the window's end on the cell closest
+ * to the goal by the octile heuristic. Units outside the batch (occupants
+ * and reservations in the occupancy grid) block for the whole turn.
+ *
+ * Search buffers cover the box of radius window around the unit for
+ * window + 1 ticks and are reused across units and calls.
+ *
+ * Usage:
+ *   CooperativePlanner planner(&map);
+ *   movement.queueGridMovement(a, 9, 4, true, 2);
+ *   movement.queueGridMovement(b, 1, 4, true, 1);
+ *   planner.resolveTurn(movement);  // Starts conflict-free paths for both
+ */
+class CooperativePlanner {
+public:
+    static constexpr int DEFAULT_WINDOW = 16;
+
+    /**
+     * Largest window accepted; larger values are clamped
+     * Search buffers hold (2w + 1)^2 * (w + 1) states of 16 bytes: about
+     * 17 MB at 64 ticks, and state ids stay far below UINT32_MAX.
+     */
+    static constexpr int MAX_WINDOW = 64;
+    static constexpr float WAIT_COST = 1.0f;
+
+    /**
+     * Constructor
+     * @param map Tile map to plan on (not owned)
+     * @param window Ticks planned per turn (clamped to 1..MAX_WINDOW)
+     */
+    CooperativePlanner(const TileMap* map = nullptr, int window = DEFAULT_WINDOW);
+    ~CooperativePlanner() = default;
+
+    // Non-copyable but movable
+    CooperativePlanner(const CooperativePlanner&) = delete;
+    CooperativePlanner& operator=(const CooperativePlanner&) = delete;
+    CooperativePlanner(CooperativePlanner&&) = default;
+    CooperativePlanner& operator=(CooperativePlanner&&) = default;
+
+    void setTileMap(const TileMap* map);
+    const TileMap* getTileMap() const;
+
+    /**
+     * Set units that block for the whole turn in plan() (nullptr: tiles only)
+     * Batch units found in the grid do not block; their routes are planned.
+     */
+    void setOccupancyGrid(const OccupancyGrid* grid);
+    const OccupancyGrid* getOccupancyGrid() const;
+
+    /**
+     * Set ticks planned per turn (clamped to 1..MAX_WINDOW)
+     */
+    void setWindow(int ticks);
+    int getWindow() const;
+
+    /**
+     * Plan a batch of moves
+     * @param moves One move per unit, highest priority first, distinct start cells
+     * @param plans Output, one entry per move in the same order
+     */
+    void plan(const std::vector<QueuedMove>& moves, std::vector<CooperativePlan>& plans);
+
+    /**
+     * Plan every queued move of a movement system and start the routes
+     * Moves are taken in the system's QueuedMoveOrder, and its occupancy
+     * grid is used for units outside the batch. Units that reach their goal
+     * have their pending move dropped; the others keep it so the next call
+     * continues toward the goal. Ticks map to path steps, so units moved in
+     * one turn should share a speed to stay in lockstep.
+     * @return Number of units that started moving
+     */
+    size_t resolveTurn(MovementSystem& movement);
+
+    /**
+     * Get the reservations left by the last plan
+     */
+    const ReservationTable& getReservations() const;
+
+    /**
+     * Get the plans made by the last resolveTurn
+     */
+    const std::vector<CooperativePlan>& getPlans() const;
+
+    /**
+     * Get number of space-time states expanded by the last plan
+     */
+    size_t getExpandedCount() const;
+
+    /**
+     * Get number of routes dropped and planned again by the last plan
+     */
+    size_t getReplanCount() const;
+
+private:
+    void planBatch(const std::vector<QueuedMove>& moves, const OccupancyGrid* grid,
+                   std::vector<CooperativePlan>& plans);
+
+    /**
+     * Space-time A* for one unit against the current reservations
+     * @return false if the unit cannot stay clear of earlier routes
+     */
+    bool search(const QueuedMove& move, CooperativePlan& plan);
+
+    bool isStaticBlocked(int x, int y, EntityID self) const;
+    bool canStand(int x, int y, int tick, EntityID self) const;
+    bool canPark(int x, int y, int tick, EntityID self) const;
+    void reservePlan(const QueuedMove& move, const CooperativePlan& plan);
+    void releasePlan(const QueuedMove& move, const CooperativePlan& plan);
+
+    const TileMap* map;
+    const OccupancyGrid* occupancy = nullptr;
+    const OccupancyGrid* batchOccupancy = nullptr;  // Grid used by the plan in progress
+    int window;
+    ReservationTable reservations;
+    std::vector<EntityID> batchUnits;  // Sorted
+    std::vector<QueuedMove> queued;
+    std::vector<CooperativePlan> lastPlans;
+    size_t expandedCount = 0;
+    size_t replanCount = 0;
+
+    // Space-time search state, indexed tick * boxCells + cell
+    int boxMinX = 0;
+    int boxMinY = 0;
+    int boxWidth = 0;
+    int boxHeight = 0;
+    std::vector<float> costs;
+    std::vector<uint32_t> parents;
+    std::vector<uint32_t> seen;    // Search stamp when costs/parents were set
+    std::vector<uint32_t> closed;  // Search stamp when expanded
+    uint32_t searchStamp = 0;
+    std::vector<GridSearch::OpenNode> heap;
+};
+
+} // namespace ECS
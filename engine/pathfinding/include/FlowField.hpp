@@ -0,0 +1,209 @@
+#pragma once
+
+#include "../../physics/include/TileMap.hpp"
+#include "../../ecs/include/Event.hpp"
+#include "GridSearch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * FlowField - Distance and direction to the nearest of a set of goals for every tile
+ *
+ * A Dijkstra map: one build gives every tile's travel cost to the closest
+ * goal and the first step toward it. Any number of units then follow the
+ * field with one lookup per step, instead of each running its own search.
+ * Movement rules match Pathfinder (8-connected, straight 1, diagonal
+ * sqrt(2), no corner cutting), so distances equal A* path costs.
+ *
+ * The wavefront is expanded by repeated raster sweeps rather than a heap.
+ * Each row is relaxed from the row above (downward sweep) or below (upward
+ * sweep) in one branch-free loop over contiguous arrays that the compiler
+ * vectorizes (blocked tiles carry an additive penalty of infinity instead
+ * of a mask), followed by a left and a right scan along the row. Sweeps
+ * repeat until a full down/up round changes nothing; open maps converge in
+ * two or three rounds, winding corridors take roughly one round per turn.
+ * A row is only revisited when the row it relaxes from changed since its
+ * last visit, so late rounds touch just the rows still settling.
+ * Grids carry a one-tile blocked border so the loops need no bounds checks.
+ *
+ * Usage:
+ *   FlowField field;
+ *   field.build(map, {{40, 12}, {41, 12}});
+ *   TileCoord next;
+ *   if (field.next(unitPos, next)) { ... move to next ... }
+ */
+class FlowField {
+public:
+    static constexpr uint8_t NO_DIRECTION = GridSearch::NO_DIRECTION;  // Goal, blocked or unreachable tile
+
+    FlowField() = default;
+    ~FlowField() = default;
+
+    // Non-copyable but movable
+    FlowField(const FlowField&) = delete;
+    FlowField& operator=(const FlowField&) = delete;
+    FlowField(FlowField&&) = default;
+    FlowField& operator=(FlowField&&) = default;
+
+    /**
+     * Compute the field for a goal set (blocked or out-of-bounds goals are ignored)
+     * Buffers are reused when the map size is unchanged.
+     */
+    void build(const TileMap& map, const std::vector<TileCoord>& goals);
+
+    int getWidth() const;
+    int getHeight() const;
+    const std::vector<TileCoord>& getGoals() const;
+
+    /**
+     * Number of down/up sweep rounds the last build needed
+     */
+    size_t getSweepCount() const;
+
+    bool isReachable(int x, int y) const;
+
+    /**
+     * Cost to the nearest goal (infinity if unreachable or out of bounds)
+     */
+    float getDistance(int x, int y) const;
+
+    /**
+     * Direction index (into GridSearch::DIRECTION_X/Y) of the first step toward
+     * the nearest goal, or NO_DIRECTION
+     */
+    uint8_t getDirection(int x, int y) const;
+
+    /**
+     * Next tile toward the nearest goal
+     * @return false at a goal or on an unreachable tile
+     */
+    bool next(TileCoord from, TileCoord& to) const;
+
+    /**
+     * Check whether editing an inclusive rectangle can change this field
+     * Only edits on or next to reachable tiles matter; edits inside sealed-off
+     * areas leave every distance unchanged.
+     */
+    bool isAffectedBy(int minX, int minY, int maxX, int maxY) const;
+
+private:
+    size_t index(int x, int y) const;
+    bool inBounds(int x, int y) const;
+    bool isOpen(int x, int y) const;  // Walkable; border tiles read as blocked
+
+    void loadWalkable(const TileMap& map);
+
+    static constexpr uint32_t NOT_SEEN = UINT32_MAX;
+
+    /**
+     * Relax row y from the neighbouring row y + dy (dy = -1 or 1), then along the row
+     * @return true if any distance dropped
+     */
+    bool relaxRow(int y, int dy);
+
+    void computeDirections();
+
+    int width = 0;
+    int height = 0;
+    size_t stride = 0;                  // width + 2 (blocked border columns)
+    std::vector<float> distance;        // (height + 2) x stride
+    std::vector<float> blockedPenalty;  // 0 walkable, infinity blocked or border
+    std::vector<uint8_t> directions;    // Direction index per tile
+    std::vector<uint32_t> rowVersion;   // Bumped when a row changes (indexed y + 1)
+    std::vector<uint32_t> seenAbove;    // rowVersion[y] when row y last relaxed from above
+    std::vector<uint32_t> seenBelow;    // rowVersion[y + 2] when row y last relaxed from below
+    std::vector<TileCoord> goals;
+    size_t sweepCount = 0;
+};
+
+/**
+ * FlowFieldCache - Shared flow fields keyed by goal set
+ *
+ * get() returns the cached field for a goal set (goal order and duplicates
+ * do not matter), building it on a miss and rebuilding it if a tile edit
+ * made it stale. At most getCapacity() fields are kept; the least recently
+ * used one is replaced on a miss. Tile edits arrive through invalidate() or
+ * by subscribing onTilesChanged to TileChangedPayload events on an
+ * EventBus; only fields the edit can affect are marked stale.
+ *
+ * References from get() stay valid until that field is replaced or the
+ * cache is cleared; a stale field is rebuilt in place. Without a map, get()
+ * returns an empty field.
+ *
+ * Usage:
+ *   FlowFieldCache fields(&map);
+ *   bus.subscribe<TileChangedPayload, FlowFieldCache, &FlowFieldCache::onTilesChanged>(&fields);
+ *   const FlowField& toTrain = fields.get(trainTiles);
+ */
+class FlowFieldCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 8;
+
+    /**
+     * Constructor
+     * @param map Tile map (not owned)
+     * @param capacity Maximum number of cached fields
+     */
+    explicit FlowFieldCache(const TileMap* map = nullptr, size_t capacity = DEFAULT_CAPACITY);
+    ~FlowFieldCache() = default;
+
+    // Non-copyable but movable
+    FlowFieldCache(const FlowFieldCache&) = delete;
+    FlowFieldCache& operator=(const FlowFieldCache&) = delete;
+    FlowFieldCache(FlowFieldCache&&) = default;
+    FlowFieldCache& operator=(FlowFieldCache&&) = default;
+
+    /**
+     * Use a different map (drops every cached field)
+     */
+    void setTileMap(const TileMap* map);
+    const TileMap* getTileMap() const;
+
+    /**
+     * Get the field for a goal set, building or rebuilding it if needed
+     */
+    const FlowField& get(const std::vector<TileCoord>& goals);
+    const FlowField& get(TileCoord goal);
+
+    /**
+     * Mark fields affected by an edit of an inclusive rectangle as stale
+     */
+    void invalidate(int minX, int minY, int maxX, int maxY);
+
+    /**
+     * EventBus handler for TileChangedPayload batches
+     */
+    void onTilesChanged(EventView<TileChangedPayload> events);
+
+    void clear();
+
+    size_t size() const;
+    size_t getCapacity() const;
+
+    /**
+     * Number of field builds so far (misses plus stale rebuilds)
+     */
+    size_t getBuildCount() const;
+
+private:
+    struct Entry {
+        std::vector<TileCoord> key;  // Sorted, deduplicated goals
+        FlowField field;
+        uint64_t lastUse = 0;
+        bool stale = false;
+    };
+
+    const TileMap* tileMap;
+    size_t capacity;
+    std::vector<std::unique_ptr<Entry>> entries;
+    std::vector<TileCoord> lookupKey;  // Scratch for get()
+    FlowField emptyField;              // Returned while no map is set
+    uint64_t useCounter = 0;
+    size_t buildCount = 0;
+};
+
+} // namespace ECS
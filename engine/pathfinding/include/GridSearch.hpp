@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * GridSearch - Shared pieces of the grid searches in this module
+ *
+ * All searches use the same movement model: 8-connected, straight steps
+ * cost 1, diagonal steps cost DIAGONAL_COST, no corner cutting. The open
+ * set is a binary heap of OpenNode with lazy deletion (stale duplicates
+ * are skipped when popped).
+ */
+namespace GridSearch {
+
+constexpr float DIAGONAL_COST = 1.41421356f;
+constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+// Step offsets by direction index, straight directions first
+constexpr int DIRECTION_COUNT = 8;
+constexpr uint8_t NO_DIRECTION = 8;
+constexpr int DIRECTION_X[DIRECTION_COUNT] = {1, 0, -1, 0, 1, -1, -1, 1};
+constexpr int DIRECTION_Y[DIRECTION_COUNT] = {0, 1, 0, -1, 1, 1, -1, -1};
+
+/**
+ * Open-set entry for node or cell id
+ */
+struct OpenNode {
+    float f;
+    float h;
+    uint32_t id;
+};
+
+/**
+ * Heap order: lowest f first, ties toward the goal (lowest h)
+ */
+struct OpenNodeCompare {
+    bool operator()(const OpenNode& a, const OpenNode& b) const {
+        if (a.f != b.f) {
+            return a.f > b.f;
+        }
+        return a.h > b.h;
+    }
+};
+
+inline void pushOpen(std::vector<OpenNode>& heap, const OpenNode& node) {
+    heap.push_back(node);
+    std::push_heap(heap.begin(), heap.end(), OpenNodeCompare());
+}
+
+inline OpenNode popOpen(std::vector<OpenNode>& heap) {
+    std::pop_heap(heap.begin(), heap.end(), OpenNodeCompare());
+    OpenNode node = heap.back();
+    heap.pop_back();
+    return node;
+}
+
+/**
+ * Octile distance for an offset (exact cost on an open grid)
+ */
+inline float octileDistance(int dx, int dy) {
+    dx = std::abs(dx);
+    dy = std::abs(dy);
+    int diagonal = std::min(dx, dy);
+    int straight = std::max(dx, dy) - diagonal;
+    return static_cast<float>(straight) + DIAGONAL_COST * static_cast<float>(diagonal);
+}
+
+inline int sign(int value) {
+    return (value > 0) - (value < 0);
+}
+
+} // namespace GridSearch
+
+} // namespace ECS
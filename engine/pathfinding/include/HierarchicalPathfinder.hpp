@@ -0,0 +1,205 @@
+#pragma once
+
+#include "../../physics/include/TileMap.hpp"
+#include "GridSearch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * HierarchicalPath - Abstract route from HierarchicalPathfinder::findPath
+ *
+ * waypoints are the abstract nodes after start, ending at goal. Consecutive
+ * waypoints either share a cluster or sit on opposite sides of a cluster
+ * border, so each segment is refined by a search bounded to one cluster.
+ * refineNext() consumes one segment at a time as the unit advances.
+ */
+struct HierarchicalPath {
+    bool found = false;
+    float cost = 0.0f;                 // Abstract cost (matches the refined steps)
+    TileCoord start;
+    std::vector<TileCoord> waypoints;
+    size_t nextWaypoint = 0;           // First waypoint not yet refined
+
+    bool isComplete() const { return nextWaypoint >= waypoints.size(); }
+};
+
+/**
+ * HierarchicalPathfinder - HPA* over a TileMap for large levels
+ *
+ * The map is cut into square clusters. Where a run of walkable cells faces
+ * another run across a cluster border, an entrance is added (one transition
+ * in the middle of short runs, one at each end of long ones). Each
+ * transition is a pair of abstract nodes, one per side, joined by a cost-1
+ * edge. Nodes in the same cluster are joined by intra-cluster edges whose
+ * costs come from a search bounded to that cluster. A query links start and
+ * goal into their clusters, runs A* on the small abstract graph and returns
+ * waypoints. Cell-level steps are produced lazily per segment. Movement
+ * rules match Pathfinder (8-connected, no corner cutting); paths are
+ * near-optimal, as transitions only sit on chosen border cells.
+ *
+ * Tile changes are repaired locally: onTileChanged() marks the cluster
+ * dirty, and the next query (or repair()) rebuilds only the entrances on
+ * the borders of dirty clusters and the intra edges of clusters touching
+ * them. A refined segment that became blocked makes refineNext() fail so
+ * the caller can re-plan.
+ *
+ * Not thread-safe; search buffers are pooled and reused between queries.
+ *
+ * Usage:
+ *   HierarchicalPathfinder hpa(&map);
+ *   HierarchicalPath route;
+ *   hpa.findPath({2, 3}, {900, 640}, route);
+ *   std::vector<TileCoord> steps;
+ *   while (!route.isComplete() && hpa.refineNext(route, steps)) { ... walk steps ... }
+ */
+class HierarchicalPathfinder {
+public:
+    static constexpr int DEFAULT_CLUSTER_SIZE = 16;
+    static constexpr int MAX_SINGLE_TRANSITION_RUN = 6;  // Longer runs get a transition at each end
+
+    /**
+     * Constructor; builds the abstract graph
+     * @param map Tile map (not owned)
+     * @param clusterSize Cluster edge length in tiles
+     */
+    explicit HierarchicalPathfinder(const TileMap* map = nullptr, int clusterSize = DEFAULT_CLUSTER_SIZE);
+    ~HierarchicalPathfinder() = default;
+
+    // Non-copyable but movable
+    HierarchicalPathfinder(const HierarchicalPathfinder&) = delete;
+    HierarchicalPathfinder& operator=(const HierarchicalPathfinder&) = delete;
+    HierarchicalPathfinder(HierarchicalPathfinder&&) = default;
+    HierarchicalPathfinder& operator=(HierarchicalPathfinder&&) = default;
+
+    /**
+     * Use a different map or cluster size and rebuild from scratch
+     */
+    void setTileMap(const TileMap* map, int clusterSize = DEFAULT_CLUSTER_SIZE);
+    const TileMap* getTileMap() const;
+
+    /**
+     * Rebuild the whole abstract graph
+     */
+    void rebuild();
+
+    /**
+     * Mark the cluster holding a changed tile for repair
+     */
+    void onTileChanged(int x, int y);
+
+    /**
+     * Mark every cluster overlapping an inclusive rectangle for repair
+     */
+    void onAreaChanged(int minX, int minY, int maxX, int maxY);
+
+    /**
+     * Repair dirty clusters now (queries do this automatically)
+     * @return Number of clusters whose intra edges were recomputed
+     */
+    size_t repair();
+
+    bool hasPendingRepairs() const;
+
+    /**
+     * Plan an abstract route
+     * @return path.found
+     */
+    bool findPath(TileCoord start, TileCoord goal, HierarchicalPath& path);
+
+    /**
+     * Refine the next segment of a route into cell steps
+     * Steps are appended to out (the segment's start cell is not included).
+     * @return false if the route is complete, not found, or the segment is now blocked
+     */
+    bool refineNext(HierarchicalPath& path, std::vector<TileCoord>& out);
+
+    int getClusterSize() const;
+    size_t getClusterCount() const;
+    size_t getNodeCount() const;
+
+    /**
+     * Get number of abstract graph edges (intra-cluster and border crossings, each counted once)
+     */
+    size_t getEdgeCount() const;
+
+private:
+    struct Edge {
+        uint32_t target;
+        float cost;
+    };
+
+    struct Node {
+        TileCoord cell;
+        uint32_t cluster = 0;
+        uint32_t partner = GridSearch::NO_PARENT;  // Node across the border (cost-1 edge)
+        bool alive = false;
+        std::vector<Edge> edges;                    // Intra-cluster edges
+    };
+
+    struct Cluster {
+        int minX = 0;
+        int minY = 0;
+        int maxX = 0;  // Inclusive
+        int maxY = 0;
+        std::vector<uint32_t> nodes;
+        std::vector<uint32_t> eastBorder;   // Transition nodes on the border with cluster x + 1 (both sides)
+        std::vector<uint32_t> southBorder;  // Transition nodes on the border with cluster y + 1 (both sides)
+        bool dirty = false;
+    };
+
+    /**
+     * Search buffers for a cluster-bounded search, indexed by local cell
+     */
+    struct LocalSearch {
+        std::vector<float> g;
+        std::vector<uint32_t> parent;
+        std::vector<uint32_t> openStamp;
+        std::vector<uint32_t> closedStamp;
+        std::vector<GridSearch::OpenNode> heap;
+        uint32_t generation = 0;
+    };
+
+    uint32_t clusterIndexAt(int x, int y) const;
+    bool walkable(int x, int y) const;
+
+    void clearBorder(std::vector<uint32_t>& border);
+    void buildEastBorder(uint32_t clusterIndex);
+    void buildSouthBorder(uint32_t clusterIndex);
+    void addTransition(TileCoord a, TileCoord b, std::vector<uint32_t>& border);
+    uint32_t allocateNode(TileCoord cell);
+    void buildIntraEdges(uint32_t clusterIndex);
+
+    /**
+     * Bounded search from source inside a cluster
+     * @param target Stop when this cell is reached (nullptr: Dijkstra over the whole cluster)
+     */
+    void searchCluster(const Cluster& cluster, TileCoord source, const TileCoord* target);
+    float localCost(const Cluster& cluster, TileCoord cell) const;
+    void appendLocalPath(const Cluster& cluster, TileCoord source, TileCoord target, std::vector<TileCoord>& out) const;
+
+    const TileMap* tileMap;
+    int clusterSize;
+    int clustersX = 0;
+    int clustersY = 0;
+    std::vector<Cluster> clusters;
+    std::vector<Node> nodes;
+    std::vector<uint32_t> freeNodes;
+    size_t dirtyCount = 0;
+
+    LocalSearch local;
+
+    // Abstract A* buffers (nodes.size() + start + goal)
+    std::vector<float> abstractG;
+    std::vector<uint32_t> abstractParent;
+    std::vector<uint32_t> abstractOpen;
+    std::vector<uint32_t> abstractClosed;
+    std::vector<GridSearch::OpenNode> abstractHeap;
+    std::vector<Edge> startLinks;
+    std::vector<Edge> goalLinks;
+    uint32_t abstractGeneration = 0;
+};
+
+} // namespace ECS
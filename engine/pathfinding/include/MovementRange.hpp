@@ -0,0 +1,202 @@
+#pragma once
+
+#include "../../physics/include/TileMap.hpp"
+#include "../../physics/include/OccupancyGrid.hpp"
+#include "../../ecs/include/Event.hpp"
+#include "GridSearch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * MovementRange - Tiles a unit can reach within a movement budget
+ *
+ * Bounded Dijkstra from the unit's tile with the module's movement rules
+ * (straight 1, diagonal sqrt(2), no corner cutting). Tiles held or reserved
+ * by other units block; the unit's own tile and reservation do not. As
+ * every step costs at least 1, the search never leaves the box of radius
+ * floor(maxCost) around the origin, and all storage covers just that box:
+ *
+ * - a bitset of reachable tiles, one 64-bit word run per box row, for the
+ *   tactical overlay (walk set bits with count-trailing-zeros)
+ * - the cost to reach each tile
+ * - the direction of the step that reached each tile, so the path to any
+ *   reachable tile is rebuilt without another search
+ *
+ * The origin is part of the range (cost 0). An unwalkable origin gives an
+ * empty range. Buffers are reused across compute() calls.
+ *
+ * Usage:
+ *   MovementRange range;
+ *   range.compute(map, &occupancy, unit, unitPos, 6.0f);
+ *   if (range.contains(x, y)) { range.buildPath({x, y}, steps); }
+ */
+class MovementRange {
+public:
+    static constexpr float COST_EPSILON = 1e-4f;  // Slack for summed diagonal costs against the budget
+
+    MovementRange() = default;
+    ~MovementRange() = default;
+
+    // Non-copyable but movable
+    MovementRange(const MovementRange&) = delete;
+    MovementRange& operator=(const MovementRange&) = delete;
+    MovementRange(MovementRange&&) = default;
+    MovementRange& operator=(MovementRange&&) = default;
+
+    /**
+     * Compute the range
+     * @param occupancy Units that block movement (nullptr: tiles only)
+     * @param self Unit moving; its own occupancy and reservation do not block
+     */
+    void compute(const TileMap& map, const OccupancyGrid* occupancy, EntityID self, TileCoord origin, float maxCost);
+
+    TileCoord getOrigin() const;
+    float getMaxCost() const;
+
+    // Box the range was computed over (map coordinates, inclusive min, size in tiles)
+    int getMinX() const;
+    int getMinY() const;
+    int getWidth() const;
+    int getHeight() const;
+
+    size_t getWordsPerRow() const;
+
+    /**
+     * Reachable bits for box row 0..getHeight()-1 (bit i of word i / 64 is tile getMinX() + i)
+     */
+    const uint64_t* getRow(int row) const;
+
+    bool contains(int x, int y) const;
+
+    /**
+     * Cost to reach a tile (infinity if outside the range)
+     */
+    float getCost(int x, int y) const;
+
+    size_t getReachableCount() const;
+
+    /**
+     * Append every reachable tile, row by row
+     */
+    void collect(std::vector<TileCoord>& out) const;
+
+    /**
+     * Rebuild the cheapest path to a reachable tile
+     * out receives the steps after the origin, ending at target.
+     * @return false if target is outside the range
+     */
+    bool buildPath(TileCoord target, std::vector<TileCoord>& out) const;
+
+    /**
+     * Check whether editing an inclusive rectangle of tiles can change this range
+     * Only edits on or next to reachable tiles matter.
+     */
+    bool isAffectedBy(int minX, int minY, int maxX, int maxY) const;
+
+private:
+    bool inBox(int x, int y) const;
+    size_t boxIndex(int x, int y) const;
+
+    TileCoord origin;
+    float maxCost = 0.0f;
+    int minX = 0;
+    int minY = 0;
+    int width = 0;
+    int height = 0;
+    size_t wordsPerRow = 0;
+    size_t reachableCount = 0;
+    std::vector<uint64_t> bits;
+    std::vector<float> costs;
+    std::vector<uint8_t> parents;   // Direction of the step into the tile (GridSearch::NO_DIRECTION at origin)
+    std::vector<GridSearch::OpenNode> heap;
+};
+
+/**
+ * MovementRangeCache - Movement ranges cached per unit
+ *
+ * get() returns the unit's cached range when origin and budget match and
+ * nothing relevant changed since it was computed, otherwise recomputes it
+ * in place. Relevance:
+ * - tiles: edits arrive through invalidate() or by subscribing
+ *   onTilesChanged to TileChangedPayload events; a range is dropped only
+ *   if the edit is on or next to one of its reachable tiles
+ * - units: the occupancy grid's area version over the range's box is
+ *   compared on get(), so moves elsewhere on the map keep the range
+ *
+ * Call erase() when a unit is destroyed. References from get() stay valid
+ * until that unit's entry is erased or the cache is cleared.
+ *
+ * Usage:
+ *   MovementRangeCache ranges(&map, &occupancy);
+ *   bus.subscribe<TileChangedPayload, MovementRangeCache, &MovementRangeCache::onTilesChanged>(&ranges);
+ *   const MovementRange& range = ranges.get(selected, selectedPos, movePoints);
+ */
+class MovementRangeCache {
+public:
+    /**
+     * Constructor
+     * @param map Tile map (not owned)
+     * @param occupancy Occupancy grid (not owned, optional)
+     */
+    explicit MovementRangeCache(const TileMap* map = nullptr, const OccupancyGrid* occupancy = nullptr);
+    ~MovementRangeCache() = default;
+
+    // Non-copyable but movable
+    MovementRangeCache(const MovementRangeCache&) = delete;
+    MovementRangeCache& operator=(const MovementRangeCache&) = delete;
+    MovementRangeCache(MovementRangeCache&&) = default;
+    MovementRangeCache& operator=(MovementRangeCache&&) = default;
+
+    /**
+     * Use a different map or occupancy grid (drops every cached range)
+     */
+    void setTileMap(const TileMap* map);
+    const TileMap* getTileMap() const;
+    void setOccupancyGrid(const OccupancyGrid* occupancy);
+    const OccupancyGrid* getOccupancyGrid() const;
+
+    /**
+     * Get a unit's range, recomputing it if inputs changed
+     */
+    const MovementRange& get(EntityID unit, TileCoord origin, float maxCost);
+
+    /**
+     * Mark ranges affected by an edit of an inclusive rectangle of tiles as stale
+     */
+    void invalidate(int minX, int minY, int maxX, int maxY);
+
+    /**
+     * EventBus handler for TileChangedPayload batches
+     */
+    void onTilesChanged(EventView<TileChangedPayload> events);
+
+    void erase(EntityID unit);
+    void clear();
+    size_t size() const;
+
+    /**
+     * Number of range computations so far
+     */
+    size_t getComputeCount() const;
+
+private:
+    struct Entry {
+        MovementRange range;
+        uint64_t occupancyVersion = 0;
+        bool stale = true;
+    };
+
+    uint64_t areaVersion(const MovementRange& range) const;
+
+    const TileMap* tileMap;
+    const OccupancyGrid* occupancyGrid;
+    std::unordered_map<EntityID, Entry> entries;
+    MovementRange emptyRange;  // Returned while no map is set
+    size_t computeCount = 0;
+};
+
+} // namespace ECS
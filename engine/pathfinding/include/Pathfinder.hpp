@@ -0,0 +1,140 @@
+#pragma once
+
+#include "../../physics/include/TileMap.hpp"
+#include "../../ecs/systems/include/WorkerPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * PathAlgorithm - Search used for a path request
+ *
+ * AStar:     plain A*, expands every neighbour
+ * JumpPoint: Jump Point Search; same optimal paths on uniform-cost grids,
+ *            but only jump points enter the open set
+ */
+enum class PathAlgorithm : uint8_t {
+    AStar = 0,
+    JumpPoint
+};
+
+/**
+ * PathRequest - One start/goal query
+ */
+struct PathRequest {
+    TileCoord start;
+    TileCoord goal;
+    PathAlgorithm algorithm = PathAlgorithm::JumpPoint;
+};
+
+/**
+ * PathResult - Outcome of a path query
+ * path holds every cell to step through after start, ending at goal
+ * (empty when start == goal). Reusing a result keeps the path capacity.
+ */
+struct PathResult {
+    bool found = false;
+    float cost = 0.0f;          // Straight steps cost 1, diagonal steps sqrt(2)
+    size_t expanded = 0;        // Nodes popped from the open set
+    std::vector<TileCoord> path;
+};
+
+/**
+ * Pathfinder - A* / Jump Point Search over a TileMap
+ *
+ * Movement is 8-connected with uniform cost and no corner cutting: a
+ * diagonal step needs both adjacent orthogonal tiles walkable. The
+ * heuristic is octile distance, so both algorithms return optimal paths.
+ *
+ * Search state lives in pooled contexts sized to the map: g-scores,
+ * parents and generation stamps (bumping the generation "clears" a
+ * context in O(1)) plus a binary heap that keeps its capacity. After the
+ * first query on a map, queries allocate nothing beyond growth of the
+ * caller's result path.
+ *
+ * JPS scans horizontal jumps a row word (64 tiles) at a time on the tile
+ * map's bit planes: walls, forced neighbours from the rows above and below
+ * and the goal are masks, and the first hit is found with
+ * count-trailing/leading-zeros. Vertical jumps read three bits per row.
+ *
+ * findPaths() solves a batch on the injected WorkerPool, one context per
+ * concurrently running thread. The tile map must not change during a
+ * query.
+ *
+ * Usage:
+ *   WorkerPool pool(3);
+ *   Pathfinder pathfinder(&map, &pool);
+ *   PathResult result;
+ *   pathfinder.findPath(PathRequest{{1, 1}, {40, 12}}, result);
+ *   pathfinder.findPaths(requests, results);
+ */
+class Pathfinder {
+public:
+    /**
+     * Constructor with dependency injection
+     * @param map Tile map to search (not owned)
+     * @param pool Worker pool for findPaths (not owned; nullptr runs batches inline)
+     */
+    explicit Pathfinder(const TileMap* map = nullptr, WorkerPool* pool = nullptr);
+    ~Pathfinder();
+
+    // Non-copyable and non-movable (contexts are handed to worker threads)
+    Pathfinder(const Pathfinder&) = delete;
+    Pathfinder& operator=(const Pathfinder&) = delete;
+
+    void setTileMap(const TileMap* map);
+    const TileMap* getTileMap() const;
+    void setWorkerPool(WorkerPool* pool);
+    WorkerPool* getWorkerPool() const;
+
+    /**
+     * Solve one request on the calling thread
+     * Not safe to call concurrently with itself or findPaths().
+     * @return result.found
+     */
+    bool findPath(const PathRequest& request, PathResult& result);
+
+    /**
+     * Solve a batch of requests across the worker pool
+     * @param results Resized to requests.size(); results[i] answers requests[i]
+     */
+    void findPaths(const std::vector<PathRequest>& requests, std::vector<PathResult>& results);
+
+    /**
+     * Octile distance between two cells (admissible heuristic for 8-connected grids)
+     */
+    static float octileDistance(TileCoord a, TileCoord b);
+
+private:
+    struct SearchContext;
+
+    SearchContext& acquireContext();
+    void releaseContext(SearchContext& context);
+    void solve(SearchContext& context, const PathRequest& request, PathResult& result) const;
+    void solveAStar(SearchContext& context, uint32_t startCell, uint32_t goalCell, PathResult& result) const;
+    void solveJumpPoint(SearchContext& context, uint32_t startCell, uint32_t goalCell, PathResult& result) const;
+    bool jump(int x, int y, int dx, int dy, TileCoord goal, TileCoord& jumpPoint) const;
+    bool jumpHorizontal(int x, int y, int dx, TileCoord goal, TileCoord& jumpPoint) const;
+    bool jumpVertical(int x, int y, int dy, TileCoord goal, TileCoord& jumpPoint) const;
+
+    /**
+     * Walkable bits (Traversable & ~Blocked) of one row word, 0 outside the map
+     */
+    uint64_t walkableWord(int y, long word) const;
+
+    /**
+     * Walkable bits of tiles x - 1, x, x + 1 in row y (bit 0 = x - 1)
+     */
+    uint32_t walkableTriple(int x, int y) const;
+    bool walkable(int x, int y) const;
+    void buildPath(const SearchContext& context, uint32_t startCell, uint32_t goalCell, PathResult& result) const;
+
+    const TileMap* tileMap;
+    WorkerPool* workerPool;
+    std::vector<std::unique_ptr<SearchContext>> contexts;
+};
+
+} // namespace ECS
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "../../physics/include/TileMap.hpp"
+#include <cstdint>
+
+namespace ECS {
+
+/**
+ * RandomGrid - Deterministic random maps and queries
+ *
+ * Used by the tests, benchmarks and the headless runner. A fixed LCG keeps
+ * obstacle layouts and query lists identical across platforms and standard
+ * libraries, so seeded runs and expected counts stay reproducible. Helpers
+ * advance the caller's state, so one seed can drive a map and then the
+ * queries on it.
+ */
+namespace RandomGrid {
+
+/**
+ * Advance state and return the next value (24 bits)
+ */
+inline uint32_t nextRandom(uint32_t& state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+/**
+ * Next value in [0, limit)
+ */
+inline int randomBelow(uint32_t& state, int limit) {
+    return static_cast<int>(nextRandom(state) % static_cast<uint32_t>(limit));
+}
+
+/**
+ * Block about percent of the tiles, one draw per tile in row order
+ */
+inline void scatterWalls(TileMap& map, uint32_t& state, int percent) {
+    for (int y = 0; y < map.getHeight(); ++y) {
+        for (int x = 0; x < map.getWidth(); ++x) {
+            if (randomBelow(state, 100) < percent) {
+                map.set(x, y, TileFlag::Blocked);
+            }
+        }
+    }
+}
+
+} // namespace RandomGrid
+
+} // namespace ECS
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "../../ecs/include/Entity.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+namespace ECS {
+
+/**
+ * ReservationTable - Space-time reservations keyed by (cell, tick)
+ *
+ * Records which unit will stand on a cell at a given tick of a turn, so
+ * units planned later route around units planned earlier. Besides single
+ * (cell, tick) slots, a unit can be parked on a cell from some tick on
+ * (a unit that reached its goal, or one that cannot move this turn); a
+ * parked cell is held for every later tick.
+ *
+ * Slots live in a hash map keyed by cell index and tick, so memory follows
+ * the number of reservations rather than map size times window length.
+ *
+ * Usage:
+ *   ReservationTable table(map.getWidth(), map.getHeight());
+ *   table.reserve(3, 4, 2, unit);          // unit on (3, 4) at tick 2
+ *   table.park(9, 4, 5, unit);             // unit stays on (9, 4) from tick 5
+ *   bool ok = table.isFree(3, 4, 2, other); // false
+ */
+class ReservationTable {
+public:
+    /**
+     * Constructor
+     * @param width Map width in cells
+     * @param height Map height in cells
+     */
+    ReservationTable(int width = 0, int height = 0);
+    ~ReservationTable() = default;
+
+    // Non-copyable but movable
+    ReservationTable(const ReservationTable&) = delete;
+    ReservationTable& operator=(const ReservationTable&) = delete;
+    ReservationTable(ReservationTable&&) = default;
+    ReservationTable& operator=(ReservationTable&&) = default;
+
+    /**
+     * Clear and resize for a map
+     */
+    void reset(int width, int height);
+
+    int getWidth() const;
+    int getHeight() const;
+
+    /**
+     * Reserve a cell at one tick
+     * @return false if another unit holds it (the slot is unchanged)
+     */
+    bool reserve(int x, int y, int tick, EntityID unit);
+
+    /**
+     * Drop a slot (no-op unless held by unit)
+     */
+    void release(int x, int y, int tick, EntityID unit);
+
+    /**
+     * Hold a cell for a unit at every tick from fromTick on
+     * @return false if another unit is parked there
+     */
+    bool park(int x, int y, int fromTick, EntityID unit);
+
+    /**
+     * Drop a parked cell (no-op unless parked by unit)
+     */
+    void unpark(int x, int y, EntityID unit);
+
+    /**
+     * Get the unit holding a cell at a tick (slot or parked), INVALID_ENTITY if none
+     */
+    EntityID getHolder(int x, int y, int tick) const;
+
+    /**
+     * Check that no unit other than self holds a cell at a tick
+     * Cells outside the map are never free.
+     */
+    bool isFree(int x, int y, int tick, EntityID self) const;
+
+    /**
+     * Check that no unit other than self is parked on a cell at any tick
+     */
+    bool isUnparked(int x, int y, EntityID self) const;
+
+    /**
+     * Get number of (cell, tick) slots in use (parked cells not included)
+     */
+    size_t getSlotCount() const;
+
+    /**
+     * Get number of parked cells
+     */
+    size_t getParkedCount() const;
+
+    void clear();
+
+private:
+    struct Parked {
+        EntityID unit;
+        int fromTick;
+    };
+
+    bool inBounds(int x, int y) const;
+    uint32_t cellIndex(int x, int y) const;
+    static uint64_t slotKey(uint32_t cell, int tick);
+
+    int width;
+    int height;
+    std::unordered_map<uint64_t, EntityID> slots;
+    std::unordered_map<uint32_t, Parked> parked;
+};
+
+} // namespace ECS
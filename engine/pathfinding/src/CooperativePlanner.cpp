@@ -0,0 +1,331 @@
+#include "../include/CooperativePlanner.hpp"
+#include <algorithm>
+
+namespace ECS {
+
+using GridSearch::DIAGONAL_COST;
+using GridSearch::DIRECTION_COUNT;
+using GridSearch::DIRECTION_X;
+using GridSearch::DIRECTION_Y;
+using GridSearch::NO_PARENT;
+using GridSearch::OpenNode;
+
+// Largest state id must stay below NO_PARENT
+static_assert(static_cast<uint64_t>(2 * CooperativePlanner::MAX_WINDOW + 1) * (2 * CooperativePlanner::MAX_WINDOW + 1) *
+                  (CooperativePlanner::MAX_WINDOW + 1) < NO_PARENT,
+              "CooperativePlanner::MAX_WINDOW overflows 32-bit state ids");
+
+CooperativePlanner::CooperativePlanner(const TileMap* map, int window)
+    : map(map)
+    , window(std::clamp(window, 1, MAX_WINDOW)) {
+}
+
+void CooperativePlanner::setTileMap(const TileMap* tileMap) {
+    map = tileMap;
+}
+
+const TileMap* CooperativePlanner::getTileMap() const {
+    return map;
+}
+
+void CooperativePlanner::setOccupancyGrid(const OccupancyGrid* grid) {
+    occupancy = grid;
+}
+
+const OccupancyGrid* CooperativePlanner::getOccupancyGrid() const {
+    return occupancy;
+}
+
+void CooperativePlanner::setWindow(int ticks) {
+    window = std::clamp(ticks, 1, MAX_WINDOW);
+}
+
+int CooperativePlanner::getWindow() const {
+    return window;
+}
+
+void CooperativePlanner::plan(const std::vector<QueuedMove>& moves, std::vector<CooperativePlan>& plans) {
+    planBatch(moves, occupancy, plans);
+}
+
+size_t CooperativePlanner::resolveTurn(MovementSystem& movement) {
+    movement.getQueuedMoves(queued);
+    if (!map || queued.empty()) {
+        lastPlans.clear();
+        return 0;
+    }
+    planBatch(queued, movement.getOccupancyGrid(), lastPlans);
+
+    size_t started = 0;
+    for (const CooperativePlan& plan : lastPlans) {
+        if (plan.reachedGoal) {
+            movement.cancelQueuedMovement(plan.unit);
+        }
+        if (!plan.steps.empty() && movement.requestGridPath(plan.unit, plan.steps)) {
+            started++;
+        }
+    }
+    return started;
+}
+
+const ReservationTable& CooperativePlanner::getReservations() const {
+    return reservations;
+}
+
+const std::vector<CooperativePlan>& CooperativePlanner::getPlans() const {
+    return lastPlans;
+}
+
+size_t CooperativePlanner::getExpandedCount() const {
+    return expandedCount;
+}
+
+size_t CooperativePlanner::getReplanCount() const {
+    return replanCount;
+}
+
+void CooperativePlanner::planBatch(const std::vector<QueuedMove>& moves, const OccupancyGrid* grid,
+                                   std::vector<CooperativePlan>& plans) {
+    expandedCount = 0;
+    replanCount = 0;
+    plans.resize(moves.size());
+    for (size_t i = 0; i < moves.size(); ++i) {
+        plans[i].unit = moves[i].entityId;
+        plans[i].steps.clear();
+        plans[i].reachedGoal = false;
+        plans[i].stuck = false;
+    }
+    if (!map) {
+        return;
+    }
+
+    batchOccupancy = grid;
+    reservations.reset(map->getWidth(), map->getHeight());
+    batchUnits.clear();
+    for (const QueuedMove& move : moves) {
+        batchUnits.push_back(move.entityId);
+        reservations.reserve(move.from.x, move.from.y, 0, move.entityId);
+        reservations.reserve(move.from.x, move.from.y, 1, move.entityId);
+    }
+    std::sort(batchUnits.begin(), batchUnits.end());
+
+    // Plan in priority order; a stuck unit sends the routes through its cell
+    // back to the queue, and the cursor rewinds to the first of them
+    std::vector<bool> pending(moves.size(), true);
+    size_t cursor = 0;
+    while (cursor < moves.size()) {
+        if (!pending[cursor]) {
+            cursor++;
+            continue;
+        }
+        size_t current = cursor;
+        pending[current] = false;
+        const QueuedMove& move = moves[current];
+        CooperativePlan& plan = plans[current];
+        if (search(move, plan)) {
+            reservePlan(move, plan);
+            cursor++;
+            continue;
+        }
+
+        plan.stuck = true;
+        for (size_t other = 0; other < moves.size(); ++other) {
+            if (other == current || pending[other] || plans[other].stuck) {
+                continue;
+            }
+            const std::vector<TileCoord>& steps = plans[other].steps;
+            if (std::find(steps.begin(), steps.end(), move.from) == steps.end()) {
+                continue;
+            }
+            releasePlan(moves[other], plans[other]);
+            plans[other].steps.clear();
+            plans[other].reachedGoal = false;
+            pending[other] = true;
+            replanCount++;
+            cursor = std::min(cursor, other);
+        }
+        reservations.park(move.from.x, move.from.y, 0, move.entityId);
+        if (cursor == current) {
+            cursor++;
+        }
+    }
+    batchOccupancy = nullptr;
+}
+
+bool CooperativePlanner::search(const QueuedMove& move, CooperativePlan& plan) {
+    plan.steps.clear();
+    plan.reachedGoal = false;
+    EntityID self = move.entityId;
+    TileCoord start = move.from;
+    TileCoord goal = move.to;
+    if (!map->isWalkable(start.x, start.y)) {
+        return false;
+    }
+
+    boxMinX = std::max(start.x - window, 0);
+    boxMinY = std::max(start.y - window, 0);
+    boxWidth = std::min(start.x + window, map->getWidth() - 1) - boxMinX + 1;
+    boxHeight = std::min(start.y + window, map->getHeight() - 1) - boxMinY + 1;
+    size_t boxCells = static_cast<size_t>(boxWidth) * static_cast<size_t>(boxHeight);
+    size_t states = boxCells * static_cast<size_t>(window + 1);
+    if (costs.size() < states) {
+        costs.resize(states);
+        parents.resize(states);
+        seen.resize(states, 0);
+        closed.resize(states, 0);
+    }
+    if (++searchStamp == 0) {
+        std::fill(seen.begin(), seen.end(), 0);
+        std::fill(closed.begin(), closed.end(), 0);
+        searchStamp = 1;
+    }
+    heap.clear();
+
+    auto stateId = [&](int x, int y, int tick) {
+        return static_cast<uint32_t>(static_cast<size_t>(tick) * boxCells +
+                                     static_cast<size_t>(y - boxMinY) * static_cast<size_t>(boxWidth) +
+                                     static_cast<size_t>(x - boxMinX));
+    };
+    auto heuristic = [&](int x, int y) {
+        return GridSearch::octileDistance(goal.x - x, goal.y - y);
+    };
+
+    uint32_t startId = stateId(start.x, start.y, 0);
+    costs[startId] = 0.0f;
+    parents[startId] = NO_PARENT;
+    seen[startId] = searchStamp;
+    GridSearch::pushOpen(heap, OpenNode{heuristic(start.x, start.y), heuristic(start.x, start.y), startId});
+
+    uint32_t found = NO_PARENT;
+    uint32_t partial = NO_PARENT;
+    float partialH = 0.0f;
+    while (!heap.empty()) {
+        OpenNode node = GridSearch::popOpen(heap);
+        uint32_t id = node.id;
+        if (closed[id] == searchStamp) {
+            continue;
+        }
+        closed[id] = searchStamp;
+        expandedCount++;
+
+        int tick = static_cast<int>(id / boxCells);
+        size_t cell = id % boxCells;
+        int x = boxMinX + static_cast<int>(cell % static_cast<size_t>(boxWidth));
+        int y = boxMinY + static_cast<int>(cell / static_cast<size_t>(boxWidth));
+        if (x == goal.x && y == goal.y && canPark(x, y, tick, self)) {
+            found = id;
+            break;
+        }
+        if (tick == window) {
+            // Window end: keep the state closest to the goal (f order makes the first the cheapest)
+            if (partial == NO_PARENT || node.h < partialH) {
+                partial = id;
+                partialH = node.h;
+            }
+            continue;
+        }
+
+        for (int direction = -1; direction < DIRECTION_COUNT; ++direction) {
+            int dx = direction < 0 ? 0 : DIRECTION_X[direction];
+            int dy = direction < 0 ? 0 : DIRECTION_Y[direction];
+            int nx = x + dx;
+            int ny = y + dy;
+            if (direction >= 0) {
+                if (nx < boxMinX || ny < boxMinY || nx >= boxMinX + boxWidth || ny >= boxMinY + boxHeight ||
+                    !map->isWalkable(nx, ny) || isStaticBlocked(nx, ny, self)) {
+                    continue;
+                }
+                if (dx != 0 && dy != 0 && (!map->isWalkable(x + dx, y) || !map->isWalkable(x, y + dy))) {
+                    continue;
+                }
+            }
+            if (!canStand(nx, ny, tick + 1, self)) {
+                continue;
+            }
+
+            uint32_t next = stateId(nx, ny, tick + 1);
+            float stepCost = direction < 0 ? WAIT_COST : ((dx != 0 && dy != 0) ? DIAGONAL_COST : 1.0f);
+            float cost = costs[id] + stepCost;
+            if (seen[next] == searchStamp && cost >= costs[next]) {
+                continue;
+            }
+            seen[next] = searchStamp;
+            costs[next] = cost;
+            parents[next] = id;
+            float h = heuristic(nx, ny);
+            GridSearch::pushOpen(heap, OpenNode{cost + h, h, next});
+        }
+    }
+
+    uint32_t last = found != NO_PARENT ? found : partial;
+    if (last == NO_PARENT) {
+        return false;
+    }
+    plan.reachedGoal = found != NO_PARENT;
+    for (uint32_t id = last; parents[id] != NO_PARENT; id = parents[id]) {
+        size_t cell = id % boxCells;
+        plan.steps.push_back({boxMinX + static_cast<int>(cell % static_cast<size_t>(boxWidth)),
+                              boxMinY + static_cast<int>(cell / static_cast<size_t>(boxWidth))});
+    }
+    std::reverse(plan.steps.begin(), plan.steps.end());
+
+    // Waiting on the final cell is implied by parking there
+    while (!plan.steps.empty() &&
+           plan.steps.back() == (plan.steps.size() > 1 ? plan.steps[plan.steps.size() - 2] : start)) {
+        plan.steps.pop_back();
+    }
+    return true;
+}
+
+bool CooperativePlanner::isStaticBlocked(int x, int y, EntityID self) const {
+    if (!batchOccupancy) {
+        return false;
+    }
+    auto blocks = [&](EntityID unit) {
+        return unit != INVALID_ENTITY && unit != self &&
+               !std::binary_search(batchUnits.begin(), batchUnits.end(), unit);
+    };
+    return blocks(batchOccupancy->getOccupant(x, y)) || blocks(batchOccupancy->getReservation(x, y));
+}
+
+bool CooperativePlanner::canStand(int x, int y, int tick, EntityID self) const {
+    return reservations.isFree(x, y, tick, self) && reservations.isFree(x, y, tick + 1, self);
+}
+
+bool CooperativePlanner::canPark(int x, int y, int tick, EntityID self) const {
+    if (!reservations.isUnparked(x, y, self)) {
+        return false;
+    }
+    for (int t = tick; t <= window + 1; ++t) {
+        if (!reservations.isFree(x, y, t, self)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CooperativePlanner::reservePlan(const QueuedMove& move, const CooperativePlan& plan) {
+    TileCoord at = move.from;
+    for (size_t tick = 0; tick < plan.steps.size(); ++tick) {
+        reservations.reserve(at.x, at.y, static_cast<int>(tick), move.entityId);
+        reservations.reserve(at.x, at.y, static_cast<int>(tick) + 1, move.entityId);
+        at = plan.steps[tick];
+    }
+    reservations.park(at.x, at.y, static_cast<int>(plan.steps.size()), move.entityId);
+}
+
+void CooperativePlanner::releasePlan(const QueuedMove& move, const CooperativePlan& plan) {
+    TileCoord at = move.from;
+    for (size_t tick = 0; tick < plan.steps.size(); ++tick) {
+        reservations.release(at.x, at.y, static_cast<int>(tick), move.entityId);
+        reservations.release(at.x, at.y, static_cast<int>(tick) + 1, move.entityId);
+        at = plan.steps[tick];
+    }
+    reservations.unpark(at.x, at.y, move.entityId);
+
+    // Back to holding the start cell at tick 0, as before it was planned
+    reservations.reserve(move.from.x, move.from.y, 0, move.entityId);
+    reservations.reserve(move.from.x, move.from.y, 1, move.entityId);
+}
+
+} // namespace ECS
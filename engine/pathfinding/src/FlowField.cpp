@@ -0,0 +1,321 @@
+#include "../include/FlowField.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace ECS {
+
+using GridSearch::DIAGONAL_COST;
+using GridSearch::DIRECTION_COUNT;
+using GridSearch::DIRECTION_X;
+using GridSearch::DIRECTION_Y;
+
+namespace {
+
+constexpr float UNREACHABLE = std::numeric_limits<float>::infinity();
+
+bool coordLess(const TileCoord& a, const TileCoord& b) {
+    return a.y != b.y ? a.y < b.y : a.x < b.x;
+}
+
+} // namespace
+
+void FlowField::build(const TileMap& map, const std::vector<TileCoord>& goalTiles) {
+    width = map.getWidth();
+    height = map.getHeight();
+    stride = static_cast<size_t>(width) + 2;
+    size_t cells = stride * (static_cast<size_t>(height) + 2);
+    distance.assign(cells, UNREACHABLE);
+    blockedPenalty.resize(cells);
+    directions.assign(cells, NO_DIRECTION);
+    goals = goalTiles;
+    sweepCount = 0;
+    rowVersion.assign(static_cast<size_t>(height) + 2, 0);
+    seenAbove.assign(static_cast<size_t>(height) + 2, NOT_SEEN);
+    seenBelow.assign(static_cast<size_t>(height) + 2, NOT_SEEN);
+
+    loadWalkable(map);
+
+    bool seeded = false;
+    for (const TileCoord& goal : goals) {
+        if (inBounds(goal.x, goal.y) && blockedPenalty[index(goal.x, goal.y)] == 0.0f) {
+            distance[index(goal.x, goal.y)] = 0.0f;
+            seeded = true;
+        }
+    }
+    if (!seeded) {
+        return;
+    }
+
+    // Alternate downward and upward sweeps until a round changes nothing
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int y = 0; y < height; ++y) {
+            changed |= relaxRow(y, -1);
+        }
+        for (int y = height - 1; y >= 0; --y) {
+            changed |= relaxRow(y, 1);
+        }
+        sweepCount++;
+    }
+
+    computeDirections();
+}
+
+int FlowField::getWidth() const {
+    return width;
+}
+
+int FlowField::getHeight() const {
+    return height;
+}
+
+const std::vector<TileCoord>& FlowField::getGoals() const {
+    return goals;
+}
+
+size_t FlowField::getSweepCount() const {
+    return sweepCount;
+}
+
+bool FlowField::isReachable(int x, int y) const {
+    return inBounds(x, y) && distance[index(x, y)] != UNREACHABLE;
+}
+
+float FlowField::getDistance(int x, int y) const {
+    return inBounds(x, y) ? distance[index(x, y)] : UNREACHABLE;
+}
+
+uint8_t FlowField::getDirection(int x, int y) const {
+    return inBounds(x, y) ? directions[index(x, y)] : NO_DIRECTION;
+}
+
+bool FlowField::next(TileCoord from, TileCoord& to) const {
+    uint8_t direction = getDirection(from.x, from.y);
+    if (direction == NO_DIRECTION) {
+        return false;
+    }
+    to = TileCoord{from.x + DIRECTION_X[direction], from.y + DIRECTION_Y[direction]};
+    return true;
+}
+
+bool FlowField::isAffectedBy(int minX, int minY, int maxX, int maxY) const {
+    // A requested goal inside the edit may have become usable (or unusable)
+    for (const TileCoord& goal : goals) {
+        if (goal.x >= minX && goal.x <= maxX && goal.y >= minY && goal.y <= maxY) {
+            return true;
+        }
+    }
+
+    // Otherwise the edit matters only if it touches a reachable tile
+    minX = std::max(minX - 1, 0);
+    minY = std::max(minY - 1, 0);
+    maxX = std::min(maxX + 1, width - 1);
+    maxY = std::min(maxY + 1, height - 1);
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
+            if (distance[index(x, y)] != UNREACHABLE) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+size_t FlowField::index(int x, int y) const {
+    return static_cast<size_t>(y + 1) * stride + static_cast<size_t>(x + 1);
+}
+
+bool FlowField::inBounds(int x, int y) const {
+    return x >= 0 && y >= 0 && x < width && y < height;
+}
+
+bool FlowField::isOpen(int x, int y) const {
+    return blockedPenalty[index(x, y)] == 0.0f;
+}
+
+void FlowField::loadWalkable(const TileMap& map) {
+    std::fill(blockedPenalty.begin(), blockedPenalty.end(), UNREACHABLE);
+    for (int y = 0; y < height; ++y) {
+        const uint64_t* traversable = map.getRow(TileFlag::Traversable, y);
+        const uint64_t* blocked = map.getRow(TileFlag::Blocked, y);
+        float* row = &blockedPenalty[index(0, y)];
+        for (int x = 0; x < width; x += 64) {
+            uint64_t word = traversable[x / 64] & ~blocked[x / 64];
+            int end = std::min(width - x, 64);
+            for (int bit = 0; bit < end; ++bit) {
+                row[x + bit] = ((word >> bit) & 1u) ? 0.0f : UNREACHABLE;
+            }
+        }
+    }
+}
+
+bool FlowField::relaxRow(int y, int dy) {
+    // Skip if the source row has not changed since this row last relaxed from it
+    uint32_t sourceVersion = rowVersion[static_cast<size_t>(y + dy + 1)];
+    uint32_t& seen = dy < 0 ? seenAbove[static_cast<size_t>(y + 1)] : seenBelow[static_cast<size_t>(y + 1)];
+    if (seen == sourceVersion) {
+        return false;
+    }
+    seen = sourceVersion;
+
+    float* row = &distance[index(0, y)];
+    const float* source = &distance[index(0, y + dy)];
+    const float* penalty = &blockedPenalty[index(0, y)];
+    const float* sourcePenalty = &blockedPenalty[index(0, y + dy)];
+
+    // From the neighbouring row: independent per x and branch-free (adds and mins only)
+    // so it vectorizes. Adding a penalty of infinity rules out blocked tiles and corner cuts.
+    unsigned changed = 0;
+    for (int x = 0; x < width; ++x) {
+        float current = row[x];
+        float straight = source[x] + 1.0f;
+        float fromLeft = source[x - 1] + DIAGONAL_COST + penalty[x - 1] + sourcePenalty[x];
+        float fromRight = source[x + 1] + DIAGONAL_COST + penalty[x + 1] + sourcePenalty[x];
+        float best = straight < current ? straight : current;
+        best = fromLeft < best ? fromLeft : best;
+        best = fromRight < best ? fromRight : best;
+        best += penalty[x];
+        changed |= static_cast<unsigned>(best < current);
+        row[x] = best;
+    }
+
+    // Along the row: serial, blocked tiles stay unreachable and stop the scan
+    for (int x = 1; x < width; ++x) {
+        float candidate = row[x - 1] + 1.0f;
+        if (penalty[x] == 0.0f && candidate < row[x]) {
+            row[x] = candidate;
+            changed = 1;
+        }
+    }
+    for (int x = width - 2; x >= 0; --x) {
+        float candidate = row[x + 1] + 1.0f;
+        if (penalty[x] == 0.0f && candidate < row[x]) {
+            row[x] = candidate;
+            changed = 1;
+        }
+    }
+    if (changed != 0) {
+        rowVersion[static_cast<size_t>(y + 1)]++;
+    }
+    return changed != 0;
+}
+
+void FlowField::computeDirections() {
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            size_t cell = index(x, y);
+            if (distance[cell] == 0.0f || distance[cell] == UNREACHABLE) {
+                continue;
+            }
+            float best = UNREACHABLE;
+            uint8_t bestDirection = NO_DIRECTION;
+            for (uint8_t direction = 0; direction < DIRECTION_COUNT; ++direction) {
+                int dx = DIRECTION_X[direction];
+                int dy = DIRECTION_Y[direction];
+                if (!isOpen(x + dx, y + dy)) {
+                    continue;
+                }
+                bool diagonal = dx != 0 && dy != 0;
+                if (diagonal && (!isOpen(x + dx, y) || !isOpen(x, y + dy))) {
+                    continue; // No corner cutting
+                }
+                float cost = distance[index(x + dx, y + dy)] + (diagonal ? DIAGONAL_COST : 1.0f);
+                if (cost < best) {
+                    best = cost;
+                    bestDirection = direction;
+                }
+            }
+            directions[cell] = bestDirection;
+        }
+    }
+}
+
+FlowFieldCache::FlowFieldCache(const TileMap* map, size_t capacity)
+    : tileMap(map)
+    , capacity(std::max(capacity, size_t{1})) {
+}
+
+void FlowFieldCache::setTileMap(const TileMap* map) {
+    tileMap = map;
+    entries.clear();
+}
+
+const TileMap* FlowFieldCache::getTileMap() const {
+    return tileMap;
+}
+
+const FlowField& FlowFieldCache::get(const std::vector<TileCoord>& goals) {
+    if (!tileMap) {
+        return emptyField;
+    }
+    lookupKey = goals;
+    std::sort(lookupKey.begin(), lookupKey.end(), coordLess);
+    lookupKey.erase(std::unique(lookupKey.begin(), lookupKey.end()), lookupKey.end());
+
+    for (auto& entry : entries) {
+        if (entry->key == lookupKey) {
+            if (entry->stale) {
+                entry->field.build(*tileMap, entry->key);
+                entry->stale = false;
+                buildCount++;
+            }
+            entry->lastUse = ++useCounter;
+            return entry->field;
+        }
+    }
+
+    // Miss: add an entry, or reuse the least recently used one (keeps its buffers)
+    Entry* entry = nullptr;
+    if (entries.size() < capacity) {
+        entries.push_back(std::make_unique<Entry>());
+        entry = entries.back().get();
+    } else {
+        entry = std::min_element(entries.begin(), entries.end(),
+            [](const std::unique_ptr<Entry>& a, const std::unique_ptr<Entry>& b) {
+                return a->lastUse < b->lastUse;
+            })->get();
+    }
+    entry->key.swap(lookupKey);
+    entry->lastUse = ++useCounter;
+    entry->stale = false;
+    entry->field.build(*tileMap, entry->key);
+    buildCount++;
+    return entry->field;
+}
+
+const FlowField& FlowFieldCache::get(TileCoord goal) {
+    return get(std::vector<TileCoord>{goal});
+}
+
+void FlowFieldCache::invalidate(int minX, int minY, int maxX, int maxY) {
+    for (auto& entry : entries) {
+        if (!entry->stale && entry->field.isAffectedBy(minX, minY, maxX, maxY)) {
+            entry->stale = true;
+        }
+    }
+}
+
+void FlowFieldCache::onTilesChanged(EventView<TileChangedPayload> events) {
+    for (const auto& event : events) {
+        invalidate(event.payload.minX, event.payload.minY, event.payload.maxX, event.payload.maxY);
+    }
+}
+
+void FlowFieldCache::clear() {
+    entries.clear();
+}
+
+size_t FlowFieldCache::size() const {
+    return entries.size();
+}
+
+size_t FlowFieldCache::getCapacity() const {
+    return capacity;
+}
+
+size_t FlowFieldCache::getBuildCount() const {
+    return buildCount;
+}
+
+} // namespace ECS
@@ -0,0 +1,565 @@
+#include "../include/HierarchicalPathfinder.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace ECS {
+
+using GridSearch::DIAGONAL_COST;
+using GridSearch::NO_PARENT;
+using GridSearch::OpenNode;
+
+namespace {
+
+constexpr float UNREACHABLE = std::numeric_limits<float>::infinity();
+
+/**
+ * Bump a stamp generation, clearing the stamp arrays on wrap-around
+ */
+void nextGeneration(uint32_t& generation, std::vector<uint32_t>& open, std::vector<uint32_t>& closed) {
+    if (++generation == 0) {
+        std::fill(open.begin(), open.end(), 0u);
+        std::fill(closed.begin(), closed.end(), 0u);
+        generation = 1;
+    }
+}
+
+} // namespace
+
+HierarchicalPathfinder::HierarchicalPathfinder(const TileMap* map, int clusterSize)
+    : tileMap(map)
+    , clusterSize(std::max(clusterSize, 1)) {
+    rebuild();
+}
+
+void HierarchicalPathfinder::setTileMap(const TileMap* map, int size) {
+    tileMap = map;
+    clusterSize = std::max(size, 1);
+    rebuild();
+}
+
+const TileMap* HierarchicalPathfinder::getTileMap() const {
+    return tileMap;
+}
+
+void HierarchicalPathfinder::rebuild() {
+    clusters.clear();
+    nodes.clear();
+    freeNodes.clear();
+    dirtyCount = 0;
+    clustersX = 0;
+    clustersY = 0;
+    if (!tileMap || tileMap->getWidth() == 0 || tileMap->getHeight() == 0) {
+        return;
+    }
+
+    clustersX = (tileMap->getWidth() + clusterSize - 1) / clusterSize;
+    clustersY = (tileMap->getHeight() + clusterSize - 1) / clusterSize;
+    clusters.resize(static_cast<size_t>(clustersX) * static_cast<size_t>(clustersY));
+    for (int cy = 0; cy < clustersY; ++cy) {
+        for (int cx = 0; cx < clustersX; ++cx) {
+            Cluster& cluster = clusters[static_cast<size_t>(cy * clustersX + cx)];
+            cluster.minX = cx * clusterSize;
+            cluster.minY = cy * clusterSize;
+            cluster.maxX = std::min(cluster.minX + clusterSize, tileMap->getWidth()) - 1;
+            cluster.maxY = std::min(cluster.minY + clusterSize, tileMap->getHeight()) - 1;
+            cluster.dirty = true;
+        }
+    }
+    dirtyCount = clusters.size();
+
+    size_t localCells = static_cast<size_t>(clusterSize) * static_cast<size_t>(clusterSize);
+    local.g.assign(localCells, 0.0f);
+    local.parent.assign(localCells, NO_PARENT);
+    local.openStamp.assign(localCells, 0);
+    local.closedStamp.assign(localCells, 0);
+    local.generation = 0;
+
+    repair();
+}
+
+void HierarchicalPathfinder::onTileChanged(int x, int y) {
+    if (!tileMap || !tileMap->inBounds(x, y)) {
+        return;
+    }
+    Cluster& cluster = clusters[clusterIndexAt(x, y)];
+    if (!cluster.dirty) {
+        cluster.dirty = true;
+        dirtyCount++;
+    }
+}
+
+void HierarchicalPathfinder::onAreaChanged(int minX, int minY, int maxX, int maxY) {
+    if (!tileMap) {
+        return;
+    }
+    minX = std::max(minX, 0);
+    minY = std::max(minY, 0);
+    maxX = std::min(maxX, tileMap->getWidth() - 1);
+    maxY = std::min(maxY, tileMap->getHeight() - 1);
+    for (int cy = minY / clusterSize; minX <= maxX && cy <= maxY / clusterSize; ++cy) {
+        for (int cx = minX / clusterSize; cx <= maxX / clusterSize; ++cx) {
+            onTileChanged(cx * clusterSize, cy * clusterSize);
+        }
+    }
+}
+
+size_t HierarchicalPathfinder::repair() {
+    if (dirtyCount == 0) {
+        return 0;
+    }
+
+    // Borders touching a dirty cluster are rebuilt; clusters on either side are re-edged
+    size_t clusterCount = clusters.size();
+    std::vector<bool> rebuildEast(clusterCount, false);
+    std::vector<bool> rebuildSouth(clusterCount, false);
+    std::vector<bool> reedge(clusterCount, false);
+    for (int cy = 0; cy < clustersY; ++cy) {
+        for (int cx = 0; cx < clustersX; ++cx) {
+            size_t index = static_cast<size_t>(cy * clustersX + cx);
+            if (!clusters[index].dirty) {
+                continue;
+            }
+            if (cx + 1 < clustersX) {
+                rebuildEast[index] = true;
+            }
+            if (cx > 0) {
+                rebuildEast[index - 1] = true;
+            }
+            if (cy + 1 < clustersY) {
+                rebuildSouth[index] = true;
+            }
+            if (cy > 0) {
+                rebuildSouth[index - static_cast<size_t>(clustersX)] = true;
+            }
+            reedge[index] = true;
+            clusters[index].dirty = false;
+        }
+    }
+    dirtyCount = 0;
+
+    for (size_t i = 0; i < clusterCount; ++i) {
+        if (rebuildEast[i]) {
+            clearBorder(clusters[i].eastBorder);
+            reedge[i] = true;
+            reedge[i + 1] = true;
+        }
+        if (rebuildSouth[i]) {
+            clearBorder(clusters[i].southBorder);
+            reedge[i] = true;
+            reedge[i + static_cast<size_t>(clustersX)] = true;
+        }
+    }
+    for (size_t i = 0; i < clusterCount; ++i) {
+        if (rebuildEast[i]) {
+            buildEastBorder(static_cast<uint32_t>(i));
+        }
+        if (rebuildSouth[i]) {
+            buildSouthBorder(static_cast<uint32_t>(i));
+        }
+    }
+
+    size_t reedged = 0;
+    for (size_t i = 0; i < clusterCount; ++i) {
+        if (reedge[i]) {
+            buildIntraEdges(static_cast<uint32_t>(i));
+            reedged++;
+        }
+    }
+    return reedged;
+}
+
+bool HierarchicalPathfinder::hasPendingRepairs() const {
+    return dirtyCount > 0;
+}
+
+bool HierarchicalPathfinder::findPath(TileCoord start, TileCoord goal, HierarchicalPath& path) {
+    path.found = false;
+    path.cost = 0.0f;
+    path.start = start;
+    path.waypoints.clear();
+    path.nextWaypoint = 0;
+
+    if (!tileMap || !walkable(start.x, start.y) || !walkable(goal.x, goal.y)) {
+        return false;
+    }
+    repair();
+
+    if (start == goal) {
+        path.found = true;
+        return true;
+    }
+
+    uint32_t startCluster = clusterIndexAt(start.x, start.y);
+    uint32_t goalCluster = clusterIndexAt(goal.x, goal.y);
+
+    // Same cluster: try the direct bounded search first
+    if (startCluster == goalCluster) {
+        searchCluster(clusters[startCluster], start, &goal);
+        float cost = localCost(clusters[startCluster], goal);
+        if (cost != UNREACHABLE) {
+            path.found = true;
+            path.cost = cost;
+            path.waypoints.push_back(goal);
+            return true;
+        }
+    }
+
+    // Link start and goal to the abstract nodes of their clusters
+    startLinks.clear();
+    searchCluster(clusters[startCluster], start, nullptr);
+    for (uint32_t node : clusters[startCluster].nodes) {
+        float cost = localCost(clusters[startCluster], nodes[node].cell);
+        if (cost != UNREACHABLE) {
+            startLinks.push_back(Edge{node, cost});
+        }
+    }
+    goalLinks.clear();
+    searchCluster(clusters[goalCluster], goal, nullptr);
+    for (uint32_t node : clusters[goalCluster].nodes) {
+        float cost = localCost(clusters[goalCluster], nodes[node].cell);
+        if (cost != UNREACHABLE) {
+            goalLinks.push_back(Edge{node, cost});
+        }
+    }
+    if (startLinks.empty() || goalLinks.empty()) {
+        return false;
+    }
+
+    // A* over the abstract graph; start and goal are the two ids past the real nodes
+    uint32_t startId = static_cast<uint32_t>(nodes.size());
+    uint32_t goalId = startId + 1;
+    size_t idCount = nodes.size() + 2;
+    if (abstractG.size() < idCount) {
+        abstractG.resize(idCount, 0.0f);
+        abstractParent.resize(idCount, NO_PARENT);
+        abstractOpen.resize(idCount, 0);
+        abstractClosed.resize(idCount, 0);
+    }
+    nextGeneration(abstractGeneration, abstractOpen, abstractClosed);
+    abstractHeap.clear();
+
+    auto cellOf = [&](uint32_t id) {
+        return id == startId ? start : (id == goalId ? goal : nodes[id].cell);
+    };
+    auto relax = [&](uint32_t id, float cost, uint32_t from) {
+        if (abstractClosed[id] == abstractGeneration) {
+            return;
+        }
+        if (abstractOpen[id] == abstractGeneration && abstractG[id] <= cost) {
+            return;
+        }
+        abstractOpen[id] = abstractGeneration;
+        abstractG[id] = cost;
+        abstractParent[id] = from;
+        TileCoord cell = cellOf(id);
+        float h = GridSearch::octileDistance(cell.x - goal.x, cell.y - goal.y);
+        GridSearch::pushOpen(abstractHeap, OpenNode{cost + h, h, id});
+    };
+
+    relax(startId, 0.0f, NO_PARENT);
+    bool reached = false;
+    while (!abstractHeap.empty()) {
+        uint32_t id = GridSearch::popOpen(abstractHeap).id;
+        if (abstractClosed[id] == abstractGeneration) {
+            continue;
+        }
+        abstractClosed[id] = abstractGeneration;
+        if (id == goalId) {
+            reached = true;
+            break;
+        }
+
+        float g = abstractG[id];
+        if (id == startId) {
+            for (const Edge& link : startLinks) {
+                relax(link.target, g + link.cost, id);
+            }
+            continue;
+        }
+
+        const Node& node = nodes[id];
+        for (const Edge& edge : node.edges) {
+            relax(edge.target, g + edge.cost, id);
+        }
+        if (node.partner != NO_PARENT) {
+            relax(node.partner, g + 1.0f, id);
+        }
+        if (node.cluster == goalCluster) {
+            for (const Edge& link : goalLinks) {
+                if (link.target == id) {
+                    relax(goalId, g + link.cost, id);
+                }
+            }
+        }
+    }
+    if (!reached) {
+        return false;
+    }
+
+    // Walk back to start, then reverse; co-located nodes collapse to one waypoint
+    for (uint32_t id = goalId; id != startId; id = abstractParent[id]) {
+        TileCoord cell = cellOf(id);
+        if (path.waypoints.empty() || path.waypoints.back() != cell) {
+            path.waypoints.push_back(cell);
+        }
+    }
+    if (!path.waypoints.empty() && path.waypoints.back() == start) {
+        path.waypoints.pop_back();
+    }
+    std::reverse(path.waypoints.begin(), path.waypoints.end());
+    path.cost = abstractG[goalId];
+    path.found = true;
+    return true;
+}
+
+bool HierarchicalPathfinder::refineNext(HierarchicalPath& path, std::vector<TileCoord>& out) {
+    if (!tileMap || !path.found || path.isComplete()) {
+        return false;
+    }
+    repair();
+
+    TileCoord from = path.nextWaypoint == 0 ? path.start : path.waypoints[path.nextWaypoint - 1];
+    TileCoord to = path.waypoints[path.nextWaypoint];
+    if (!walkable(from.x, from.y) || !walkable(to.x, to.y)) {
+        return false;
+    }
+
+    uint32_t cluster = clusterIndexAt(from.x, from.y);
+    if (cluster == clusterIndexAt(to.x, to.y)) {
+        searchCluster(clusters[cluster], from, &to);
+        if (localCost(clusters[cluster], to) == UNREACHABLE) {
+            return false;
+        }
+        appendLocalPath(clusters[cluster], from, to, out);
+    } else {
+        // Border crossing between transition partners
+        if (std::abs(to.x - from.x) + std::abs(to.y - from.y) != 1) {
+            return false;
+        }
+        out.push_back(to);
+    }
+    path.nextWaypoint++;
+    return true;
+}
+
+int HierarchicalPathfinder::getClusterSize() const {
+    return clusterSize;
+}
+
+size_t HierarchicalPathfinder::getClusterCount() const {
+    return clusters.size();
+}
+
+size_t HierarchicalPathfinder::getNodeCount() const {
+    return nodes.size() - freeNodes.size();
+}
+
+size_t HierarchicalPathfinder::getEdgeCount() const {
+    // Intra-cluster edges and partner links are stored on both endpoints
+    size_t links = 0;
+    for (const Node& node : nodes) {
+        if (node.alive) {
+            links += node.edges.size() + (node.partner != NO_PARENT ? 1 : 0);
+        }
+    }
+    return links / 2;
+}
+
+uint32_t HierarchicalPathfinder::clusterIndexAt(int x, int y) const {
+    return static_cast<uint32_t>((y / clusterSize) * clustersX + (x / clusterSize));
+}
+
+bool HierarchicalPathfinder::walkable(int x, int y) const {
+    return tileMap->isWalkable(x, y);
+}
+
+void HierarchicalPathfinder::clearBorder(std::vector<uint32_t>& border) {
+    for (uint32_t id : border) {
+        Node& node = nodes[id];
+        std::vector<uint32_t>& owner = clusters[node.cluster].nodes;
+        owner.erase(std::remove(owner.begin(), owner.end(), id), owner.end());
+        node.alive = false;
+        node.partner = NO_PARENT;
+        node.edges.clear();
+        freeNodes.push_back(id);
+    }
+    border.clear();
+}
+
+void HierarchicalPathfinder::buildEastBorder(uint32_t clusterIndex) {
+    Cluster& cluster = clusters[clusterIndex];
+    int x = cluster.maxX;
+    int runStart = -1;
+    for (int y = cluster.minY; y <= cluster.maxY + 1; ++y) {
+        bool open = y <= cluster.maxY && walkable(x, y) && walkable(x + 1, y);
+        if (open && runStart < 0) {
+            runStart = y;
+        } else if (!open && runStart >= 0) {
+            int runEnd = y - 1;
+            if (runEnd - runStart + 1 < MAX_SINGLE_TRANSITION_RUN) {
+                int middle = (runStart + runEnd) / 2;
+                addTransition(TileCoord{x, middle}, TileCoord{x + 1, middle}, cluster.eastBorder);
+            } else {
+                addTransition(TileCoord{x, runStart}, TileCoord{x + 1, runStart}, cluster.eastBorder);
+                addTransition(TileCoord{x, runEnd}, TileCoord{x + 1, runEnd}, cluster.eastBorder);
+            }
+            runStart = -1;
+        }
+    }
+}
+
+void HierarchicalPathfinder::buildSouthBorder(uint32_t clusterIndex) {
+    Cluster& cluster = clusters[clusterIndex];
+    int y = cluster.maxY;
+    int runStart = -1;
+    for (int x = cluster.minX; x <= cluster.maxX + 1; ++x) {
+        bool open = x <= cluster.maxX && walkable(x, y) && walkable(x, y + 1);
+        if (open && runStart < 0) {
+            runStart = x;
+        } else if (!open && runStart >= 0) {
+            int runEnd = x - 1;
+            if (runEnd - runStart + 1 < MAX_SINGLE_TRANSITION_RUN) {
+                int middle = (runStart + runEnd) / 2;
+                addTransition(TileCoord{middle, y}, TileCoord{middle, y + 1}, cluster.southBorder);
+            } else {
+                addTransition(TileCoord{runStart, y}, TileCoord{runStart, y + 1}, cluster.southBorder);
+                addTransition(TileCoord{runEnd, y}, TileCoord{runEnd, y + 1}, cluster.southBorder);
+            }
+            runStart = -1;
+        }
+    }
+}
+
+void HierarchicalPathfinder::addTransition(TileCoord a, TileCoord b, std::vector<uint32_t>& border) {
+    // Allocate before taking references; allocation may grow the node vector
+    uint32_t first = allocateNode(a);
+    uint32_t second = allocateNode(b);
+    nodes[first].partner = second;
+    nodes[second].partner = first;
+    border.push_back(first);
+    border.push_back(second);
+}
+
+uint32_t HierarchicalPathfinder::allocateNode(TileCoord cell) {
+    uint32_t id;
+    if (!freeNodes.empty()) {
+        id = freeNodes.back();
+        freeNodes.pop_back();
+    } else {
+        id = static_cast<uint32_t>(nodes.size());
+        nodes.emplace_back();
+    }
+    Node& node = nodes[id];
+    node.cell = cell;
+    node.cluster = clusterIndexAt(cell.x, cell.y);
+    node.partner = NO_PARENT;
+    node.alive = true;
+    node.edges.clear();
+    clusters[node.cluster].nodes.push_back(id);
+    return id;
+}
+
+void HierarchicalPathfinder::buildIntraEdges(uint32_t clusterIndex) {
+    const Cluster& cluster = clusters[clusterIndex];
+    for (uint32_t id : cluster.nodes) {
+        nodes[id].edges.clear();
+    }
+
+    // Costs are symmetric: one search per node covers all later nodes
+    for (size_t a = 0; a + 1 < cluster.nodes.size(); ++a) {
+        uint32_t from = cluster.nodes[a];
+        searchCluster(cluster, nodes[from].cell, nullptr);
+        for (size_t b = a + 1; b < cluster.nodes.size(); ++b) {
+            uint32_t to = cluster.nodes[b];
+            float cost = localCost(cluster, nodes[to].cell);
+            if (cost != UNREACHABLE) {
+                nodes[from].edges.push_back(Edge{to, cost});
+                nodes[to].edges.push_back(Edge{from, cost});
+            }
+        }
+    }
+}
+
+void HierarchicalPathfinder::searchCluster(const Cluster& cluster, TileCoord source, const TileCoord* target) {
+    int width = cluster.maxX - cluster.minX + 1;
+    nextGeneration(local.generation, local.openStamp, local.closedStamp);
+    local.heap.clear();
+
+    auto localIndex = [&](int x, int y) {
+        return static_cast<uint32_t>((y - cluster.minY) * width + (x - cluster.minX));
+    };
+    auto heuristic = [&](int x, int y) {
+        return target ? GridSearch::octileDistance(x - target->x, y - target->y) : 0.0f;
+    };
+
+    uint32_t sourceIndex = localIndex(source.x, source.y);
+    local.openStamp[sourceIndex] = local.generation;
+    local.g[sourceIndex] = 0.0f;
+    local.parent[sourceIndex] = NO_PARENT;
+    GridSearch::pushOpen(local.heap, OpenNode{heuristic(source.x, source.y), heuristic(source.x, source.y), sourceIndex});
+
+    while (!local.heap.empty()) {
+        uint32_t index = GridSearch::popOpen(local.heap).id;
+        if (local.closedStamp[index] == local.generation) {
+            continue;
+        }
+        local.closedStamp[index] = local.generation;
+
+        int x = cluster.minX + static_cast<int>(index) % width;
+        int y = cluster.minY + static_cast<int>(index) / width;
+        if (target && x == target->x && y == target->y) {
+            return;
+        }
+
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                int nx = x + dx;
+                int ny = y + dy;
+                if ((dx == 0 && dy == 0) || nx < cluster.minX || nx > cluster.maxX || ny < cluster.minY || ny > cluster.maxY) {
+                    continue;
+                }
+                if (!walkable(nx, ny) || (dx != 0 && dy != 0 && (!walkable(nx, y) || !walkable(x, ny)))) {
+                    continue;
+                }
+                uint32_t next = localIndex(nx, ny);
+                if (local.closedStamp[next] == local.generation) {
+                    continue;
+                }
+                float cost = local.g[index] + ((dx != 0 && dy != 0) ? DIAGONAL_COST : 1.0f);
+                if (local.openStamp[next] == local.generation && local.g[next] <= cost) {
+                    continue;
+                }
+                local.openStamp[next] = local.generation;
+                local.g[next] = cost;
+                local.parent[next] = index;
+                float h = heuristic(nx, ny);
+                GridSearch::pushOpen(local.heap, OpenNode{cost + h, h, next});
+            }
+        }
+    }
+}
+
+float HierarchicalPathfinder::localCost(const Cluster& cluster, TileCoord cell) const {
+    int width = cluster.maxX - cluster.minX + 1;
+    uint32_t index = static_cast<uint32_t>((cell.y - cluster.minY) * width + (cell.x - cluster.minX));
+    return local.closedStamp[index] == local.generation ? local.g[index] : UNREACHABLE;
+}
+
+void HierarchicalPathfinder::appendLocalPath(const Cluster& cluster, TileCoord source, TileCoord target,
+                                             std::vector<TileCoord>& out) const {
+    int width = cluster.maxX - cluster.minX + 1;
+    uint32_t sourceIndex = static_cast<uint32_t>((source.y - cluster.minY) * width + (source.x - cluster.minX));
+    uint32_t targetIndex = static_cast<uint32_t>((target.y - cluster.minY) * width + (target.x - cluster.minX));
+
+    size_t steps = 0;
+    for (uint32_t index = targetIndex; index != sourceIndex; index = local.parent[index]) {
+        steps++;
+    }
+    size_t write = out.size() + steps;
+    out.resize(write);
+    for (uint32_t index = targetIndex; index != sourceIndex; index = local.parent[index]) {
+        out[--write] = TileCoord{cluster.minX + static_cast<int>(index) % width, cluster.minY + static_cast<int>(index) / width};
+    }
+}
+
+} // namespace ECS
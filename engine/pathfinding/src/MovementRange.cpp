@@ -0,0 +1,290 @@
+#include "../include/MovementRange.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace ECS {
+
+using GridSearch::DIAGONAL_COST;
+using GridSearch::DIRECTION_COUNT;
+using GridSearch::DIRECTION_X;
+using GridSearch::DIRECTION_Y;
+using GridSearch::NO_DIRECTION;
+using GridSearch::OpenNode;
+
+namespace {
+
+constexpr float UNREACHABLE = std::numeric_limits<float>::infinity();
+
+} // namespace
+
+void MovementRange::compute(const TileMap& map, const OccupancyGrid* occupancy, EntityID self,
+                            TileCoord start, float budget) {
+    origin = start;
+    maxCost = budget;
+    reachableCount = 0;
+    heap.clear();
+
+    if (!map.isWalkable(start.x, start.y)) {
+        minX = start.x;
+        minY = start.y;
+        width = 0;
+        height = 0;
+        wordsPerRow = 0;
+        bits.clear();
+        costs.clear();
+        parents.clear();
+        return;
+    }
+
+    float limit = std::max(budget, 0.0f) + COST_EPSILON;
+    int radius = static_cast<int>(limit);
+    minX = std::max(start.x - radius, 0);
+    minY = std::max(start.y - radius, 0);
+    width = std::min(start.x + radius, map.getWidth() - 1) - minX + 1;
+    height = std::min(start.y + radius, map.getHeight() - 1) - minY + 1;
+    wordsPerRow = (static_cast<size_t>(width) + 63) / 64;
+    size_t cells = static_cast<size_t>(width) * static_cast<size_t>(height);
+    bits.assign(wordsPerRow * static_cast<size_t>(height), 0);
+    costs.assign(cells, UNREACHABLE);
+    parents.assign(cells, NO_DIRECTION);
+
+    auto passable = [&](int x, int y) {
+        return map.isWalkable(x, y) && (!occupancy || occupancy->isFree(x, y, self));
+    };
+
+    size_t startCell = boxIndex(start.x, start.y);
+    costs[startCell] = 0.0f;
+    GridSearch::pushOpen(heap, OpenNode{0.0f, 0.0f, static_cast<uint32_t>(startCell)});
+    while (!heap.empty()) {
+        OpenNode node = GridSearch::popOpen(heap);
+        size_t cell = node.id;
+        int column = static_cast<int>(cell % static_cast<size_t>(width));
+        int row = static_cast<int>(cell / static_cast<size_t>(width));
+        uint64_t& word = bits[static_cast<size_t>(row) * wordsPerRow + static_cast<size_t>(column) / 64];
+        uint64_t bit = uint64_t{1} << (column % 64);
+        if ((word & bit) != 0 || node.f > costs[cell]) {
+            continue; // Already settled, or a stale duplicate
+        }
+        word |= bit;
+        reachableCount++;
+
+        int x = minX + column;
+        int y = minY + row;
+        for (int direction = 0; direction < DIRECTION_COUNT; ++direction) {
+            int dx = DIRECTION_X[direction];
+            int dy = DIRECTION_Y[direction];
+            int nx = x + dx;
+            int ny = y + dy;
+            if (!inBox(nx, ny) || !passable(nx, ny)) {
+                continue;
+            }
+            bool diagonal = dx != 0 && dy != 0;
+            if (diagonal && (!map.isWalkable(x + dx, y) || !map.isWalkable(x, y + dy))) {
+                continue; // No corner cutting
+            }
+            float cost = node.f + (diagonal ? DIAGONAL_COST : 1.0f);
+            size_t next = boxIndex(nx, ny);
+            if (cost > limit || cost >= costs[next]) {
+                continue;
+            }
+            costs[next] = cost;
+            parents[next] = static_cast<uint8_t>(direction);
+            GridSearch::pushOpen(heap, OpenNode{cost, 0.0f, static_cast<uint32_t>(next)});
+        }
+    }
+}
+
+TileCoord MovementRange::getOrigin() const {
+    return origin;
+}
+
+float MovementRange::getMaxCost() const {
+    return maxCost;
+}
+
+int MovementRange::getMinX() const {
+    return minX;
+}
+
+int MovementRange::getMinY() const {
+    return minY;
+}
+
+int MovementRange::getWidth() const {
+    return width;
+}
+
+int MovementRange::getHeight() const {
+    return height;
+}
+
+size_t MovementRange::getWordsPerRow() const {
+    return wordsPerRow;
+}
+
+const uint64_t* MovementRange::getRow(int row) const {
+    if (row < 0 || row >= height) {
+        return nullptr;
+    }
+    return &bits[static_cast<size_t>(row) * wordsPerRow];
+}
+
+bool MovementRange::contains(int x, int y) const {
+    if (!inBox(x, y)) {
+        return false;
+    }
+    size_t column = static_cast<size_t>(x - minX);
+    uint64_t word = bits[static_cast<size_t>(y - minY) * wordsPerRow + column / 64];
+    return ((word >> (column % 64)) & 1u) != 0;
+}
+
+float MovementRange::getCost(int x, int y) const {
+    return contains(x, y) ? costs[boxIndex(x, y)] : UNREACHABLE;
+}
+
+size_t MovementRange::getReachableCount() const {
+    return reachableCount;
+}
+
+void MovementRange::collect(std::vector<TileCoord>& out) const {
+    for (int row = 0; row < height; ++row) {
+        const uint64_t* words = getRow(row);
+        for (size_t i = 0; i < wordsPerRow; ++i) {
+            uint64_t word = words[i];
+            while (word != 0) {
+                int bit = __builtin_ctzll(word);
+                out.push_back(TileCoord{minX + static_cast<int>(i * 64) + bit, minY + row});
+                word &= word - 1;
+            }
+        }
+    }
+}
+
+bool MovementRange::buildPath(TileCoord target, std::vector<TileCoord>& out) const {
+    if (!contains(target.x, target.y)) {
+        return false;
+    }
+    size_t first = out.size();
+    TileCoord at = target;
+    while (true) {
+        uint8_t direction = parents[boxIndex(at.x, at.y)];
+        if (direction == NO_DIRECTION) {
+            break;
+        }
+        out.push_back(at);
+        at.x -= DIRECTION_X[direction];
+        at.y -= DIRECTION_Y[direction];
+    }
+    std::reverse(out.begin() + static_cast<std::ptrdiff_t>(first), out.end());
+    return true;
+}
+
+bool MovementRange::isAffectedBy(int editMinX, int editMinY, int editMaxX, int editMaxY) const {
+    // The origin may have become walkable (or not)
+    if (origin.x >= editMinX && origin.x <= editMaxX && origin.y >= editMinY && origin.y <= editMaxY) {
+        return true;
+    }
+    int fromX = std::max(editMinX - 1, minX);
+    int fromY = std::max(editMinY - 1, minY);
+    int toX = std::min(editMaxX + 1, minX + width - 1);
+    int toY = std::min(editMaxY + 1, minY + height - 1);
+    for (int y = fromY; y <= toY; ++y) {
+        for (int x = fromX; x <= toX; ++x) {
+            if (contains(x, y)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool MovementRange::inBox(int x, int y) const {
+    return x >= minX && y >= minY && x < minX + width && y < minY + height;
+}
+
+size_t MovementRange::boxIndex(int x, int y) const {
+    return static_cast<size_t>(y - minY) * static_cast<size_t>(width) + static_cast<size_t>(x - minX);
+}
+
+MovementRangeCache::MovementRangeCache(const TileMap* map, const OccupancyGrid* occupancy)
+    : tileMap(map)
+    , occupancyGrid(occupancy) {
+}
+
+void MovementRangeCache::setTileMap(const TileMap* map) {
+    tileMap = map;
+    entries.clear();
+}
+
+const TileMap* MovementRangeCache::getTileMap() const {
+    return tileMap;
+}
+
+void MovementRangeCache::setOccupancyGrid(const OccupancyGrid* occupancy) {
+    occupancyGrid = occupancy;
+    entries.clear();
+}
+
+const OccupancyGrid* MovementRangeCache::getOccupancyGrid() const {
+    return occupancyGrid;
+}
+
+const MovementRange& MovementRangeCache::get(EntityID unit, TileCoord origin, float maxCost) {
+    if (!tileMap) {
+        return emptyRange;
+    }
+    Entry& entry = entries[unit];
+    bool fresh = !entry.stale &&
+                 entry.range.getOrigin() == origin &&
+                 entry.range.getMaxCost() == maxCost &&
+                 entry.occupancyVersion == areaVersion(entry.range);
+    if (!fresh) {
+        entry.range.compute(*tileMap, occupancyGrid, unit, origin, maxCost);
+        entry.occupancyVersion = areaVersion(entry.range);
+        entry.stale = false;
+        computeCount++;
+    }
+    return entry.range;
+}
+
+void MovementRangeCache::invalidate(int minX, int minY, int maxX, int maxY) {
+    for (auto& pair : entries) {
+        Entry& entry = pair.second;
+        if (!entry.stale && entry.range.isAffectedBy(minX, minY, maxX, maxY)) {
+            entry.stale = true;
+        }
+    }
+}
+
+void MovementRangeCache::onTilesChanged(EventView<TileChangedPayload> events) {
+    for (const auto& event : events) {
+        invalidate(event.payload.minX, event.payload.minY, event.payload.maxX, event.payload.maxY);
+    }
+}
+
+void MovementRangeCache::erase(EntityID unit) {
+    entries.erase(unit);
+}
+
+void MovementRangeCache::clear() {
+    entries.clear();
+}
+
+size_t MovementRangeCache::size() const {
+    return entries.size();
+}
+
+size_t MovementRangeCache::getComputeCount() const {
+    return computeCount;
+}
+
+uint64_t MovementRangeCache::areaVersion(const MovementRange& range) const {
+    if (!occupancyGrid || range.getWidth() == 0) {
+        return 0;
+    }
+    return occupancyGrid->getAreaVersion(range.getMinX(), range.getMinY(),
+                                         range.getMinX() + range.getWidth() - 1,
+                                         range.getMinY() + range.getHeight() - 1);
+}
+
+} // namespace ECS
@@ -0,0 +1,442 @@
+#include "../include/Pathfinder.hpp"
+#include "../include/GridSearch.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+
+namespace ECS {
+
+using GridSearch::DIAGONAL_COST;
+using GridSearch::NO_PARENT;
+using GridSearch::OpenNode;
+using GridSearch::sign;
+
+/**
+ * Pooled per-thread search state (see class comment)
+ */
+struct Pathfinder::SearchContext {
+    std::vector<float> g;
+    std::vector<uint32_t> parent;
+    std::vector<uint32_t> openStamp;    // == generation: cell reached this query
+    std::vector<uint32_t> closedStamp;  // == generation: cell expanded this query
+    std::vector<OpenNode> heap;
+    uint32_t generation = 0;
+    std::atomic<bool> busy{false};
+
+    /**
+     * Start a new query on a map of the given cell count
+     */
+    void prepare(size_t cells) {
+        if (g.size() != cells) {
+            g.assign(cells, 0.0f);
+            parent.assign(cells, NO_PARENT);
+            openStamp.assign(cells, 0);
+            closedStamp.assign(cells, 0);
+            generation = 0;
+        }
+        if (++generation == 0) {
+            // Stamp wrap-around: clear once every 2^32 queries
+            std::fill(openStamp.begin(), openStamp.end(), 0u);
+            std::fill(closedStamp.begin(), closedStamp.end(), 0u);
+            generation = 1;
+        }
+        heap.clear();
+    }
+
+    bool isOpen(uint32_t cell) const { return openStamp[cell] == generation; }
+    bool isClosed(uint32_t cell) const { return closedStamp[cell] == generation; }
+
+    /**
+     * Reach a cell with cost g; keeps the cheaper of old and new routes
+     */
+    void relax(uint32_t cell, float cost, uint32_t from, float heuristic) {
+        if (isOpen(cell) && g[cell] <= cost) {
+            return;
+        }
+        openStamp[cell] = generation;
+        g[cell] = cost;
+        parent[cell] = from;
+        GridSearch::pushOpen(heap, OpenNode{cost + heuristic, heuristic, cell});
+    }
+
+    /**
+     * Pop the best open cell that is not closed yet
+     * @return false when the open set is exhausted
+     */
+    bool popBest(uint32_t& cell) {
+        while (!heap.empty()) {
+            cell = GridSearch::popOpen(heap).id;
+            if (!isClosed(cell)) {
+                closedStamp[cell] = generation;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+Pathfinder::Pathfinder(const TileMap* map, WorkerPool* pool)
+    : tileMap(map)
+    , workerPool(pool) {
+    contexts.push_back(std::make_unique<SearchContext>());
+}
+
+Pathfinder::~Pathfinder() = default;
+
+void Pathfinder::setTileMap(const TileMap* map) {
+    tileMap = map;
+}
+
+const TileMap* Pathfinder::getTileMap() const {
+    return tileMap;
+}
+
+void Pathfinder::setWorkerPool(WorkerPool* pool) {
+    workerPool = pool;
+}
+
+WorkerPool* Pathfinder::getWorkerPool() const {
+    return workerPool;
+}
+
+bool Pathfinder::findPath(const PathRequest& request, PathResult& result) {
+    SearchContext& context = acquireContext();
+    solve(context, request, result);
+    releaseContext(context);
+    return result.found;
+}
+
+void Pathfinder::findPaths(const std::vector<PathRequest>& requests, std::vector<PathResult>& results) {
+    results.resize(requests.size());
+    if (!workerPool) {
+        for (size_t i = 0; i < requests.size(); ++i) {
+            findPath(requests[i], results[i]);
+        }
+        return;
+    }
+
+    // One context per thread that can run a job (workers + caller); grown before the job starts
+    size_t threads = workerPool->getWorkerCount() + 1;
+    while (contexts.size() < threads) {
+        contexts.push_back(std::make_unique<SearchContext>());
+    }
+
+    workerPool->parallelFor(requests.size(), [&](size_t i) {
+        SearchContext& context = acquireContext();
+        solve(context, requests[i], results[i]);
+        releaseContext(context);
+    });
+}
+
+float Pathfinder::octileDistance(TileCoord a, TileCoord b) {
+    return GridSearch::octileDistance(a.x - b.x, a.y - b.y);
+}
+
+Pathfinder::SearchContext& Pathfinder::acquireContext() {
+    // At most workers + 1 jobs run at once, so a free context always exists
+    while (true) {
+        for (auto& context : contexts) {
+            bool expected = false;
+            if (context->busy.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return *context;
+            }
+        }
+    }
+}
+
+void Pathfinder::releaseContext(SearchContext& context) {
+    context.busy.store(false, std::memory_order_release);
+}
+
+void Pathfinder::solve(SearchContext& context, const PathRequest& request, PathResult& result) const {
+    result.found = false;
+    result.cost = 0.0f;
+    result.expanded = 0;
+    result.path.clear();
+
+    if (!tileMap || !walkable(request.start.x, request.start.y) || !walkable(request.goal.x, request.goal.y)) {
+        return;
+    }
+
+    int width = tileMap->getWidth();
+    uint32_t startCell = static_cast<uint32_t>(request.start.y * width + request.start.x);
+    uint32_t goalCell = static_cast<uint32_t>(request.goal.y * width + request.goal.x);
+
+    context.prepare(static_cast<size_t>(width) * static_cast<size_t>(tileMap->getHeight()));
+    if (request.algorithm == PathAlgorithm::AStar) {
+        solveAStar(context, startCell, goalCell, result);
+    } else {
+        solveJumpPoint(context, startCell, goalCell, result);
+    }
+
+    if (result.found) {
+        result.cost = context.g[goalCell];
+        buildPath(context, startCell, goalCell, result);
+    }
+}
+
+void Pathfinder::solveAStar(SearchContext& context, uint32_t startCell, uint32_t goalCell, PathResult& result) const {
+    int width = tileMap->getWidth();
+    TileCoord goal{static_cast<int>(goalCell) % width, static_cast<int>(goalCell) / width};
+
+    context.relax(startCell, 0.0f, NO_PARENT, 0.0f);
+    uint32_t cell;
+    while (context.popBest(cell)) {
+        result.expanded++;
+        if (cell == goalCell) {
+            result.found = true;
+            return;
+        }
+
+        int x = static_cast<int>(cell) % width;
+        int y = static_cast<int>(cell) / width;
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                if ((dx == 0 && dy == 0) || !walkable(x + dx, y + dy)) {
+                    continue;
+                }
+                if (dx != 0 && dy != 0 && (!walkable(x + dx, y) || !walkable(x, y + dy))) {
+                    continue; // No corner cutting
+                }
+                uint32_t next = static_cast<uint32_t>((y + dy) * width + (x + dx));
+                if (context.isClosed(next)) {
+                    continue;
+                }
+                float step = (dx != 0 && dy != 0) ? DIAGONAL_COST : 1.0f;
+                context.relax(next, context.g[cell] + step, cell, octileDistance(TileCoord{x + dx, y + dy}, goal));
+            }
+        }
+    }
+}
+
+void Pathfinder::solveJumpPoint(SearchContext& context, uint32_t startCell, uint32_t goalCell, PathResult& result) const {
+    int width = tileMap->getWidth();
+    TileCoord goal{static_cast<int>(goalCell) % width, static_cast<int>(goalCell) / width};
+
+    context.relax(startCell, 0.0f, NO_PARENT, 0.0f);
+    uint32_t cell;
+    int directions[8][2];
+    while (context.popBest(cell)) {
+        result.expanded++;
+        if (cell == goalCell) {
+            result.found = true;
+            return;
+        }
+
+        int x = static_cast<int>(cell) % width;
+        int y = static_cast<int>(cell) / width;
+
+        // Pruned neighbour directions given the direction of travel
+        int count = 0;
+        if (context.parent[cell] == NO_PARENT) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    if (dx != 0 || dy != 0) {
+                        directions[count][0] = dx;
+                        directions[count][1] = dy;
+                        count++;
+                    }
+                }
+            }
+        } else {
+            int px = static_cast<int>(context.parent[cell]) % width;
+            int py = static_cast<int>(context.parent[cell]) / width;
+            int dx = sign(x - px);
+            int dy = sign(y - py);
+            auto add = [&](int ndx, int ndy) {
+                directions[count][0] = ndx;
+                directions[count][1] = ndy;
+                count++;
+            };
+            if (dx != 0 && dy != 0) {
+                add(0, dy);
+                add(dx, 0);
+                add(dx, dy);
+            } else if (dx != 0) {
+                add(dx, 0);
+                add(dx, 1);
+                add(dx, -1);
+                add(0, 1);
+                add(0, -1);
+            } else {
+                add(0, dy);
+                add(1, dy);
+                add(-1, dy);
+                add(1, 0);
+                add(-1, 0);
+            }
+        }
+
+        for (int i = 0; i < count; ++i) {
+            int dx = directions[i][0];
+            int dy = directions[i][1];
+            if (dx != 0 && dy != 0 && (!walkable(x + dx, y) || !walkable(x, y + dy))) {
+                continue; // No corner cutting
+            }
+            TileCoord jumpPoint;
+            if (!jump(x + dx, y + dy, dx, dy, goal, jumpPoint)) {
+                continue;
+            }
+            uint32_t next = static_cast<uint32_t>(jumpPoint.y * width + jumpPoint.x);
+            if (context.isClosed(next)) {
+                continue;
+            }
+            float cost = context.g[cell] + octileDistance(TileCoord{x, y}, jumpPoint);
+            context.relax(next, cost, cell, octileDistance(jumpPoint, goal));
+        }
+    }
+}
+
+bool Pathfinder::jump(int x, int y, int dx, int dy, TileCoord goal, TileCoord& jumpPoint) const {
+    if (dy == 0) {
+        return jumpHorizontal(x, y, dx, goal, jumpPoint);
+    }
+    if (dx == 0) {
+        return jumpVertical(x, y, dy, goal, jumpPoint);
+    }
+
+    // Diagonal: walk until a straight sweep finds something, the goal or a wall
+    while (true) {
+        if (!walkable(x, y)) {
+            return false;
+        }
+        if (x == goal.x && y == goal.y) {
+            jumpPoint = TileCoord{x, y};
+            return true;
+        }
+
+        TileCoord unused;
+        if (jumpHorizontal(x + dx, y, dx, goal, unused) || jumpVertical(x, y + dy, dy, goal, unused)) {
+            jumpPoint = TileCoord{x, y};
+            return true;
+        }
+
+        // Next step must not cut a corner
+        if (!walkable(x + dx, y) || !walkable(x, y + dy)) {
+            return false;
+        }
+        x += dx;
+        y += dy;
+    }
+}
+
+bool Pathfinder::jumpHorizontal(int x, int y, int dx, TileCoord goal, TileCoord& jumpPoint) const {
+    if (!tileMap->inBounds(x, y)) {
+        return false;
+    }
+
+    // Whole row words at a time: walls are clear walkable bits, stops are the
+    // goal and forced neighbours (walkable above/below where the tile behind is not)
+    const int wordBits = static_cast<int>(TileMap::WORD_BITS);
+    long words = static_cast<long>(tileMap->getWordsPerRow());
+    auto forced = [&](int row, long word) {
+        uint64_t here = walkableWord(row, word);
+        uint64_t behind = dx > 0 ? (here << 1) | (walkableWord(row, word - 1) >> 63)
+                                 : (here >> 1) | (walkableWord(row, word + 1) << 63);
+        return here & ~behind;
+    };
+
+    long word = x / wordBits;
+    int bit = x % wordBits;
+    while (word >= 0 && word < words) {
+        uint64_t span = dx > 0 ? (~0ULL << bit) : (bit == 63 ? ~0ULL : ((1ULL << (bit + 1)) - 1));
+        uint64_t walls = ~walkableWord(y, word) & span;
+        uint64_t stops = (forced(y - 1, word) | forced(y + 1, word)) & span;
+        if (goal.y == y && goal.x / wordBits == word) {
+            stops |= (1ULL << (goal.x % wordBits)) & span;
+        }
+
+        if ((walls | stops) != 0) {
+            // First hit in the direction of travel; a wall on the same tile wins
+            int wall = dx > 0 ? (walls ? __builtin_ctzll(walls) : 64) : (walls ? 63 - __builtin_clzll(walls) : -1);
+            int stop = dx > 0 ? (stops ? __builtin_ctzll(stops) : 64) : (stops ? 63 - __builtin_clzll(stops) : -1);
+            if (stops == 0 || (dx > 0 ? wall <= stop : wall >= stop)) {
+                return false;
+            }
+            jumpPoint = TileCoord{static_cast<int>(word) * wordBits + stop, y};
+            return true;
+        }
+        word += dx;
+        bit = dx > 0 ? 0 : 63;
+    }
+    return false;
+}
+
+bool Pathfinder::jumpVertical(int x, int y, int dy, TileCoord goal, TileCoord& jumpPoint) const {
+    // One row lookup per step: the walkable bits of x - 1, x and x + 1,
+    // compared with the same bits of the row behind for forced neighbours
+    uint32_t behind = walkableTriple(x, y - dy);
+    while (true) {
+        uint32_t here = walkableTriple(x, y);
+        if ((here & 2u) == 0) {
+            return false;
+        }
+        if ((x == goal.x && y == goal.y) || (here & ~behind & 5u) != 0) {
+            jumpPoint = TileCoord{x, y};
+            return true;
+        }
+        behind = here;
+        y += dy;
+    }
+}
+
+uint64_t Pathfinder::walkableWord(int y, long word) const {
+    if (y < 0 || y >= tileMap->getHeight() || word < 0 || word >= static_cast<long>(tileMap->getWordsPerRow())) {
+        return 0;
+    }
+    // Padding bits past the width are clear in both planes, so they read as walls
+    return tileMap->getRow(TileFlag::Traversable, y)[word] & ~tileMap->getRow(TileFlag::Blocked, y)[word];
+}
+
+uint32_t Pathfinder::walkableTriple(int x, int y) const {
+    const int wordBits = static_cast<int>(TileMap::WORD_BITS);
+    int first = x - 1;
+    if (first < 0) {
+        return static_cast<uint32_t>((walkableWord(y, 0) << 1) & 7u);
+    }
+    long word = first / wordBits;
+    int shift = first % wordBits;
+    uint64_t triple = walkableWord(y, word) >> shift;
+    if (shift > wordBits - 3) {
+        triple |= walkableWord(y, word + 1) << (wordBits - shift);
+    }
+    return static_cast<uint32_t>(triple & 7u);
+}
+
+bool Pathfinder::walkable(int x, int y) const {
+    return tileMap->isWalkable(x, y);
+}
+
+void Pathfinder::buildPath(const SearchContext& context, uint32_t startCell, uint32_t goalCell, PathResult& result) const {
+    int width = tileMap->getWidth();
+
+    // Count steps first so the path is filled back to front without reallocation
+    size_t steps = 0;
+    for (uint32_t cell = goalCell; cell != startCell; cell = context.parent[cell]) {
+        uint32_t from = context.parent[cell];
+        int dx = std::abs(static_cast<int>(cell) % width - static_cast<int>(from) % width);
+        int dy = std::abs(static_cast<int>(cell) / width - static_cast<int>(from) / width);
+        steps += static_cast<size_t>(std::max(dx, dy));
+    }
+    result.path.resize(steps);
+
+    // Expand each straight or diagonal segment between consecutive nodes
+    size_t write = steps;
+    for (uint32_t cell = goalCell; cell != startCell; cell = context.parent[cell]) {
+        uint32_t from = context.parent[cell];
+        int x = static_cast<int>(cell) % width;
+        int y = static_cast<int>(cell) / width;
+        int fromX = static_cast<int>(from) % width;
+        int fromY = static_cast<int>(from) / width;
+        int stepX = sign(fromX - x);
+        int stepY = sign(fromY - y);
+        while (x != fromX || y != fromY) {
+            result.path[--write] = TileCoord{x, y};
+            x += stepX;
+            y += stepY;
+        }
+    }
+}
+
+} // namespace ECS
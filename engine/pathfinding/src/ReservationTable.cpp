@@ -0,0 +1,123 @@
+#include "../include/ReservationTable.hpp"
+#include <algorithm>
+
+namespace ECS {
+
+ReservationTable::ReservationTable(int width, int height)
+    : width(std::max(width, 0))
+    , height(std::max(height, 0)) {
+}
+
+void ReservationTable::reset(int newWidth, int newHeight) {
+    width = std::max(newWidth, 0);
+    height = std::max(newHeight, 0);
+    clear();
+}
+
+int ReservationTable::getWidth() const {
+    return width;
+}
+
+int ReservationTable::getHeight() const {
+    return height;
+}
+
+bool ReservationTable::reserve(int x, int y, int tick, EntityID unit) {
+    if (!isFree(x, y, tick, unit)) {
+        return false;
+    }
+    slots[slotKey(cellIndex(x, y), tick)] = unit;
+    return true;
+}
+
+void ReservationTable::release(int x, int y, int tick, EntityID unit) {
+    if (!inBounds(x, y)) {
+        return;
+    }
+    auto it = slots.find(slotKey(cellIndex(x, y), tick));
+    if (it != slots.end() && it->second == unit) {
+        slots.erase(it);
+    }
+}
+
+bool ReservationTable::park(int x, int y, int fromTick, EntityID unit) {
+    if (!inBounds(x, y) || !isUnparked(x, y, unit)) {
+        return false;
+    }
+    parked[cellIndex(x, y)] = Parked{unit, fromTick};
+    return true;
+}
+
+void ReservationTable::unpark(int x, int y, EntityID unit) {
+    if (!inBounds(x, y)) {
+        return;
+    }
+    auto it = parked.find(cellIndex(x, y));
+    if (it != parked.end() && it->second.unit == unit) {
+        parked.erase(it);
+    }
+}
+
+EntityID ReservationTable::getHolder(int x, int y, int tick) const {
+    if (!inBounds(x, y)) {
+        return INVALID_ENTITY;
+    }
+    uint32_t cell = cellIndex(x, y);
+    auto slot = slots.find(slotKey(cell, tick));
+    if (slot != slots.end()) {
+        return slot->second;
+    }
+    auto park = parked.find(cell);
+    if (park != parked.end() && park->second.fromTick <= tick) {
+        return park->second.unit;
+    }
+    return INVALID_ENTITY;
+}
+
+bool ReservationTable::isFree(int x, int y, int tick, EntityID self) const {
+    if (!inBounds(x, y)) {
+        return false;
+    }
+    uint32_t cell = cellIndex(x, y);
+    auto slot = slots.find(slotKey(cell, tick));
+    if (slot != slots.end() && slot->second != self) {
+        return false;
+    }
+    auto park = parked.find(cell);
+    return park == parked.end() || park->second.unit == self || park->second.fromTick > tick;
+}
+
+bool ReservationTable::isUnparked(int x, int y, EntityID self) const {
+    if (!inBounds(x, y)) {
+        return false;
+    }
+    auto park = parked.find(cellIndex(x, y));
+    return park == parked.end() || park->second.unit == self;
+}
+
+size_t ReservationTable::getSlotCount() const {
+    return slots.size();
+}
+
+size_t ReservationTable::getParkedCount() const {
+    return parked.size();
+}
+
+void ReservationTable::clear() {
+    slots.clear();
+    parked.clear();
+}
+
+bool ReservationTable::inBounds(int x, int y) const {
+    return x >= 0 && y >= 0 && x < width && y < height;
+}
+
+uint32_t ReservationTable::cellIndex(int x, int y) const {
+    return static_cast<uint32_t>(y * width + x);
+}
+
+uint64_t ReservationTable::slotKey(uint32_t cell, int tick) {
+    return (static_cast<uint64_t>(cell) << 32) | static_cast<uint32_t>(tick);
+}
+
+} // namespace ECS
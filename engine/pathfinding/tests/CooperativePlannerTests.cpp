@@ -0,0 +1,276 @@
+#include <gtest/gtest.h>
+#include "../include/CooperativePlanner.hpp"
+#include "../include/ReservationTable.hpp"
+#include "../include/RandomGrid.hpp"
+#include "../../physics/include/MovementSystem.hpp"
+#include "../../ecs/include/ComponentArray.hpp"
+#include "../../ecs/components/include/Transform.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+using namespace ECS;
+using RandomGrid::randomBelow;
+using RandomGrid::scatterWalls;
+
+namespace {
+
+/**
+ * Replay plans tick by tick: legal steps, no shared cells, no unit entering
+ * a cell another unit stood on the tick before (covers swaps)
+ */
+void expectConflictFree(const TileMap& map, const std::vector<QueuedMove>& moves,
+                        const std::vector<CooperativePlan>& plans, int window) {
+    ASSERT_EQ(moves.size(), plans.size());
+    auto cellAt = [&](size_t unit, int tick) {
+        const std::vector<TileCoord>& steps = plans[unit].steps;
+        if (tick == 0 || steps.empty()) {
+            return moves[unit].from;
+        }
+        return steps[std::min(static_cast<size_t>(tick), steps.size()) - 1];
+    };
+
+    for (size_t unit = 0; unit < moves.size(); ++unit) {
+        EXPECT_EQ(plans[unit].unit, moves[unit].entityId);
+        EXPECT_LE(plans[unit].steps.size(), static_cast<size_t>(window));
+        if (plans[unit].reachedGoal) {
+            EXPECT_EQ(cellAt(unit, window), moves[unit].to);
+        }
+        for (int tick = 1; tick <= window; ++tick) {
+            TileCoord from = cellAt(unit, tick - 1);
+            TileCoord to = cellAt(unit, tick);
+            int dx = to.x - from.x;
+            int dy = to.y - from.y;
+            ASSERT_TRUE(std::abs(dx) <= 1 && std::abs(dy) <= 1 && map.isWalkable(to.x, to.y));
+            if (dx != 0 && dy != 0) {
+                ASSERT_TRUE(map.isWalkable(from.x + dx, from.y) && map.isWalkable(from.x, from.y + dy));
+            }
+        }
+    }
+
+    for (int tick = 0; tick <= window; ++tick) {
+        for (size_t a = 0; a < moves.size(); ++a) {
+            for (size_t b = 0; b < moves.size(); ++b) {
+                if (a == b) {
+                    continue;
+                }
+                ASSERT_FALSE(cellAt(a, tick) == cellAt(b, tick)) << "tick " << tick;
+                if (tick > 0 && !(cellAt(a, tick) == cellAt(a, tick - 1))) {
+                    ASSERT_FALSE(cellAt(a, tick) == cellAt(b, tick - 1)) << "tick " << tick;
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+/**
+ * Test slots, parking and ownership rules of the reservation table
+ */
+TEST(ReservationTableTest, SlotsAndParking) {
+    ReservationTable table(10, 10);
+    EXPECT_TRUE(table.reserve(3, 4, 2, 1));
+    EXPECT_TRUE(table.reserve(3, 4, 2, 1));
+    EXPECT_FALSE(table.reserve(3, 4, 2, 2));
+    EXPECT_TRUE(table.reserve(3, 4, 3, 2));
+    EXPECT_EQ(table.getHolder(3, 4, 2), 1u);
+    EXPECT_TRUE(table.isFree(3, 4, 2, 1));
+    EXPECT_FALSE(table.isFree(3, 4, 2, 2));
+    EXPECT_FALSE(table.isFree(-1, 4, 0, 1));
+    EXPECT_EQ(table.getSlotCount(), 2u);
+
+    table.release(3, 4, 2, 2);  // Not the holder
+    EXPECT_EQ(table.getHolder(3, 4, 2), 1u);
+    table.release(3, 4, 2, 1);
+    EXPECT_EQ(table.getHolder(3, 4, 2), INVALID_ENTITY);
+
+    // Parked cells are held from their tick on
+    EXPECT_TRUE(table.park(5, 5, 4, 7));
+    EXPECT_FALSE(table.park(5, 5, 0, 8));
+    EXPECT_TRUE(table.isFree(5, 5, 3, 8));
+    EXPECT_FALSE(table.isFree(5, 5, 4, 8));
+    EXPECT_FALSE(table.isFree(5, 5, 1000, 8));
+    EXPECT_FALSE(table.reserve(5, 5, 9, 8));
+    EXPECT_FALSE(table.isUnparked(5, 5, 8));
+    EXPECT_TRUE(table.isUnparked(5, 5, 7));
+    EXPECT_EQ(table.getHolder(5, 5, 9), 7u);
+    table.unpark(5, 5, 7);
+    EXPECT_TRUE(table.isFree(5, 5, 9, 8));
+
+    table.reset(4, 4);
+    EXPECT_EQ(table.getSlotCount(), 0u);
+    EXPECT_EQ(table.getParkedCount(), 0u);
+    EXPECT_FALSE(table.isFree(5, 5, 0, 8));
+}
+
+/**
+ * Test that units pass each other and that crowds on random maps stay conflict-free
+ */
+TEST(CooperativePlannerTest, NoConflicts) {
+    // Head-on in a two-lane corridor: one unit steps aside
+    TileMap lanes(5, 2);
+    CooperativePlanner planner(&lanes, 8);
+    std::vector<QueuedMove> moves = {{1, {0, 0}, {4, 0}}, {2, {4, 0}, {0, 0}}};
+    std::vector<CooperativePlan> plans;
+    planner.plan(moves, plans);
+    expectConflictFree(lanes, moves, plans, planner.getWindow());
+    EXPECT_TRUE(plans[0].reachedGoal);
+    EXPECT_TRUE(plans[1].reachedGoal);
+    EXPECT_EQ(plans[0].steps.size(), 4u);  // Higher priority goes straight
+
+    // Random crowds
+    uint32_t seed = 5u;
+    for (int round = 0; round < 6; ++round) {
+        TileMap map(16, 16);
+        scatterWalls(map, seed, 15);
+        std::vector<TileCoord> starts;
+        std::vector<TileCoord> goals;
+        moves.clear();
+        while (moves.size() < 14) {
+            TileCoord start{randomBelow(seed, 16), randomBelow(seed, 16)};
+            TileCoord goal{randomBelow(seed, 16), randomBelow(seed, 16)};
+            if (!map.isWalkable(start.x, start.y) || !map.isWalkable(goal.x, goal.y) ||
+                std::find(starts.begin(), starts.end(), start) != starts.end() ||
+                std::find(goals.begin(), goals.end(), goal) != goals.end()) {
+                continue;
+            }
+            starts.push_back(start);
+            goals.push_back(goal);
+            moves.push_back(QueuedMove{static_cast<EntityID>(moves.size() + 1), start, goal});
+        }
+        planner.setTileMap(&map);
+        planner.setWindow(12);
+        planner.plan(moves, plans);
+        expectConflictFree(map, moves, plans, planner.getWindow());
+        size_t reached = std::count_if(plans.begin(), plans.end(), [](const CooperativePlan& plan) {
+            return plan.reachedGoal;
+        });
+        EXPECT_GT(reached, moves.size() / 2) << "round " << round;
+        EXPECT_GT(planner.getExpandedCount(), 0u);
+    }
+}
+
+/**
+ * Test that a unit that cannot get out of the way is parked and the route through it replanned
+ */
+TEST(CooperativePlannerTest, StuckUnitsReplan) {
+    // Head-on in a one-lane corridor: nobody can pass
+    TileMap corridor(6, 1);
+    CooperativePlanner planner(&corridor, 8);
+    std::vector<QueuedMove> moves = {{1, {0, 0}, {5, 0}}, {2, {5, 0}, {0, 0}}};
+    std::vector<CooperativePlan> plans;
+    planner.plan(moves, plans);
+    expectConflictFree(corridor, moves, plans, planner.getWindow());
+    EXPECT_TRUE(plans[1].stuck);
+    EXPECT_TRUE(plans[1].steps.empty());
+    EXPECT_FALSE(plans[0].stuck);
+    EXPECT_FALSE(plans[0].reachedGoal);
+    ASSERT_FALSE(plans[0].steps.empty());
+    EXPECT_EQ(plans[0].steps.back(), (TileCoord{4, 0}));
+    EXPECT_EQ(planner.getReplanCount(), 1u);
+
+    // Units outside the batch block for the whole turn
+    TileMap open(6, 3);
+    OccupancyGrid occupancy(6, 3);
+    occupancy.place(9, 2, 0);
+    occupancy.place(10, 2, 1);
+    occupancy.place(1, 0, 1);
+    planner.setTileMap(&open);
+    planner.setOccupancyGrid(&occupancy);
+    moves = {{1, {0, 1}, {4, 1}}};
+    planner.plan(moves, plans);
+    expectConflictFree(open, moves, plans, planner.getWindow());
+    ASSERT_TRUE(plans[0].reachedGoal);
+    for (const TileCoord& step : plans[0].steps) {
+        EXPECT_FALSE(step.x == 2 && step.y < 2);
+    }
+}
+
+/**
+ * Test resolving a turn through MovementSystem: units swap sides without ever sharing a cell
+ */
+TEST(CooperativePlannerTest, ResolveTurn) {
+    EntityManager entityManager;
+    ComponentArray<Position> positions;
+    ComponentArray<GridPosition> gridPositions;
+    ComponentArray<GridMovement> gridMovements;
+    MovementSystem movement(&positions, &gridPositions, &gridMovements, nullptr, nullptr, nullptr, nullptr, nullptr);
+    TileMap map(6, 3);
+    OccupancyGrid occupancy(6, 3);
+    movement.setTileMap(&map);
+    movement.setOccupancyGrid(&occupancy);
+
+    auto createUnit = [&](int x, int y) {
+        Entity entity = entityManager.createEntity();
+        positions.add(entity.id, Position{x * 32.0f, y * 32.0f, 0.0f}, getComponentBit<Position>(), entityManager);
+        gridPositions.add(entity.id, GridPosition{x, y}, getComponentBit<GridPosition>(), entityManager);
+        gridMovements.add(entity.id, GridMovement{}, getComponentBit<GridMovement>(), entityManager);
+        return entity.id;
+    };
+    std::vector<EntityID> units = {createUnit(0, 0), createUnit(5, 0), createUnit(0, 2), createUnit(5, 2)};
+    std::vector<TileCoord> goals = {{5, 0}, {0, 0}, {5, 2}, {0, 2}};
+    movement.rebuildOccupancy(entityManager);
+    for (size_t i = 0; i < units.size(); ++i) {
+        ASSERT_TRUE(movement.queueGridMovement(units[i], goals[i].x, goals[i].y, false));
+    }
+
+    // Both outer lanes are contested head-on; all four share the middle lane to pass
+    CooperativePlanner planner(&map, 16);
+    EXPECT_EQ(planner.resolveTurn(movement), units.size());
+    for (const CooperativePlan& plan : planner.getPlans()) {
+        EXPECT_TRUE(plan.reachedGoal);
+    }
+    EXPECT_EQ(movement.getPendingMoveCount(), 0u);
+
+    // Quarter steps: occupancy always matches grid positions and no cell is shared
+    for (int frame = 0; frame < 16 * 4 + 1; ++frame) {
+        movement.update(entityManager, 0.25f);
+        for (size_t a = 0; a < units.size(); ++a) {
+            const GridPosition* at = gridPositions.get(units[a]);
+            ASSERT_EQ(occupancy.getOccupant(at->x, at->y), units[a]) << "frame " << frame;
+            for (size_t b = a + 1; b < units.size(); ++b) {
+                const GridPosition* other = gridPositions.get(units[b]);
+                ASSERT_FALSE(at->x == other->x && at->y == other->y);
+            }
+        }
+    }
+    for (size_t i = 0; i < units.size(); ++i) {
+        EXPECT_EQ(gridPositions.get(units[i])->x, goals[i].x);
+        EXPECT_EQ(gridPositions.get(units[i])->y, goals[i].y);
+    }
+    EXPECT_EQ(movement.getMovingCount(), 0u);
+
+    // Cancelled moves leave the pending list
+    ASSERT_TRUE(movement.queueGridMovement(units[0], 4, 0));
+    ASSERT_TRUE(movement.queueGridMovement(units[1], 1, 0));
+    movement.cancelQueuedMovement(units[0]);
+    std::vector<QueuedMove> queued;
+    movement.getQueuedMoves(queued);
+    ASSERT_EQ(queued.size(), 1u);
+    EXPECT_EQ(queued[0].entityId, units[1]);
+    EXPECT_EQ(queued[0].from, (TileCoord{0, 0}));
+    EXPECT_EQ(queued[0].to, (TileCoord{1, 0}));
+    EXPECT_FALSE(gridMovements.get(units[0])->hasPendingMove);
+}
+
+/**
+ * Test that the window is clamped to 1..MAX_WINDOW and long windows still plan
+ */
+TEST(CooperativePlannerTest, WindowClamped) {
+    TileMap map(200, 8);
+    CooperativePlanner planner(&map, 0);
+    EXPECT_EQ(planner.getWindow(), 1);
+    planner.setWindow(1 << 20);
+    EXPECT_EQ(planner.getWindow(), CooperativePlanner::MAX_WINDOW);
+    CooperativePlanner wide(&map, CooperativePlanner::MAX_WINDOW + 1);
+    EXPECT_EQ(wide.getWindow(), CooperativePlanner::MAX_WINDOW);
+
+    std::vector<QueuedMove> moves = {{1, {0, 4}, {150, 4}}};
+    std::vector<CooperativePlan> plans;
+    planner.plan(moves, plans);
+    ASSERT_EQ(plans.size(), 1u);
+    EXPECT_FALSE(plans[0].reachedGoal);  // Goal is past the window
+    EXPECT_EQ(plans[0].steps.size(), static_cast<size_t>(CooperativePlanner::MAX_WINDOW));
+    EXPECT_EQ(plans[0].steps.back(), (TileCoord{CooperativePlanner::MAX_WINDOW, 4}));
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include "../include/FlowField.hpp"
+#include "../include/Pathfinder.hpp"
+#include "../include/RandomGrid.hpp"
+#include "../../ecs/include/EventBus.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+using namespace ECS;
+using RandomGrid::scatterWalls;
+
+/**
+ * Test that distances equal the best A* cost to any goal and that following the field reaches a goal
+ */
+TEST(FlowFieldTest, MatchesPathfinderCosts) {
+    TileMap map(48, 40);
+    uint32_t seed = 7u;
+    scatterWalls(map, seed, 25);
+    std::vector<TileCoord> goals = {{5, 5}, {40, 30}};
+    for (const TileCoord& goal : goals) {
+        map.set(goal.x, goal.y, TileFlag::Blocked, false);
+    }
+
+    FlowField field;
+    field.build(map, goals);
+    EXPECT_EQ(field.getWidth(), 48);
+    EXPECT_GT(field.getSweepCount(), 0u);
+    EXPECT_EQ(field.getDistance(5, 5), 0.0f);
+    EXPECT_EQ(field.getDirection(5, 5), FlowField::NO_DIRECTION);
+    EXPECT_FALSE(field.isReachable(-1, 0));
+
+    Pathfinder pathfinder(&map);
+    PathResult result;
+    int reachable = 0;
+    for (int y = 0; y < map.getHeight(); y += 3) {
+        for (int x = 0; x < map.getWidth(); x += 2) {
+            float best = -1.0f;
+            for (const TileCoord& goal : goals) {
+                if (pathfinder.findPath(PathRequest{{x, y}, goal, PathAlgorithm::AStar}, result) &&
+                    (best < 0.0f || result.cost < best)) {
+                    best = result.cost;
+                }
+            }
+            ASSERT_EQ(field.isReachable(x, y), best >= 0.0f) << x << "," << y;
+            if (best < 0.0f) {
+                continue;
+            }
+            reachable++;
+            EXPECT_NEAR(field.getDistance(x, y), best, 1e-3f) << x << "," << y;
+
+            // Follow the field: legal steps, falling distance, summed cost equals the distance
+            TileCoord at{x, y};
+            TileCoord next;
+            float cost = 0.0f;
+            while (field.next(at, next)) {
+                int dx = next.x - at.x;
+                int dy = next.y - at.y;
+                ASSERT_TRUE(map.isWalkable(next.x, next.y));
+                if (dx != 0 && dy != 0) {
+                    ASSERT_TRUE(map.isWalkable(at.x + dx, at.y) && map.isWalkable(at.x, at.y + dy));
+                }
+                ASSERT_LT(field.getDistance(next.x, next.y), field.getDistance(at.x, at.y));
+                cost += (dx != 0 && dy != 0) ? 1.41421356f : 1.0f;
+                at = next;
+            }
+            EXPECT_EQ(field.getDistance(at.x, at.y), 0.0f);
+            EXPECT_NEAR(cost, best, 1e-3f);
+        }
+    }
+    EXPECT_GT(reachable, 50);
+
+    // No usable goal: nothing reachable
+    field.build(map, {{-3, 0}});
+    EXPECT_FALSE(field.isReachable(5, 5));
+    EXPECT_EQ(field.getSweepCount(), 0u);
+}
+
+/**
+ * Test cache reuse, selective invalidation through events, and eviction
+ */
+TEST(FlowFieldTest, CacheInvalidation) {
+    // Left room 0..9 open; right room 12..19 sealed off by a wall at x = 10..11
+    TileMap map(20, 10);
+    map.fillRect(10, 0, 11, 9, TileFlag::Blocked);
+
+    FlowFieldCache cache(&map, 2);
+    const FlowField& field = cache.get({{1, 1}, {2, 2}, {1, 1}});
+    EXPECT_EQ(cache.getBuildCount(), 1u);
+    EXPECT_EQ(&cache.get({{2, 2}, {1, 1}}), &field);   // Order and duplicates ignored
+    EXPECT_EQ(cache.getBuildCount(), 1u);
+    EXPECT_EQ(field.getDistance(5, 2), 3.0f);
+    EXPECT_FALSE(field.isReachable(15, 5));
+
+    EventBus bus;
+    bus.subscribe<TileChangedPayload, FlowFieldCache, &FlowFieldCache::onTilesChanged>(&cache);
+
+    // Edit inside the sealed room: field unaffected
+    map.set(15, 5, TileFlag::Blocked);
+    bus.push(TileChangedPayload{15, 5, 15, 5});
+    bus.dispatch();
+    cache.get({{1, 1}, {2, 2}});
+    EXPECT_EQ(cache.getBuildCount(), 1u);
+
+    // Open the wall next to reachable tiles: rebuilt in place on the next get
+    map.fillRect(10, 5, 11, 5, TileFlag::Blocked, false);
+    bus.push(TileChangedPayload{10, 5, 11, 5});
+    bus.dispatch();
+    EXPECT_EQ(&cache.get({{1, 1}, {2, 2}}), &field);
+    EXPECT_EQ(cache.getBuildCount(), 2u);
+    EXPECT_TRUE(field.isReachable(15, 4));
+
+    // Capacity 2: a third goal set replaces the least recently used field
+    cache.get(TileCoord{8, 8});
+    cache.get({{1, 1}, {2, 2}});
+    cache.get(TileCoord{0, 9});
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.getBuildCount(), 4u);
+    cache.get({{1, 1}, {2, 2}});
+    EXPECT_EQ(cache.getBuildCount(), 4u);
+    cache.get(TileCoord{8, 8});
+    EXPECT_EQ(cache.getBuildCount(), 5u);
+
+    cache.setTileMap(nullptr);
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_EQ(cache.get(TileCoord{1, 1}).getWidth(), 0);
+}
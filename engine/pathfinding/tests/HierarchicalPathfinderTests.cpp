@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include "../include/HierarchicalPathfinder.hpp"
+#include "../include/Pathfinder.hpp"
+#include "../include/RandomGrid.hpp"
+#include <cstdlib>
+#include <vector>
+
+using namespace ECS;
+using RandomGrid::randomBelow;
+using RandomGrid::scatterWalls;
+
+namespace {
+
+// Refine a whole route; checks step adjacency/walkability and returns the summed step cost (< 0 if refinement failed)
+float refineAll(HierarchicalPathfinder& hpa, const TileMap& map, HierarchicalPath& route, std::vector<TileCoord>& steps) {
+    steps.clear();
+    while (!route.isComplete()) {
+        if (!hpa.refineNext(route, steps)) {
+            return -1.0f;
+        }
+    }
+    TileCoord at = route.start;
+    float cost = 0.0f;
+    for (const TileCoord& step : steps) {
+        int dx = step.x - at.x;
+        int dy = step.y - at.y;
+        EXPECT_TRUE(std::abs(dx) <= 1 && std::abs(dy) <= 1 && (dx != 0 || dy != 0));
+        EXPECT_TRUE(map.isWalkable(step.x, step.y));
+        if (dx != 0 && dy != 0) {
+            EXPECT_TRUE(map.isWalkable(at.x + dx, at.y) && map.isWalkable(at.x, at.y + dy));
+        }
+        cost += (dx != 0 && dy != 0) ? 1.41421356f : 1.0f;
+        at = step;
+    }
+    return cost;
+}
+
+} // namespace
+
+/**
+ * Test abstract graph construction and lazily refined routes on an open map
+ */
+TEST(HierarchicalPathfinderTest, BuildAndRefine) {
+    TileMap map(64, 48);
+    HierarchicalPathfinder hpa(&map, 16);
+    EXPECT_EQ(hpa.getClusterCount(), 12u);
+    EXPECT_GT(hpa.getNodeCount(), 0u);
+    EXPECT_GT(hpa.getEdgeCount(), hpa.getNodeCount());
+    EXPECT_FALSE(hpa.hasPendingRepairs());
+
+    HierarchicalPath route;
+    ASSERT_TRUE(hpa.findPath({1, 1}, {62, 45}, route));
+    EXPECT_GT(route.waypoints.size(), 2u);
+    EXPECT_EQ(route.waypoints.back(), (TileCoord{62, 45}));
+
+    // One segment at a time
+    std::vector<TileCoord> steps;
+    ASSERT_TRUE(hpa.refineNext(route, steps));
+    EXPECT_EQ(route.nextWaypoint, 1u);
+    EXPECT_EQ(steps.back(), route.waypoints[0]);
+
+    route.nextWaypoint = 0;
+    float stepCost = refineAll(hpa, map, route, steps);
+    EXPECT_NEAR(stepCost, route.cost, 1e-3f);
+    EXPECT_EQ(steps.back(), (TileCoord{62, 45}));
+    EXPECT_FALSE(hpa.refineNext(route, steps));
+
+    // Same-cluster queries go direct
+    ASSERT_TRUE(hpa.findPath({2, 2}, {9, 5}, route));
+    EXPECT_EQ(route.waypoints.size(), 1u);
+    EXPECT_NEAR(route.cost, Pathfinder::octileDistance({2, 2}, {9, 5}), 1e-4f);
+    EXPECT_FALSE(hpa.findPath({2, 2}, {64, 5}, route));
+}
+
+/**
+ * Test node and edge counts on open maps where the abstract graph is known
+ */
+TEST(HierarchicalPathfinderTest, CountsEachEdgeOnce) {
+    // Two clusters: one 16-tile border run gets a transition at each end
+    TileMap pair(32, 16);
+    HierarchicalPathfinder twoClusters(&pair, 16);
+    EXPECT_EQ(twoClusters.getNodeCount(), 4u);
+    EXPECT_EQ(twoClusters.getEdgeCount(), 4u);  // 2 crossings + 1 intra edge per cluster
+
+    // Three in a row: the middle cluster links all four of its nodes
+    TileMap row(48, 16);
+    HierarchicalPathfinder threeClusters(&row, 16);
+    EXPECT_EQ(threeClusters.getNodeCount(), 8u);
+    EXPECT_EQ(threeClusters.getEdgeCount(), 12u);  // 4 crossings + 1 + 6 + 1 intra edges
+}
+
+/**
+ * Test routes on random maps are complete and near-optimal
+ */
+TEST(HierarchicalPathfinderTest, NearOptimalOnRandomMaps) {
+    TileMap map(96, 80);
+    uint32_t seed = 11u;
+    scatterWalls(map, seed, 22);
+    HierarchicalPathfinder hpa(&map, 12);
+    Pathfinder exact(&map);
+
+    size_t solved = 0;
+    double totalRatio = 0.0;
+    HierarchicalPath route;
+    PathResult optimal;
+    std::vector<TileCoord> steps;
+    for (int query = 0; query < 150; ++query) {
+        TileCoord start{randomBelow(seed, 96), randomBelow(seed, 80)};
+        TileCoord goal{randomBelow(seed, 96), randomBelow(seed, 80)};
+        bool expected = exact.findPath(PathRequest{start, goal, PathAlgorithm::JumpPoint}, optimal);
+        ASSERT_EQ(hpa.findPath(start, goal, route), expected) << "query " << query;
+        if (!expected || start == goal) {
+            continue;
+        }
+        solved++;
+        float stepCost = refineAll(hpa, map, route, steps);
+        ASSERT_NEAR(stepCost, route.cost, 1e-2f);
+        ASSERT_EQ(steps.back(), goal);
+        EXPECT_GE(route.cost, optimal.cost - 1e-3f);
+        totalRatio += route.cost / optimal.cost;
+    }
+    ASSERT_GT(solved, 50u);
+    EXPECT_LT(totalRatio / static_cast<double>(solved), 1.15);
+}
+
+/**
+ * Test tile changes repair only nearby clusters and match a full rebuild
+ */
+TEST(HierarchicalPathfinderTest, LocalRepair) {
+    TileMap map(64, 64);
+    map.fillRect(32, 0, 32, 63, TileFlag::Blocked); // Wall splitting the map
+    HierarchicalPathfinder hpa(&map, 16);
+
+    HierarchicalPath route;
+    EXPECT_FALSE(hpa.findPath({5, 5}, {60, 60}, route));
+
+    // Destroy one wall tile: one dirty cluster, itself plus four neighbours re-edged
+    map.set(32, 40, TileFlag::Blocked, false);
+    hpa.onTileChanged(32, 40);
+    EXPECT_TRUE(hpa.hasPendingRepairs());
+    EXPECT_EQ(hpa.repair(), 5u);
+    EXPECT_FALSE(hpa.hasPendingRepairs());
+
+    ASSERT_TRUE(hpa.findPath({5, 5}, {60, 60}, route));
+    HierarchicalPathfinder fresh(&map, 16);
+    HierarchicalPath freshRoute;
+    ASSERT_TRUE(fresh.findPath({5, 5}, {60, 60}, freshRoute));
+    EXPECT_EQ(hpa.getNodeCount(), fresh.getNodeCount());
+    EXPECT_EQ(hpa.getEdgeCount(), fresh.getEdgeCount());
+    EXPECT_FLOAT_EQ(route.cost, freshRoute.cost);
+
+    // Re-blocking before refinement: the crossing segment fails and the route is re-planned
+    map.set(32, 40, TileFlag::Blocked);
+    hpa.onAreaChanged(30, 38, 34, 42);
+    std::vector<TileCoord> steps;
+    bool refined = true;
+    while (refined && !route.isComplete()) {
+        refined = hpa.refineNext(route, steps);
+    }
+    EXPECT_FALSE(refined);
+    EXPECT_FALSE(hpa.findPath({5, 5}, {60, 60}, route));
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "../include/MovementRange.hpp"
+#include "../include/Pathfinder.hpp"
+#include "../include/RandomGrid.hpp"
+#include "../../ecs/include/EventBus.hpp"
+#include <cstdlib>
+#include <vector>
+
+using namespace ECS;
+using RandomGrid::scatterWalls;
+
+/**
+ * Test reachable tiles, costs and rebuilt paths against A* on a random map
+ */
+TEST(MovementRangeTest, MatchesPathfinderCosts) {
+    TileMap map(40, 40);
+    uint32_t seed = 11u;
+    scatterWalls(map, seed, 25);
+    TileCoord origin{20, 20};
+    map.set(origin.x, origin.y, TileFlag::Blocked, false);
+
+    MovementRange range;
+    range.compute(map, nullptr, INVALID_ENTITY, origin, 6.5f);
+    EXPECT_EQ(range.getMinX(), 14);
+    EXPECT_EQ(range.getWidth(), 13);
+    EXPECT_TRUE(range.contains(origin.x, origin.y));
+    EXPECT_EQ(range.getCost(origin.x, origin.y), 0.0f);
+
+    Pathfinder pathfinder(&map);
+    PathResult result;
+    size_t expected = 0;
+    std::vector<TileCoord> steps;
+    for (int y = 10; y <= 30; ++y) {
+        for (int x = 10; x <= 30; ++x) {
+            bool found = pathfinder.findPath(PathRequest{origin, {x, y}, PathAlgorithm::AStar}, result);
+            bool inRange = found && result.cost <= 6.5f;
+            ASSERT_EQ(range.contains(x, y), inRange) << x << "," << y;
+            if (!inRange) {
+                continue;
+            }
+            expected++;
+            EXPECT_NEAR(range.getCost(x, y), result.cost, 1e-4f);
+
+            // Rebuilt path: legal steps whose cost matches
+            steps.clear();
+            ASSERT_TRUE(range.buildPath({x, y}, steps));
+            TileCoord at = origin;
+            float cost = 0.0f;
+            for (const TileCoord& step : steps) {
+                int dx = step.x - at.x;
+                int dy = step.y - at.y;
+                ASSERT_TRUE(std::abs(dx) <= 1 && std::abs(dy) <= 1 && map.isWalkable(step.x, step.y));
+                if (dx != 0 && dy != 0) {
+                    ASSERT_TRUE(map.isWalkable(at.x + dx, at.y) && map.isWalkable(at.x, at.y + dy));
+                }
+                cost += (dx != 0 && dy != 0) ? 1.41421356f : 1.0f;
+                at = step;
+            }
+            EXPECT_EQ(at, (TileCoord{x, y}));
+            EXPECT_NEAR(cost, range.getCost(x, y), 1e-4f);
+        }
+    }
+    EXPECT_EQ(range.getReachableCount(), expected);
+
+    std::vector<TileCoord> tiles;
+    range.collect(tiles);
+    EXPECT_EQ(tiles.size(), expected);
+    for (const TileCoord& tile : tiles) {
+        EXPECT_TRUE(range.contains(tile.x, tile.y));
+    }
+    EXPECT_FALSE(range.buildPath({0, 0}, steps));
+}
+
+/**
+ * Test that other units block and the moving unit does not block itself
+ */
+TEST(MovementRangeTest, UnitsBlock) {
+    TileMap map(10, 10);
+    OccupancyGrid occupancy(10, 10);
+    occupancy.place(1, 5, 5);   // Mover
+    occupancy.place(2, 6, 5);   // Blocker east
+    occupancy.reserve(3, 4, 5); // Another unit moving in west
+
+    MovementRange range;
+    range.compute(map, &occupancy, 1, {5, 5}, 1.0f);
+    EXPECT_TRUE(range.contains(5, 5));
+    EXPECT_FALSE(range.contains(6, 5));
+    EXPECT_FALSE(range.contains(4, 5));
+    EXPECT_TRUE(range.contains(5, 4));
+    EXPECT_TRUE(range.contains(5, 6));
+    EXPECT_FALSE(range.contains(6, 6));  // Diagonal costs more than the budget
+    EXPECT_EQ(range.getReachableCount(), 3u);
+
+    // Two steps east must go around the blocker
+    range.compute(map, &occupancy, 1, {5, 5}, 2.0f);
+    EXPECT_FALSE(range.contains(7, 5));
+    range.compute(map, &occupancy, 1, {5, 5}, 2.9f);
+    EXPECT_NEAR(range.getCost(7, 5), 2.0f * 1.41421356f, 1e-4f);
+
+    // Unwalkable origin: empty
+    map.set(0, 0, TileFlag::Blocked);
+    range.compute(map, &occupancy, 4, {0, 0}, 3.0f);
+    EXPECT_EQ(range.getReachableCount(), 0u);
+    EXPECT_FALSE(range.contains(0, 0));
+}
+
+/**
+ * Test per-unit caching and invalidation by relevant tile and occupant changes only
+ */
+TEST(MovementRangeTest, CacheInvalidation) {
+    TileMap map(40, 40);
+    OccupancyGrid occupancy(40, 40);
+    occupancy.place(1, 5, 5);
+    MovementRangeCache cache(&map, &occupancy);
+    EventBus bus;
+    bus.subscribe<TileChangedPayload, MovementRangeCache, &MovementRangeCache::onTilesChanged>(&cache);
+
+    const MovementRange& range = cache.get(1, {5, 5}, 3.0f);
+    EXPECT_EQ(cache.getComputeCount(), 1u);
+    EXPECT_EQ(&cache.get(1, {5, 5}, 3.0f), &range);
+    EXPECT_EQ(cache.getComputeCount(), 1u);
+
+    // Far away changes keep the range
+    occupancy.place(2, 30, 30);
+    map.set(30, 31, TileFlag::Blocked);
+    bus.push(TileChangedPayload{30, 31, 30, 31});
+    bus.dispatch();
+    cache.get(1, {5, 5}, 3.0f);
+    EXPECT_EQ(cache.getComputeCount(), 1u);
+
+    // A unit stepping into the range
+    occupancy.place(3, 6, 5);
+    EXPECT_FALSE(cache.get(1, {5, 5}, 3.0f).contains(6, 5));
+    EXPECT_EQ(cache.getComputeCount(), 2u);
+
+    // A wall next to reachable tiles
+    map.set(5, 7, TileFlag::Blocked);
+    bus.push(TileChangedPayload{5, 7, 5, 7});
+    bus.dispatch();
+    EXPECT_FALSE(cache.get(1, {5, 5}, 3.0f).contains(5, 7));
+    EXPECT_EQ(cache.getComputeCount(), 3u);
+
+    // New origin or budget recomputes; other units have their own entries
+    cache.get(1, {5, 4}, 3.0f);
+    cache.get(1, {5, 4}, 2.0f);
+    cache.get(2, {30, 30}, 2.0f);
+    EXPECT_EQ(cache.getComputeCount(), 6u);
+    EXPECT_EQ(cache.size(), 2u);
+    cache.erase(2);
+    EXPECT_EQ(cache.size(), 1u);
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include "../include/Pathfinder.hpp"
+#include "../include/RandomGrid.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace ECS;
+using RandomGrid::randomBelow;
+using RandomGrid::scatterWalls;
+
+namespace {
+
+// Every step is one walkable cell away, never cuts a corner, and the path ends at the goal
+void expectValidPath(const TileMap& map, const PathRequest& request, const PathResult& result) {
+    ASSERT_TRUE(result.found);
+    TileCoord at = request.start;
+    float cost = 0.0f;
+    for (const TileCoord& step : result.path) {
+        int dx = step.x - at.x;
+        int dy = step.y - at.y;
+        ASSERT_TRUE(std::abs(dx) <= 1 && std::abs(dy) <= 1 && (dx != 0 || dy != 0));
+        ASSERT_TRUE(map.isWalkable(step.x, step.y));
+        if (dx != 0 && dy != 0) {
+            ASSERT_TRUE(map.isWalkable(at.x + dx, at.y) && map.isWalkable(at.x, at.y + dy));
+            cost += 1.41421356f;
+        } else {
+            cost += 1.0f;
+        }
+        at = step;
+    }
+    EXPECT_EQ(at, request.goal);
+    EXPECT_NEAR(cost, result.cost, 1e-3f);
+}
+
+} // namespace
+
+/**
+ * Test straight, diagonal and trivial paths on an open map
+ */
+TEST(PathfinderTest, OpenMap) {
+    TileMap map(16, 16);
+    Pathfinder pathfinder(&map);
+    EXPECT_EQ(pathfinder.getTileMap(), &map);
+
+    for (PathAlgorithm algorithm : {PathAlgorithm::AStar, PathAlgorithm::JumpPoint}) {
+        PathResult result;
+        PathRequest straight{{1, 1}, {9, 1}, algorithm};
+        ASSERT_TRUE(pathfinder.findPath(straight, result));
+        EXPECT_FLOAT_EQ(result.cost, 8.0f);
+        ASSERT_EQ(result.path.size(), 8u);
+        EXPECT_EQ(result.path.front(), (TileCoord{2, 1}));
+        expectValidPath(map, straight, result);
+
+        PathRequest diagonal{{0, 0}, {5, 3}, algorithm};
+        ASSERT_TRUE(pathfinder.findPath(diagonal, result));
+        EXPECT_NEAR(result.cost, Pathfinder::octileDistance(diagonal.start, diagonal.goal), 1e-4f);
+        expectValidPath(map, diagonal, result);
+
+        ASSERT_TRUE(pathfinder.findPath(PathRequest{{4, 4}, {4, 4}, algorithm}, result));
+        EXPECT_TRUE(result.path.empty());
+        EXPECT_FLOAT_EQ(result.cost, 0.0f);
+    }
+}
+
+/**
+ * Test walls, corner cutting and unreachable goals
+ */
+TEST(PathfinderTest, ObstaclesAndFailure) {
+    TileMap map(12, 12);
+    map.fillRect(6, 0, 6, 10, TileFlag::Blocked); // Wall with a gap at y = 11
+    Pathfinder pathfinder(&map);
+
+    for (PathAlgorithm algorithm : {PathAlgorithm::AStar, PathAlgorithm::JumpPoint}) {
+        PathResult result;
+        PathRequest around{{2, 2}, {10, 2}, algorithm};
+        ASSERT_TRUE(pathfinder.findPath(around, result));
+        expectValidPath(map, around, result);
+        bool usedGap = false;
+        for (const TileCoord& step : result.path) {
+            usedGap = usedGap || (step.x == 6 && step.y == 11);
+        }
+        EXPECT_TRUE(usedGap);
+
+        // Blocked goal, out-of-bounds start and a sealed gap all fail
+        EXPECT_FALSE(pathfinder.findPath(PathRequest{{2, 2}, {6, 3}, algorithm}, result));
+        EXPECT_FALSE(pathfinder.findPath(PathRequest{{-1, 2}, {10, 2}, algorithm}, result));
+        map.set(6, 11, TileFlag::Blocked);
+        EXPECT_FALSE(pathfinder.findPath(around, result));
+        EXPECT_TRUE(result.path.empty());
+        map.set(6, 11, TileFlag::Blocked, false);
+    }
+
+    // Diagonal squeeze between two blocked corners is not allowed
+    TileMap squeeze(3, 3);
+    squeeze.set(1, 0, TileFlag::Blocked);
+    squeeze.set(0, 1, TileFlag::Blocked);
+    squeeze.set(2, 1, TileFlag::Blocked);
+    squeeze.set(1, 2, TileFlag::Blocked);
+    Pathfinder squeezeFinder(&squeeze);
+    PathResult result;
+    EXPECT_FALSE(squeezeFinder.findPath(PathRequest{{0, 0}, {1, 1}, PathAlgorithm::JumpPoint}, result));
+    EXPECT_FALSE(squeezeFinder.findPath(PathRequest{{0, 0}, {1, 1}, PathAlgorithm::AStar}, result));
+}
+
+/**
+ * Test JPS returns A*-optimal paths while expanding fewer nodes on random maps
+ */
+TEST(PathfinderTest, JumpPointMatchesAStar) {
+    TileMap map(150, 40);  // Rows span three words: jumps cross word boundaries both ways
+    uint32_t mapSeed = 7u;
+    scatterWalls(map, mapSeed, 25);
+    Pathfinder pathfinder(&map);
+
+    uint32_t seed = 99u;
+    size_t solved = 0;
+    size_t aStarExpanded = 0;
+    size_t jumpExpanded = 0;
+    PathResult aStar;
+    PathResult jumpPoint;
+    for (int query = 0; query < 300; ++query) {
+        TileCoord start{randomBelow(seed, 150), randomBelow(seed, 40)};
+        TileCoord goal{randomBelow(seed, 150), randomBelow(seed, 40)};
+        PathRequest aStarRequest{start, goal, PathAlgorithm::AStar};
+        PathRequest jumpRequest{start, goal, PathAlgorithm::JumpPoint};
+
+        bool aStarFound = pathfinder.findPath(aStarRequest, aStar);
+        bool jumpFound = pathfinder.findPath(jumpRequest, jumpPoint);
+        ASSERT_EQ(aStarFound, jumpFound) << "query " << query;
+        if (!aStarFound) {
+            continue;
+        }
+        solved++;
+        ASSERT_NEAR(aStar.cost, jumpPoint.cost, 1e-3f) << "query " << query;
+        expectValidPath(map, jumpRequest, jumpPoint);
+        aStarExpanded += aStar.expanded;
+        jumpExpanded += jumpPoint.expanded;
+    }
+    EXPECT_GT(solved, 100u);
+    EXPECT_LT(jumpExpanded, aStarExpanded);
+}
+
+/**
+ * Test bulk requests on a worker pool match single queries
+ */
+TEST(PathfinderTest, BulkRequestsOnWorkerPool) {
+    TileMap map(64, 64);
+    uint32_t mapSeed = 3u;
+    scatterWalls(map, mapSeed, 20);
+    WorkerPool pool(3);
+    Pathfinder pathfinder(&map, &pool);
+    EXPECT_EQ(pathfinder.getWorkerPool(), &pool);
+
+    uint32_t seed = 5u;
+    std::vector<PathRequest> requests;
+    for (int i = 0; i < 64; ++i) {
+        TileCoord start{randomBelow(seed, 64), randomBelow(seed, 64)};
+        TileCoord goal{randomBelow(seed, 64), randomBelow(seed, 64)};
+        requests.push_back(PathRequest{start, goal, (i % 2) ? PathAlgorithm::AStar : PathAlgorithm::JumpPoint});
+    }
+
+    std::vector<PathResult> results;
+    pathfinder.findPaths(requests, results);
+    ASSERT_EQ(results.size(), requests.size());
+
+    Pathfinder serial(&map);
+    for (size_t i = 0; i < requests.size(); ++i) {
+        PathResult expected;
+        serial.findPath(requests[i], expected);
+        EXPECT_EQ(results[i].found, expected.found);
+        EXPECT_FLOAT_EQ(results[i].cost, expected.cost);
+        EXPECT_EQ(results[i].path, expected.path);
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../ecs/components/include/Transform.hpp"
+#include <cstdint>
 
 namespace ECS {
 
@@ -29,6 +30,12 @@ struct GridMovement {
     int pendingX = 0;              // Queued target X coordinate
     int pendingY = 0;              // Queued target Y coordinate
     
+    // Multi-step path: steps [pathNext, pathEnd) of MovementSystem's PathPool
+    // follow the current target and are started automatically on completion
+    uint32_t pathNext = 0;         // Offset of the next step
+    uint32_t pathEnd = 0;          // One past the last step
+    bool validatePath = true;      // Check each step like requestGridMovement(validateBounds)
+    
     // Zero initialization compliance (ZII)
     GridMovement() = default;
     
@@ -46,6 +53,20 @@ struct GridMovement {
         return progress >= 1.0f;
     }
     
+    /**
+     * Check if path steps remain after the current target
+     */
+    bool hasPath() const {
+        return pathNext < pathEnd;
+    }
+    
+    /**
+     * Get number of path steps after the current target
+     */
+    uint32_t getRemainingPathSteps() const {
+        return pathEnd - pathNext;
+    }
+    
     /**
      * Reset movement state (called when movement completes)
      * Note: progress and hasPendingMove are intentionally NOT reset
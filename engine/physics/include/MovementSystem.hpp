@@ -4,11 +4,40 @@
 #include "../../ecs/include/ComponentArray.hpp"
 #include "../../ecs/components/include/Transform.hpp"
 #include "../../ecs/systems/include/IInputManager.hpp"
+#include "../../ecs/systems/include/ISystem.hpp"
 #include "GridMovement.hpp"
+#include "OccupancyGrid.hpp"
+#include "PathPool.hpp"
 #include "Physics.hpp"
+#include "TileMap.hpp"
+#include <cstdint>
+#include <vector>
 
 namespace ECS {
 
+/**
+ * QueuedMoveOrder - Order in which executeQueuedMovements starts pending moves
+ * 
+ * Queued:       first-queued first (re-queueing keeps the original slot)
+ * ByEntityID:   ascending entity ID
+ * ByInitiative: descending initiative, ties broken by ascending entity ID
+ */
+enum class QueuedMoveOrder : uint8_t {
+    Queued = 0,
+    ByEntityID,
+    ByInitiative
+};
+
+/**
+ * QueuedMove - A pending move with the cell the entity currently stands on
+ * (see MovementSystem::getQueuedMoves)
+ */
+struct QueuedMove {
+    EntityID entityId;
+    TileCoord from;
+    TileCoord to;
+};
+
 /**
  * MovementSystem - Handles grid-based movement with smooth visual transitions
  * 
@@ -21,8 +50,39 @@ namespace ECS {
  * 
  * System operates on entities with: GridPosition + GridMovement + Position
  * Optional components: Velocity, Acceleration, GridBounds, MovementConstraints
+ * 
+ * Grid animation only visits the active set: entities enter it when a move
+ * starts (requestGridMovement / executeQueuedMovements) and leave on
+ * completion or stopMovement, so idle units cost nothing per frame.
+ * Moves must be started through the system to be animated.
+ * 
+ * With an OccupancyGrid set, a move reserves its target cell when it
+ * starts, so a second unit heading for the same cell is rejected at request
+ * time, and the occupant is updated when the move completes. The target
+ * must be free in the grid even for unvalidated moves: a unit the grid
+ * could not hold would be invisible to collision checks. A move whose
+ * target was taken by a unit placed outside the system ends on its start
+ * cell.
+ * 
+ * Multi-step paths (requestGridPath) are stored in a shared PathPool and
+ * consumed here: when a step completes, the next one starts in the same
+ * update with the leftover progress carried over, so callers issue one
+ * request per path. Next steps start after every completion of the update
+ * has been applied, so units stepping in lockstep can follow each other
+ * into cells vacated that frame. A step that fails validation when it is
+ * reached, or whose cell is taken in the occupancy grid (validated or
+ * not), ends the path at the current cell.
+ * 
+ * Turn-based moves go through a pending list filled by queueGridMovement,
+ * so executeQueuedMovements costs O(pending) and starts moves in a
+ * deterministic order (see QueuedMoveOrder).
+ * 
+ * Runs in the Simulation phase and may run in parallel with other systems
+ * whose component and resource access does not overlap (see
+ * getComponentWrites and getResourceWrites). An attached occupancy grid and
+ * the path pool are written during update; an attached tile map is read.
  */
-class MovementSystem {
+class MovementSystem : public ISystem {
 public:
     /**
      * Constructor with dependency injection for component arrays and input manager
@@ -41,7 +101,7 @@ public:
      */
     explicit MovementSystem(IInputManager* inputManager);
     
-    ~MovementSystem() = default;
+    ~MovementSystem() override = default;
     
     /**
      * Set component arrays after construction (for lazy injection)
@@ -61,6 +121,40 @@ public:
      */
     void update(EntityManager& entityManager, float deltaTime = 1.0f);
     
+    /**
+     * ISystem entry point (same as update(entityManager, deltaTime))
+     */
+    void update(float deltaTime, EntityManager& entityManager) override;
+    
+    /**
+     * Get required components (Position; grid and physics paths filter further)
+     */
+    uint64_t getRequiredComponents() const override;
+    
+    /**
+     * Get components read (all movement inputs, including optional ones)
+     */
+    uint64_t getComponentReads() const override;
+    
+    /**
+     * Get components written (Position, GridPosition, GridMovement, Velocity)
+     */
+    uint64_t getComponentWrites() const override;
+    
+    /**
+     * Get resources read (the tile map, when one is attached)
+     */
+    uint64_t getResourceReads() const override;
+    
+    /**
+     * Get resources written (the path pool, plus the occupancy grid when attached)
+     */
+    uint64_t getResourceWrites() const override;
+    
+    SystemPhase getPhase() const override;
+    bool canRunInParallel() const override;
+    const char* getName() const override;
+    
     /**
      * Set which entity should be controlled by input (if input manager available)
      * @param entityId ID of entity to control, or INVALID_ENTITY to disable
@@ -77,27 +171,94 @@ public:
      * @param entityId Target entity
      * @param targetX Target grid X coordinate  
      * @param targetY Target grid Y coordinate
-     * @param validateBounds Check GridBounds component if present
+     * @param validateBounds Check GridBounds component and tile map if present
+     *        (an occupancy grid, if set, is always checked)
      * @return true if movement was initiated, false if invalid/blocked
      */
     bool requestGridMovement(EntityID entityId, int targetX, int targetY, bool validateBounds = true);
     
+    /**
+     * Follow a multi-step path (replaces any current move and path)
+     * The first step starts immediately; each later step starts when the
+     * previous one completes and is validated at that point.
+     * @param entityId Target entity
+     * @param steps Cells to visit after the current one, usually adjacent in sequence
+     * @param count Number of steps
+     * @param validateBounds Check each step like requestGridMovement
+     * @return true if the first step started
+     */
+    bool requestGridPath(EntityID entityId, const TileCoord* steps, size_t count, bool validateBounds = true);
+    bool requestGridPath(EntityID entityId, const std::vector<TileCoord>& steps, bool validateBounds = true);
+    
+    /**
+     * Drop the remaining path steps (the current step still completes)
+     */
+    void clearGridPath(EntityID entityId);
+    
+    /**
+     * Get number of path steps left after the current target
+     */
+    size_t getRemainingPathSteps(EntityID entityId) const;
+    
+    /**
+     * Get shared path storage (for diagnostics)
+     */
+    const PathPool& getPathPool() const;
+    
     /**
      * Queue grid movement for turn-based systems
      * @param entityId Target entity
      * @param targetX Target grid X coordinate
      * @param targetY Target grid Y coordinate  
-     * @param validateBounds Check GridBounds component if present
+     * @param validateBounds Check GridBounds component and tile map if present
+     * @param initiative Priority under QueuedMoveOrder::ByInitiative (higher starts first)
      * @return true if movement was queued, false if invalid
      */
-    bool queueGridMovement(EntityID entityId, int targetX, int targetY, bool validateBounds = true);
+    bool queueGridMovement(EntityID entityId, int targetX, int targetY, bool validateBounds = true,
+                           int initiative = 0);
     
     /**
      * Execute all queued movements (for turn-based systems)
+     * Moves start in the order given by getQueuedMoveOrder(). Entities still
+     * mid-move keep their pending move for a later call. With an occupancy
+     * grid, a move whose target is taken (by a unit, or by an earlier move
+     * in the order) is dropped, whether or not it was validated when queued.
      * @param entityManager Entity manager
      */
     void executeQueuedMovements(EntityManager& entityManager);
     
+    /**
+     * Set ordering policy for executeQueuedMovements
+     */
+    void setQueuedMoveOrder(QueuedMoveOrder order);
+    
+    /**
+     * Get ordering policy for executeQueuedMovements
+     */
+    QueuedMoveOrder getQueuedMoveOrder() const;
+    
+    /**
+     * Get number of entries in the pending-move list
+     */
+    size_t getPendingMoveCount() const;
+    
+    /**
+     * Get pending entities in the order executeQueuedMovements would start them
+     */
+    std::vector<EntityID> getPendingMoveOrder() const;
+    
+    /**
+     * Get pending moves in start order, for planners that resolve a turn
+     * themselves (entities still mid-move are left out)
+     * @param moves Output, cleared first
+     */
+    void getQueuedMoves(std::vector<QueuedMove>& moves) const;
+    
+    /**
+     * Drop an entity's pending move (no-op if it has none)
+     */
+    void cancelQueuedMovement(EntityID entityId);
+    
     /**
      * Check if entity is currently moving
      * @param entityId Entity to check
@@ -105,6 +266,16 @@ public:
      */
     bool isEntityMoving(EntityID entityId, EntityManager& entityManager) const;
     
+    /**
+     * Get number of entities in the active (moving) set
+     */
+    size_t getMovingCount() const;
+    
+    /**
+     * Get entities in the active set (unordered)
+     */
+    const std::vector<EntityID>& getMovingEntities() const;
+    
     /**
      * Stop movement for specific entity
      * @param entityId Entity to stop
@@ -134,6 +305,35 @@ public:
      * Get grid cell size
      */
     float getGridCellSize() const;
+    
+    /**
+     * Set level tile map used to validate movement targets
+     * @param map Tile map (not owned), or nullptr to disable tile checks
+     */
+    void setTileMap(const TileMap* map);
+    
+    /**
+     * Get level tile map (nullptr if none)
+     */
+    const TileMap* getTileMap() const;
+    
+    /**
+     * Set occupancy grid maintained by this system
+     * @param grid Occupancy grid (not owned), or nullptr to disable unit collision
+     */
+    void setOccupancyGrid(OccupancyGrid* grid);
+    
+    /**
+     * Get occupancy grid (nullptr if none)
+     */
+    OccupancyGrid* getOccupancyGrid() const;
+    
+    /**
+     * Refill the occupancy grid from all GridPosition components
+     * Reservations are restored for entities in the active set.
+     * @param entityManager Entity manager
+     */
+    void rebuildOccupancy(EntityManager& entityManager);
 
 private:
     /**
@@ -151,6 +351,37 @@ private:
      */
     void updatePhysicsMovement(EntityManager& entityManager, float deltaTime);
     
+    /**
+     * Add entity to the active set (no-op if present)
+     */
+    void markMoving(EntityID entityId);
+    
+    /**
+     * Remove entity from the active set (swap-with-last; no-op if absent)
+     */
+    void unmarkMoving(EntityID entityId);
+    
+    /**
+     * Check active set membership in O(1)
+     */
+    bool isMarkedMoving(EntityID entityId) const;
+    
+    /**
+     * Release the occupancy reservation on an entity's current move target
+     */
+    void releaseTarget(EntityID entityId);
+    
+    /**
+     * Free an entity's path block and reset its path cursor (gridMovement may be null)
+     */
+    void releasePath(EntityID entityId, GridMovement* gridMovement);
+    
+    /**
+     * Start the next path step after a completed move
+     * @return false if the path ended or its next step is blocked
+     */
+    bool startNextPathStep(EntityID entityId, GridMovement& gridMovement);
+    
     /**
      * Convert grid coordinates to world position
      * @param gridX Grid X coordinate
@@ -174,10 +405,15 @@ private:
      * @param entityId Entity attempting movement
      * @param targetX Target grid X
      * @param targetY Target grid Y
-     * @param entityManager Entity manager
      * @return true if movement is valid
      */
-    bool validateMovement(EntityID entityId, int targetX, int targetY, EntityManager& entityManager) const;
+    bool validateMovement(EntityID entityId, int targetX, int targetY) const;
+    
+    /**
+     * Place Position between the grid cell and the move target by progress
+     */
+    void interpolateGridMovement(const GridPosition& gridPosition, const GridMovement& gridMovement,
+                                 Position& position) const;
     
     /**
      * Interpolate between start and target positions based on progress
@@ -206,9 +442,35 @@ private:
     EntityID controlledEntity;
     float globalSpeedMultiplier;
     float gridCellSize;
+    const TileMap* tileMap = nullptr;
+    OccupancyGrid* occupancy = nullptr;
+    PathPool pathPool;
     
     // Input debouncing for controlled entity
     bool lastFrameKeyStates[4];  // [Left, Right, Up, Down]
+    
+    // Active set of moving entities (sparse set)
+    static constexpr uint32_t NO_SLOT = UINT32_MAX;  // Sparse entry of an absent entity
+    std::vector<EntityID> movingEntities;  // Dense: entities mid-move
+    std::vector<uint32_t> movingSlots;     // Sparse: EntityID -> index in movingEntities
+    std::vector<EntityID> pathAdvances;    // Completed a path step this update; next step pending
+    
+    // Pending-move list filled by queueGridMovement
+    struct PendingMove {
+        EntityID entityId;
+        int initiative;
+        uint64_t sequence;  // Queue order, for QueuedMoveOrder::Queued
+    };
+    std::vector<PendingMove> pendingMoves;
+    std::vector<uint32_t> pendingSlots;    // Sparse: EntityID -> index in pendingMoves
+    mutable std::vector<PendingMove> sortedPendingMoves;  // Scratch for the start-order queries, reused across calls
+    uint64_t nextPendingSequence = 0;
+    QueuedMoveOrder queuedMoveOrder = QueuedMoveOrder::Queued;
+    
+    /**
+     * Sort pending moves by an ordering policy (slots are not updated)
+     */
+    static void sortPendingMoves(std::vector<PendingMove>& moves, QueuedMoveOrder order);
 };
 
 } // namespace ECS
\ No newline at end of file
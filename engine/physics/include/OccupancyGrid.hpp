@@ -0,0 +1,135 @@
+#pragma once
+
+#include "../../ecs/include/Entity.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * OccupancyGrid - Cell -> entity index for unit collision checks
+ *
+ * Parallel to a TileMap: one entry per cell holding the unit standing on it
+ * and the unit that has reserved it as the target of an in-flight move.
+ * A cell is free for an entity when nobody else occupies or reserves it,
+ * so "can I step there?" is a single array read instead of a scan of all
+ * GridPosition components.
+ *
+ * MovementSystem keeps the grid current: it reserves the target when a
+ * move starts, releases it if the move is stopped or retargeted, and moves
+ * the occupant at completion. Units must be placed once when spawned
+ * (place() or MovementSystem::rebuildOccupancy) and removed when destroyed.
+ *
+ * Coordinates outside the grid are never free; writes to them fail.
+ *
+ * Each REGION_SIZE x REGION_SIZE block of cells has a version counter that
+ * is bumped whenever an occupant or reservation in it changes. Caches of
+ * occupancy-dependent results (movement ranges) store getAreaVersion() for
+ * the area they read and recompute only when it moves.
+ *
+ * Usage:
+ *   OccupancyGrid occupancy(map.getWidth(), map.getHeight());
+ *   movementSystem.setOccupancyGrid(&occupancy);
+ *   movementSystem.rebuildOccupancy(entityManager);
+ *   EntityID blocker = occupancy.getOccupant(4, 7);
+ */
+class OccupancyGrid {
+public:
+    static constexpr int REGION_SIZE = 8;
+
+    /**
+     * Constructor
+     * @param width Cells per row
+     * @param height Number of rows
+     */
+    OccupancyGrid(int width = 0, int height = 0);
+    ~OccupancyGrid() = default;
+
+    // Non-copyable but movable
+    OccupancyGrid(const OccupancyGrid&) = delete;
+    OccupancyGrid& operator=(const OccupancyGrid&) = delete;
+    OccupancyGrid(OccupancyGrid&&) = default;
+    OccupancyGrid& operator=(OccupancyGrid&&) = default;
+
+    int getWidth() const;
+    int getHeight() const;
+    bool inBounds(int x, int y) const;
+
+    /**
+     * Get the entity standing on a cell (INVALID_ENTITY if none or out of bounds)
+     */
+    EntityID getOccupant(int x, int y) const;
+
+    /**
+     * Get the entity moving into a cell (INVALID_ENTITY if none or out of bounds)
+     */
+    EntityID getReservation(int x, int y) const;
+
+    /**
+     * Check if an entity may occupy or reserve a cell
+     * @param self Entity asking; its own occupancy and reservation do not block
+     */
+    bool isFree(int x, int y, EntityID self = INVALID_ENTITY) const;
+
+    /**
+     * Put an entity on a cell
+     * @return false if out of bounds or occupied by another entity
+     */
+    bool place(EntityID entityId, int x, int y);
+
+    /**
+     * Take an entity off a cell (no-op unless it is the occupant)
+     */
+    void remove(EntityID entityId, int x, int y);
+
+    /**
+     * Reserve a cell as the target of an in-flight move
+     * @return false if the cell is not free for this entity
+     */
+    bool reserve(EntityID entityId, int x, int y);
+
+    /**
+     * Drop a reservation (no-op unless held by this entity)
+     */
+    void release(EntityID entityId, int x, int y);
+
+    /**
+     * Complete a move: vacate the source and occupy the target
+     * The target's reservation is released.
+     * @return false if the target is out of bounds or occupied by another
+     *         entity; the grid is then left unchanged
+     */
+    bool move(EntityID entityId, int fromX, int fromY, int toX, int toY);
+
+    /**
+     * Get number of occupied cells
+     */
+    size_t getOccupiedCount() const;
+
+    /**
+     * Remove all occupants and reservations
+     */
+    void clear();
+
+    /**
+     * Sum of the versions of every region overlapping an inclusive rectangle
+     * Versions only grow, so the sum changes whenever any cell in those
+     * regions changes.
+     */
+    uint64_t getAreaVersion(int minX, int minY, int maxX, int maxY) const;
+
+private:
+    size_t index(int x, int y) const;
+    void touch(int x, int y);  // Bump the version of the region holding a cell
+
+    int width;
+    int height;
+    std::vector<EntityID> occupants;
+    std::vector<EntityID> reservations;
+    size_t occupiedCount = 0;
+    int regionsX = 0;
+    std::vector<uint32_t> regionVersions;
+};
+
+} // namespace ECS
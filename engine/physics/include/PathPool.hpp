@@ -0,0 +1,93 @@
+#pragma once
+
+#include "../../ecs/include/Entity.h"
+#include "TileMap.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * PathPool - Shared storage for the multi-step paths units are following
+ *
+ * Every path is one contiguous block of TileCoord steps in a single array,
+ * so a unit's path is just an offset range (see GridMovement::pathNext /
+ * pathEnd) and following it touches no per-unit heap memory. Each owner
+ * holds at most one block; allocating again replaces it.
+ *
+ * Freed blocks go to a free list kept sorted by offset and merged with
+ * their neighbours; allocation takes the first free block that fits and
+ * otherwise appends. A free block at the end of the array is trimmed off.
+ * Once the array has grown to the peak number of steps in flight, starting
+ * and finishing paths no longer allocates.
+ *
+ * Usage:
+ *   uint32_t first = pool.allocate(unit, steps.data(), steps.size());
+ *   TileCoord next = pool.get(first);
+ *   pool.release(unit);
+ */
+class PathPool {
+public:
+    PathPool() = default;
+    ~PathPool() = default;
+
+    // Non-copyable but movable
+    PathPool(const PathPool&) = delete;
+    PathPool& operator=(const PathPool&) = delete;
+    PathPool(PathPool&&) = default;
+    PathPool& operator=(PathPool&&) = default;
+
+    /**
+     * Store a path for an owner (its previous block is released first)
+     * @return Offset of the first step; steps occupy [offset, offset + count)
+     */
+    uint32_t allocate(EntityID owner, const TileCoord* steps, size_t count);
+
+    /**
+     * Free an owner's block (no-op if it has none)
+     */
+    void release(EntityID owner);
+
+    /**
+     * Get the step at an offset returned by allocate()
+     */
+    const TileCoord& get(uint32_t offset) const;
+
+    /**
+     * Check whether an owner currently holds a block
+     */
+    bool hasBlock(EntityID owner) const;
+
+    /**
+     * Get number of steps in live blocks
+     */
+    size_t getUsedCount() const;
+
+    /**
+     * Get size of the step array (live blocks plus free gaps)
+     */
+    size_t getSize() const;
+
+    /**
+     * Get number of free gaps inside the array
+     */
+    size_t getFreeBlockCount() const;
+
+    void clear();
+
+private:
+    struct Block {
+        uint32_t offset = 0;
+        uint32_t length = 0;  // 0 = no block
+    };
+
+    void freeBlock(Block block);
+
+    std::vector<TileCoord> steps;
+    std::vector<Block> ownerBlocks;  // Sparse: EntityID -> owned block
+    std::vector<Block> freeBlocks;   // Sorted by offset, never adjacent
+    size_t usedCount = 0;
+};
+
+} // namespace ECS
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ECS {
+
+/**
+ * TileFlag - Per-tile property, one bit plane each
+ *
+ * Traversable:  tile has walkable ground
+ * Blocked:      obstacle on the tile (walls, closed doors)
+ * Hazard:       walkable but harmful (fire, spikes)
+ * Interactable: tile has something to use (lever, chest)
+ */
+enum class TileFlag : uint8_t {
+    Traversable = 0,
+    Blocked,
+    Hazard,
+    Interactable,
+    Count
+};
+
+/**
+ * TileCoord - Grid cell coordinate
+ */
+struct TileCoord {
+    int x = 0;
+    int y = 0;
+
+    bool operator==(const TileCoord& other) const { return x == other.x && y == other.y; }
+    bool operator!=(const TileCoord& other) const { return !(*this == other); }
+};
+
+/**
+ * TileChangedPayload - Event payload announcing edited tiles
+ *
+ * Pushed by whatever edits the map (doors, destruction, building) so that
+ * cached navigation data can be invalidated. Bounds are inclusive.
+ */
+struct TileChangedPayload {
+    int minX = 0;
+    int minY = 0;
+    int maxX = 0;
+    int maxY = 0;
+
+    bool operator==(const TileChangedPayload& other) const {
+        return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+    }
+    bool operator!=(const TileChangedPayload& other) const { return !(*this == other); }
+};
+
+/**
+ * TileMap - Level grid storing tile properties as packed bit planes
+ *
+ * Each TileFlag is a separate plane holding one bit per tile. A row of a
+ * plane is padded to a whole number of 64-byte cache lines and every row
+ * starts on a cache-line boundary, so a row scan never straddles a line it
+ * does not need. Padding bits past the map width are always zero.
+ *
+ * Single-tile queries are O(1) (one shift and mask). Area operations work
+ * on 64 tiles per instruction: rectangles and radius queries build a bit
+ * mask per row span and combine it with the plane words, counting with
+ * popcount and enumerating set bits with count-trailing-zeros.
+ *
+ * Coordinates outside the map read as "no flags" and writes to them are
+ * ignored, so out-of-bounds tiles are never walkable.
+ *
+ * Usage:
+ *   TileMap map(64, 64);                                   // all traversable
+ *   map.fillRect(10, 0, 10, 63, TileFlag::Blocked);        // wall column
+ *   map.set(5, 5, TileFlag::Hazard);
+ *   bool ok = map.isWalkable(10, 3);                       // false
+ *   size_t burning = map.countInRadius(5, 5, 3, TileFlag::Hazard);
+ */
+class TileMap {
+public:
+    static constexpr size_t WORD_BITS = 64;
+    static constexpr size_t CACHE_LINE_WORDS = 64 / sizeof(uint64_t);
+
+    /**
+     * Constructor
+     * @param width Tiles per row
+     * @param height Number of rows
+     * @param traversable Initial value of the Traversable plane
+     */
+    TileMap(int width = 0, int height = 0, bool traversable = true);
+    ~TileMap() = default;
+
+    // Non-copyable but movable
+    TileMap(const TileMap&) = delete;
+    TileMap& operator=(const TileMap&) = delete;
+    TileMap(TileMap&&) = default;
+    TileMap& operator=(TileMap&&) = default;
+
+    int getWidth() const;
+    int getHeight() const;
+
+    /**
+     * Get padded row length in 64-bit words (a multiple of CACHE_LINE_WORDS)
+     */
+    size_t getWordsPerRow() const;
+
+    bool inBounds(int x, int y) const;
+
+    /**
+     * Check one property of a tile (false outside the map)
+     */
+    bool has(int x, int y, TileFlag flag) const;
+
+    /**
+     * Set or clear one property of a tile (ignored outside the map)
+     */
+    void set(int x, int y, TileFlag flag, bool value = true);
+
+    /**
+     * Get all properties of a tile as a mask (bit i = TileFlag i)
+     */
+    uint8_t getFlags(int x, int y) const;
+
+    /**
+     * Replace all properties of a tile from a mask (bit i = TileFlag i)
+     */
+    void setFlags(int x, int y, uint8_t flags);
+
+    /**
+     * Check if a unit may stand on a tile (Traversable and not Blocked)
+     */
+    bool isWalkable(int x, int y) const;
+
+    /**
+     * Set or clear a property on every tile
+     */
+    void fill(TileFlag flag, bool value);
+
+    /**
+     * Set or clear a property over an inclusive rectangle (clipped to the map)
+     */
+    void fillRect(int minX, int minY, int maxX, int maxY, TileFlag flag, bool value = true);
+
+    /**
+     * Count tiles with a property in an inclusive rectangle (clipped to the map)
+     */
+    size_t countInRect(int minX, int minY, int maxX, int maxY, TileFlag flag) const;
+
+    /**
+     * Count tiles with a property within Euclidean distance radius of a centre
+     */
+    size_t countInRadius(int centerX, int centerY, int radius, TileFlag flag) const;
+
+    /**
+     * Append tiles with a property within Euclidean distance radius of a centre
+     * Tiles are appended in row-major order.
+     */
+    void collectInRadius(int centerX, int centerY, int radius, TileFlag flag, std::vector<TileCoord>& out) const;
+
+    /**
+     * Get the packed words of one plane row (getWordsPerRow() words, 64-byte aligned)
+     * Bit x % 64 of word x / 64 is tile x.
+     */
+    const uint64_t* getRow(TileFlag flag, int y) const;
+
+private:
+    uint64_t* rowWords(TileFlag flag, int y);
+    const uint64_t* rowWords(TileFlag flag, int y) const;
+
+    /**
+     * Clip a row span [minX, maxX] to the map
+     * @return false if nothing remains
+     */
+    bool clipSpan(int& minX, int& maxX) const;
+
+    /**
+     * Half-width of the disc row at vertical offset dy (largest dx with dx^2 + dy^2 <= r^2)
+     */
+    static int discHalfWidth(int radius, int dy);
+
+    int width;
+    int height;
+    size_t wordsPerRow;
+    std::vector<uint64_t> storage;  // Planes back to back, over-allocated for alignment
+    size_t alignOffset = 0;         // First cache-line-aligned word in storage
+};
+
+} // namespace ECS
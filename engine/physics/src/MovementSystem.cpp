@@ -2,6 +2,7 @@
 #include "../../ecs/include/ComponentArray.hpp"
 #include "../../ecs/systems/include/IInputManager.hpp"
 #include "../../ecs/include/ComponentRegistry.hpp"
+#include <algorithm>
 #include <cmath>
 
 namespace ECS {
@@ -72,6 +73,50 @@ void MovementSystem::update(EntityManager& entityManager, float deltaTime) {
     updatePhysicsMovement(entityManager, deltaTime);
 }
 
+void MovementSystem::update(float deltaTime, EntityManager& entityManager) {
+    update(entityManager, deltaTime);
+}
+
+uint64_t MovementSystem::getRequiredComponents() const {
+    return getComponentBit<Position>();
+}
+
+uint64_t MovementSystem::getComponentReads() const {
+    return getComponentWrites() | getComponentBit<Acceleration>() |
+           getComponentBit<MovementConstraints>() | getComponentBit<GridBounds>();
+}
+
+uint64_t MovementSystem::getComponentWrites() const {
+    return getComponentBit<Position>() | getComponentBit<GridPosition>() |
+           getComponentBit<GridMovement>() | getComponentBit<Velocity>();
+}
+
+SystemPhase MovementSystem::getPhase() const {
+    return SystemPhase::Simulation;
+}
+
+uint64_t MovementSystem::getResourceReads() const {
+    return tileMap ? getResourceBit<TileMap>() : 0;
+}
+
+uint64_t MovementSystem::getResourceWrites() const {
+    // The occupancy grid is shared state; other systems must not see it mid-update
+    uint64_t writes = getResourceBit<PathPool>();
+    if (occupancy) {
+        writes |= getResourceBit<OccupancyGrid>();
+    }
+    return writes;
+}
+
+bool MovementSystem::canRunInParallel() const {
+    // Never creates or destroys entities; shared grids are declared as resources
+    return true;
+}
+
+const char* MovementSystem::getName() const {
+    return "MovementSystem";
+}
+
 void MovementSystem::setControlledEntity(EntityID entityId) {
     controlledEntity = entityId;
 }
@@ -93,12 +138,25 @@ bool MovementSystem::requestGridMovement(EntityID entityId, int targetX, int tar
         return false;
     }
     
-    // Validate movement if requested - for now we'll skip this until validateMovement is fixed
-    if (validateBounds && gridBounds) {
-        auto* bounds = gridBounds->get(entityId);
-        if (bounds && !bounds->isValid(targetX, targetY)) {
-            return false;
+    // Validate movement if requested
+    if (validateBounds && !validateMovement(entityId, targetX, targetY)) {
+        return false;
+    }
+    
+    // Unvalidated moves still need a cell the grid can hold
+    if (occupancy && !occupancy->isFree(targetX, targetY, entityId)) {
+        return false;
+    }
+    
+    // An explicit move replaces any path being followed
+    releasePath(entityId, gridMovement);
+    
+    // Move the reservation to the new target (checked free above)
+    if (occupancy) {
+        if (isMarkedMoving(entityId)) {
+            releaseTarget(entityId);
         }
+        occupancy->reserve(entityId, targetX, targetY);
     }
     
     // Start movement
@@ -106,11 +164,44 @@ bool MovementSystem::requestGridMovement(EntityID entityId, int targetX, int tar
     gridMovement->targetY = targetY;
     gridMovement->progress = 0.0f;
     gridMovement->isMoving = true;
+    markMoving(entityId);
+    
+    return true;
+}
+
+bool MovementSystem::requestGridPath(EntityID entityId, const TileCoord* steps, size_t count, bool validateBounds) {
+    if (count == 0 || !requestGridMovement(entityId, steps[0].x, steps[0].y, validateBounds)) {
+        return false;
+    }
     
+    auto* gridMovement = gridMovements->get(entityId);
+    if (count > 1) {
+        gridMovement->pathNext = pathPool.allocate(entityId, steps + 1, count - 1);
+        gridMovement->pathEnd = gridMovement->pathNext + static_cast<uint32_t>(count - 1);
+    }
+    gridMovement->validatePath = validateBounds;
     return true;
 }
 
-bool MovementSystem::queueGridMovement(EntityID entityId, int targetX, int targetY, bool validateBounds) {
+bool MovementSystem::requestGridPath(EntityID entityId, const std::vector<TileCoord>& steps, bool validateBounds) {
+    return requestGridPath(entityId, steps.data(), steps.size(), validateBounds);
+}
+
+void MovementSystem::clearGridPath(EntityID entityId) {
+    releasePath(entityId, gridMovements ? gridMovements->get(entityId) : nullptr);
+}
+
+size_t MovementSystem::getRemainingPathSteps(EntityID entityId) const {
+    auto* gridMovement = gridMovements ? gridMovements->get(entityId) : nullptr;
+    return gridMovement ? gridMovement->getRemainingPathSteps() : 0;
+}
+
+const PathPool& MovementSystem::getPathPool() const {
+    return pathPool;
+}
+
+bool MovementSystem::queueGridMovement(EntityID entityId, int targetX, int targetY, bool validateBounds,
+                                       int initiative) {
     if (!gridMovements) {
         return false;
     }
@@ -122,49 +213,165 @@ bool MovementSystem::queueGridMovement(EntityID entityId, int targetX, int targe
     }
     
     // Validate movement if requested
-    if (validateBounds && gridBounds) {
-        auto* bounds = gridBounds->get(entityId);
-        if (bounds && !bounds->isValid(targetX, targetY)) {
-            return false;
-        }
+    if (validateBounds && !validateMovement(entityId, targetX, targetY)) {
+        return false;
     }
     
-    // Queue movement
+    // Queue movement; re-queueing updates the target and initiative in place
     gridMovement->queueMove(targetX, targetY);
     
+    if (entityId >= pendingSlots.size()) {
+        pendingSlots.resize(static_cast<size_t>(entityId) + 1, NO_SLOT);
+    }
+    if (pendingSlots[entityId] == NO_SLOT) {
+        pendingSlots[entityId] = static_cast<uint32_t>(pendingMoves.size());
+        pendingMoves.push_back(PendingMove{entityId, initiative, nextPendingSequence++});
+    } else {
+        pendingMoves[pendingSlots[entityId]].initiative = initiative;
+    }
+    
     return true;
 }
 
 void MovementSystem::executeQueuedMovements(EntityManager& entityManager) {
-    if (!gridMovements) {
+    if (!gridMovements || pendingMoves.empty()) {
         return;
     }
 
-    // Get all entities with GridMovement component
-    auto entities = entityManager.getAllEntitiesForIteration();
+    sortPendingMoves(pendingMoves, queuedMoveOrder);
+
+    // Start moves in order; entities still mid-move stay pending (compacted in place)
     uint64_t gridMovementBit = getComponentBit<GridMovement>();
+    size_t kept = 0;
+    for (size_t i = 0; i < pendingMoves.size(); ++i) {
+        const PendingMove& pending = pendingMoves[i];
+        const Entity* entity = entityManager.isAlive(pending.entityId) ? entityManager.getEntityByID(pending.entityId) : nullptr;
+        auto* gridMovement = (entity && (entity->componentMask & gridMovementBit)) ? gridMovements->get(pending.entityId) : nullptr;
+
+        if (gridMovement && gridMovement->hasPendingMove && gridMovement->isMoving) {
+            pendingSlots[pending.entityId] = static_cast<uint32_t>(kept);
+            pendingMoves[kept++] = pending;
+            continue;
+        }
 
-    for (const Entity* entity : entities) {
-        if (!entityManager.isValid(*entity) || !(entity->componentMask & gridMovementBit)) {
+        pendingSlots[pending.entityId] = NO_SLOT;
+        if (!gridMovement || !gridMovement->hasPendingMove) {
             continue;
         }
 
-        auto* gridMovement = gridMovements->get(entity->id);
-        if (gridMovement && gridMovement->hasPendingMove && !gridMovement->isMoving) {
-            gridMovement->startQueuedMove();
+        // Earlier moves in the order win contested cells, validated or not
+        if (occupancy && !occupancy->reserve(pending.entityId, gridMovement->pendingX, gridMovement->pendingY)) {
+            gridMovement->hasPendingMove = false;
+            continue;
+        }
+
+        gridMovement->startQueuedMove();
+        markMoving(pending.entityId);
+    }
+    pendingMoves.resize(kept);
+}
+
+void MovementSystem::setQueuedMoveOrder(QueuedMoveOrder order) {
+    queuedMoveOrder = order;
+}
+
+QueuedMoveOrder MovementSystem::getQueuedMoveOrder() const {
+    return queuedMoveOrder;
+}
+
+size_t MovementSystem::getPendingMoveCount() const {
+    return pendingMoves.size();
+}
+
+std::vector<EntityID> MovementSystem::getPendingMoveOrder() const {
+    sortedPendingMoves.assign(pendingMoves.begin(), pendingMoves.end());
+    sortPendingMoves(sortedPendingMoves, queuedMoveOrder);
+    std::vector<EntityID> order;
+    order.reserve(sortedPendingMoves.size());
+    for (const auto& pending : sortedPendingMoves) {
+        order.push_back(pending.entityId);
+    }
+    return order;
+}
+
+void MovementSystem::getQueuedMoves(std::vector<QueuedMove>& moves) const {
+    moves.clear();
+    if (!gridMovements || !gridPositions) {
+        return;
+    }
+    sortedPendingMoves.assign(pendingMoves.begin(), pendingMoves.end());
+    sortPendingMoves(sortedPendingMoves, queuedMoveOrder);
+    for (const auto& pending : sortedPendingMoves) {
+        auto* gridMovement = gridMovements->get(pending.entityId);
+        auto* gridPosition = gridPositions->get(pending.entityId);
+        if (!gridMovement || !gridPosition || !gridMovement->hasPendingMove || gridMovement->isMoving) {
+            continue;
         }
+        moves.push_back(QueuedMove{pending.entityId, {gridPosition->x, gridPosition->y},
+                                   {gridMovement->pendingX, gridMovement->pendingY}});
+    }
+}
+
+void MovementSystem::cancelQueuedMovement(EntityID entityId) {
+    if (entityId >= pendingSlots.size() || pendingSlots[entityId] == NO_SLOT) {
+        return;
+    }
+    auto* gridMovement = gridMovements ? gridMovements->get(entityId) : nullptr;
+    if (gridMovement) {
+        gridMovement->hasPendingMove = false;
+    }
+
+    // Swap-remove; the list is sorted by policy when executed
+    uint32_t slot = pendingSlots[entityId];
+    pendingMoves[slot] = pendingMoves.back();
+    pendingSlots[pendingMoves[slot].entityId] = slot;
+    pendingMoves.pop_back();
+    pendingSlots[entityId] = NO_SLOT;
+}
+
+void MovementSystem::sortPendingMoves(std::vector<PendingMove>& moves, QueuedMoveOrder order) {
+    switch (order) {
+        case QueuedMoveOrder::Queued:
+            std::sort(moves.begin(), moves.end(), [](const PendingMove& a, const PendingMove& b) {
+                return a.sequence < b.sequence;
+            });
+            break;
+        case QueuedMoveOrder::ByEntityID:
+            std::sort(moves.begin(), moves.end(), [](const PendingMove& a, const PendingMove& b) {
+                return a.entityId < b.entityId;
+            });
+            break;
+        case QueuedMoveOrder::ByInitiative:
+            std::sort(moves.begin(), moves.end(), [](const PendingMove& a, const PendingMove& b) {
+                if (a.initiative != b.initiative) {
+                    return a.initiative > b.initiative;
+                }
+                return a.entityId < b.entityId;
+            });
+            break;
+        default:
+            break;
     }
 }
 
 bool MovementSystem::isEntityMoving(EntityID entityId, EntityManager& entityManager) const {
     (void)entityManager; // Suppress unused parameter warning
-    if (!gridMovements) {
+    if (!gridMovements || !isMarkedMoving(entityId)) {
         return false;
     }
+    // Members whose flag was cleared externally are pruned on the next update
     auto* gridMovement = gridMovements->get(entityId);
     return gridMovement && gridMovement->isMoving;
 }
 
+size_t MovementSystem::getMovingCount() const {
+    return movingEntities.size();
+}
+
+const std::vector<EntityID>& MovementSystem::getMovingEntities() const {
+    return movingEntities;
+}
+
 void MovementSystem::stopMovement(EntityID entityId, EntityManager& entityManager, bool snapToGrid) {
     (void)entityManager; // Suppress unused parameter warning
     
@@ -177,8 +384,13 @@ void MovementSystem::stopMovement(EntityID entityId, EntityManager& entityManage
         return;
     }
     
+    if (isMarkedMoving(entityId)) {
+        releaseTarget(entityId);
+    }
+    releasePath(entityId, gridMovement);
     gridMovement->isMoving = false;
     gridMovement->progress = 0.0f;
+    unmarkMoving(entityId);
     
     if (snapToGrid && positions && gridPositions) {
         auto* position = positions->get(entityId);
@@ -210,6 +422,50 @@ float MovementSystem::getGridCellSize() const {
     return gridCellSize;
 }
 
+void MovementSystem::setTileMap(const TileMap* map) {
+    tileMap = map;
+}
+
+const TileMap* MovementSystem::getTileMap() const {
+    return tileMap;
+}
+
+void MovementSystem::setOccupancyGrid(OccupancyGrid* grid) {
+    occupancy = grid;
+}
+
+OccupancyGrid* MovementSystem::getOccupancyGrid() const {
+    return occupancy;
+}
+
+void MovementSystem::rebuildOccupancy(EntityManager& entityManager) {
+    if (!occupancy || !gridPositions) {
+        return;
+    }
+    occupancy->clear();
+
+    uint64_t gridPositionBit = getComponentBit<GridPosition>();
+    for (const Entity* entity : entityManager.getAllEntitiesForIteration()) {
+        if (!entityManager.isValid(*entity) || !(entity->componentMask & gridPositionBit)) {
+            continue;
+        }
+        auto* gridPosition = gridPositions->get(entity->id);
+        if (gridPosition) {
+            occupancy->place(entity->id, gridPosition->x, gridPosition->y);
+        }
+    }
+
+    if (!gridMovements) {
+        return;
+    }
+    for (EntityID entityId : movingEntities) {
+        auto* gridMovement = gridMovements->get(entityId);
+        if (gridMovement) {
+            occupancy->reserve(entityId, gridMovement->targetX, gridMovement->targetY);
+        }
+    }
+}
+
 void MovementSystem::processInputMovement(EntityManager& entityManager) {
     (void)entityManager; // Suppress unused parameter warning
     if (!inputManager) {
@@ -282,24 +538,27 @@ void MovementSystem::updateGridMovement(EntityManager& entityManager, float delt
         return;
     }
 
-    // Get all entities with required components
-    auto entities = entityManager.getAllEntitiesForIteration();
+    // Visit only the active set; removal swaps the last entry into slot i
     uint64_t requiredMask = getComponentBit<GridPosition>() | getComponentBit<GridMovement>() | getComponentBit<Position>();
 
-    for (const Entity* entity : entities) {
-        if (!entityManager.isValid(*entity) || (entity->componentMask & requiredMask) != requiredMask) {
+    for (size_t i = 0; i < movingEntities.size();) {
+        EntityID entityId = movingEntities[i];
+        const Entity* entity = entityManager.isAlive(entityId) ? entityManager.getEntityByID(entityId) : nullptr;
+        if (!entity || (entity->componentMask & requiredMask) != requiredMask) {
+            releaseTarget(entityId);
+            releasePath(entityId, entity ? gridMovements->get(entityId) : nullptr);
+            unmarkMoving(entityId);
             continue;
         }
 
-        auto* gridPosition = gridPositions->get(entity->id);
-        auto* gridMovement = gridMovements->get(entity->id);
-        auto* position = positions->get(entity->id);
-
-        if (!gridPosition || !gridMovement || !position) {
-            continue;
-        }
+        auto* gridPosition = gridPositions->get(entityId);
+        auto* gridMovement = gridMovements->get(entityId);
+        auto* position = positions->get(entityId);
 
-        if (!gridMovement->isMoving) {
+        if (!gridPosition || !gridMovement || !position || !gridMovement->isMoving) {
+            releaseTarget(entityId);
+            releasePath(entityId, gridMovement);
+            unmarkMoving(entityId);
             continue;
         }
 
@@ -311,6 +570,20 @@ void MovementSystem::updateGridMovement(EntityManager& entityManager, float delt
 
         // Check if movement is complete
         if (gridMovement->isComplete()) {
+            // Target taken by a unit placed outside the system: stay on the start cell
+            if (occupancy && !occupancy->move(entityId, gridPosition->x, gridPosition->y,
+                                              gridMovement->targetX, gridMovement->targetY)) {
+                releaseTarget(entityId);
+                releasePath(entityId, gridMovement);
+                gridMovement->reset();
+                unmarkMoving(entityId);
+                float worldX, worldY;
+                gridToWorld(gridPosition->x, gridPosition->y, worldX, worldY);
+                position->x = worldX;
+                position->y = worldY;
+                continue;
+            }
+
             // Complete movement - snap to target
             gridPosition->x = gridMovement->targetX;
             gridPosition->y = gridMovement->targetY;
@@ -320,21 +593,46 @@ void MovementSystem::updateGridMovement(EntityManager& entityManager, float delt
             position->x = worldX;
             position->y = worldY;
 
-            // Reset movement state (queued movements must be started manually via executeQueuedMovements)
+            // Path followers stay in the active set and start their next step
+            // below, once every cell vacated this update is free; else stop
+            // (queued movements must be started manually via executeQueuedMovements)
+            if (gridMovement->hasPath()) {
+                pathAdvances.push_back(entityId);
+                ++i;
+                continue;
+            }
             gridMovement->reset();
+            unmarkMoving(entityId);
+            continue;
         }
-        else {
-            // Interpolate position between start and target
-            float startWorldX, startWorldY;
-            float targetWorldX, targetWorldY;
-            
-            gridToWorld(gridPosition->x, gridPosition->y, startWorldX, startWorldY);
-            gridToWorld(gridMovement->targetX, gridMovement->targetY, targetWorldX, targetWorldY);
-            
-            interpolatePosition(startWorldX, startWorldY, targetWorldX, targetWorldY, 
-                              gridMovement->progress, position->x, position->y);
+
+        interpolateGridMovement(*gridPosition, *gridMovement, *position);
+        ++i;
+    }
+
+    for (EntityID entityId : pathAdvances) {
+        auto* gridMovement = gridMovements->get(entityId);
+        if (!startNextPathStep(entityId, *gridMovement)) {
+            gridMovement->reset();
+            unmarkMoving(entityId);
+            continue;
         }
+        interpolateGridMovement(*gridPositions->get(entityId), *gridMovement, *positions->get(entityId));
     }
+    pathAdvances.clear();
+}
+
+void MovementSystem::interpolateGridMovement(const GridPosition& gridPosition, const GridMovement& gridMovement,
+                                             Position& position) const {
+    // Interpolate position between start and target
+    float startWorldX, startWorldY;
+    float targetWorldX, targetWorldY;
+    
+    gridToWorld(gridPosition.x, gridPosition.y, startWorldX, startWorldY);
+    gridToWorld(gridMovement.targetX, gridMovement.targetY, targetWorldX, targetWorldY);
+    
+    interpolatePosition(startWorldX, startWorldY, targetWorldX, targetWorldY, 
+                      gridMovement.progress, position.x, position.y);
 }
 
 void MovementSystem::updatePhysicsMovement(EntityManager& entityManager, float deltaTime) {
@@ -378,6 +676,73 @@ void MovementSystem::updatePhysicsMovement(EntityManager& entityManager, float d
     }
 }
 
+void MovementSystem::markMoving(EntityID entityId) {
+    if (entityId >= movingSlots.size()) {
+        movingSlots.resize(static_cast<size_t>(entityId) + 1, NO_SLOT);
+    }
+    if (movingSlots[entityId] == NO_SLOT) {
+        movingSlots[entityId] = static_cast<uint32_t>(movingEntities.size());
+        movingEntities.push_back(entityId);
+    }
+}
+
+void MovementSystem::unmarkMoving(EntityID entityId) {
+    if (!isMarkedMoving(entityId)) {
+        return;
+    }
+    uint32_t slot = movingSlots[entityId];
+    EntityID last = movingEntities.back();
+    movingEntities[slot] = last;
+    movingSlots[last] = slot;
+    movingEntities.pop_back();
+    movingSlots[entityId] = NO_SLOT;
+}
+
+bool MovementSystem::isMarkedMoving(EntityID entityId) const {
+    return entityId < movingSlots.size() && movingSlots[entityId] != NO_SLOT;
+}
+
+void MovementSystem::releaseTarget(EntityID entityId) {
+    if (!occupancy || !gridMovements) {
+        return;
+    }
+    auto* gridMovement = gridMovements->get(entityId);
+    if (gridMovement) {
+        occupancy->release(entityId, gridMovement->targetX, gridMovement->targetY);
+    }
+}
+
+void MovementSystem::releasePath(EntityID entityId, GridMovement* gridMovement) {
+    pathPool.release(entityId);
+    if (gridMovement) {
+        gridMovement->pathNext = 0;
+        gridMovement->pathEnd = 0;
+    }
+}
+
+bool MovementSystem::startNextPathStep(EntityID entityId, GridMovement& gridMovement) {
+    if (!gridMovement.hasPath()) {
+        return false;
+    }
+    TileCoord step = pathPool.get(gridMovement.pathNext++);
+    if (!gridMovement.hasPath()) {
+        releasePath(entityId, &gridMovement);
+    }
+    
+    // Unvalidated paths still stop at a cell the grid cannot hold
+    if ((gridMovement.validatePath && !validateMovement(entityId, step.x, step.y)) ||
+        (occupancy && !occupancy->reserve(entityId, step.x, step.y))) {
+        releasePath(entityId, &gridMovement);
+        return false;
+    }
+    
+    // Carry leftover progress into the next step so speed stays constant
+    gridMovement.targetX = step.x;
+    gridMovement.targetY = step.y;
+    gridMovement.progress = std::min(std::max(gridMovement.progress - 1.0f, 0.0f), 1.0f);
+    return true;
+}
+
 void MovementSystem::gridToWorld(int gridX, int gridY, float& worldX, float& worldY) const {
     worldX = static_cast<float>(gridX) * gridCellSize;
     worldY = static_cast<float>(gridY) * gridCellSize;
@@ -388,9 +753,7 @@ void MovementSystem::worldToGrid(float worldX, float worldY, int& gridX, int& gr
     gridY = static_cast<int>(std::floor(worldY / gridCellSize + 0.5f));
 }
 
-bool MovementSystem::validateMovement(EntityID entityId, int targetX, int targetY, EntityManager& entityManager) const {
-    (void)entityManager; // Suppress unused parameter warning
-    
+bool MovementSystem::validateMovement(EntityID entityId, int targetX, int targetY) const {
     // Check bounds if entity has GridBounds component
     if (gridBounds) {
         auto* bounds = gridBounds->get(entityId);
@@ -399,7 +762,15 @@ bool MovementSystem::validateMovement(EntityID entityId, int targetX, int target
         }
     }
     
-    // TODO: Add obstacle collision checking here when obstacle system is implemented
+    // Check level obstacles if a tile map is set
+    if (tileMap && !tileMap->isWalkable(targetX, targetY)) {
+        return false;
+    }
+    
+    // Check other units standing on or moving into the cell
+    if (occupancy && !occupancy->isFree(targetX, targetY, entityId)) {
+        return false;
+    }
     
     return true;
 }
@@ -0,0 +1,146 @@
+#include "../include/OccupancyGrid.hpp"
+#include <algorithm>
+
+namespace ECS {
+
+OccupancyGrid::OccupancyGrid(int width, int height)
+    : width(std::max(width, 0))
+    , height(std::max(height, 0))
+    , occupants(static_cast<size_t>(this->width) * static_cast<size_t>(this->height), INVALID_ENTITY)
+    , reservations(occupants.size(), INVALID_ENTITY)
+    , regionsX((this->width + REGION_SIZE - 1) / REGION_SIZE)
+    , regionVersions(static_cast<size_t>(regionsX) * static_cast<size_t>((this->height + REGION_SIZE - 1) / REGION_SIZE), 0) {
+}
+
+int OccupancyGrid::getWidth() const {
+    return width;
+}
+
+int OccupancyGrid::getHeight() const {
+    return height;
+}
+
+bool OccupancyGrid::inBounds(int x, int y) const {
+    return x >= 0 && y >= 0 && x < width && y < height;
+}
+
+EntityID OccupancyGrid::getOccupant(int x, int y) const {
+    return inBounds(x, y) ? occupants[index(x, y)] : INVALID_ENTITY;
+}
+
+EntityID OccupancyGrid::getReservation(int x, int y) const {
+    return inBounds(x, y) ? reservations[index(x, y)] : INVALID_ENTITY;
+}
+
+bool OccupancyGrid::isFree(int x, int y, EntityID self) const {
+    if (!inBounds(x, y)) {
+        return false;
+    }
+    size_t cell = index(x, y);
+    EntityID occupant = occupants[cell];
+    EntityID reservation = reservations[cell];
+    return (occupant == INVALID_ENTITY || occupant == self) &&
+           (reservation == INVALID_ENTITY || reservation == self);
+}
+
+bool OccupancyGrid::place(EntityID entityId, int x, int y) {
+    if (!inBounds(x, y)) {
+        return false;
+    }
+    EntityID& occupant = occupants[index(x, y)];
+    if (occupant != INVALID_ENTITY && occupant != entityId) {
+        return false;
+    }
+    if (occupant == INVALID_ENTITY) {
+        occupant = entityId;
+        occupiedCount++;
+        touch(x, y);
+    }
+    return true;
+}
+
+void OccupancyGrid::remove(EntityID entityId, int x, int y) {
+    if (!inBounds(x, y)) {
+        return;
+    }
+    EntityID& occupant = occupants[index(x, y)];
+    if (occupant == entityId && entityId != INVALID_ENTITY) {
+        occupant = INVALID_ENTITY;
+        occupiedCount--;
+        touch(x, y);
+    }
+}
+
+bool OccupancyGrid::reserve(EntityID entityId, int x, int y) {
+    if (!isFree(x, y, entityId)) {
+        return false;
+    }
+    EntityID& reservation = reservations[index(x, y)];
+    if (reservation != entityId) {
+        reservation = entityId;
+        touch(x, y);
+    }
+    return true;
+}
+
+void OccupancyGrid::release(EntityID entityId, int x, int y) {
+    if (!inBounds(x, y)) {
+        return;
+    }
+    EntityID& reservation = reservations[index(x, y)];
+    if (reservation == entityId && entityId != INVALID_ENTITY) {
+        reservation = INVALID_ENTITY;
+        touch(x, y);
+    }
+}
+
+bool OccupancyGrid::move(EntityID entityId, int fromX, int fromY, int toX, int toY) {
+    // Check first so a failed move never leaves the entity off the grid
+    if (!inBounds(toX, toY)) {
+        return false;
+    }
+    EntityID occupant = occupants[index(toX, toY)];
+    if (occupant != INVALID_ENTITY && occupant != entityId) {
+        return false;
+    }
+    release(entityId, toX, toY);
+    remove(entityId, fromX, fromY);
+    return place(entityId, toX, toY);
+}
+
+size_t OccupancyGrid::getOccupiedCount() const {
+    return occupiedCount;
+}
+
+void OccupancyGrid::clear() {
+    std::fill(occupants.begin(), occupants.end(), INVALID_ENTITY);
+    std::fill(reservations.begin(), reservations.end(), INVALID_ENTITY);
+    occupiedCount = 0;
+    for (uint32_t& version : regionVersions) {
+        version++;
+    }
+}
+
+uint64_t OccupancyGrid::getAreaVersion(int minX, int minY, int maxX, int maxY) const {
+    minX = std::max(minX, 0);
+    minY = std::max(minY, 0);
+    maxX = std::min(maxX, width - 1);
+    maxY = std::min(maxY, height - 1);
+    uint64_t sum = 0;
+    for (int ry = minY / REGION_SIZE; minX <= maxX && ry <= maxY / REGION_SIZE; ++ry) {
+        for (int rx = minX / REGION_SIZE; rx <= maxX / REGION_SIZE; ++rx) {
+            sum += regionVersions[static_cast<size_t>(ry * regionsX + rx)];
+        }
+    }
+    return sum;
+}
+
+size_t OccupancyGrid::index(int x, int y) const {
+    return static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x);
+}
+
+void OccupancyGrid::touch(int x, int y) {
+    regionVersions[static_cast<size_t>((y / REGION_SIZE) * regionsX + x / REGION_SIZE)]++;
+}
+
+} // namespace ECS
@@ -0,0 +1,102 @@
+#include "../include/PathPool.hpp"
+#include <algorithm>
+
+namespace ECS {
+
+uint32_t PathPool::allocate(EntityID owner, const TileCoord* source, size_t count) {
+    release(owner);
+    if (count == 0) {
+        return static_cast<uint32_t>(steps.size());
+    }
+
+    // First fit in the free list, else append
+    Block block;
+    block.length = static_cast<uint32_t>(count);
+    auto fit = std::find_if(freeBlocks.begin(), freeBlocks.end(), [&](const Block& free) {
+        return free.length >= block.length;
+    });
+    if (fit != freeBlocks.end()) {
+        block.offset = fit->offset;
+        fit->offset += block.length;
+        fit->length -= block.length;
+        if (fit->length == 0) {
+            freeBlocks.erase(fit);
+        }
+    } else {
+        block.offset = static_cast<uint32_t>(steps.size());
+        steps.resize(steps.size() + count);
+    }
+    std::copy(source, source + count, steps.begin() + block.offset);
+
+    if (owner >= ownerBlocks.size()) {
+        ownerBlocks.resize(static_cast<size_t>(owner) + 1);
+    }
+    ownerBlocks[owner] = block;
+    usedCount += count;
+    return block.offset;
+}
+
+void PathPool::release(EntityID owner) {
+    if (!hasBlock(owner)) {
+        return;
+    }
+    Block block = ownerBlocks[owner];
+    ownerBlocks[owner] = Block{};
+    usedCount -= block.length;
+    freeBlock(block);
+}
+
+const TileCoord& PathPool::get(uint32_t offset) const {
+    return steps[offset];
+}
+
+bool PathPool::hasBlock(EntityID owner) const {
+    return owner < ownerBlocks.size() && ownerBlocks[owner].length != 0;
+}
+
+size_t PathPool::getUsedCount() const {
+    return usedCount;
+}
+
+size_t PathPool::getSize() const {
+    return steps.size();
+}
+
+size_t PathPool::getFreeBlockCount() const {
+    return freeBlocks.size();
+}
+
+void PathPool::clear() {
+    steps.clear();
+    ownerBlocks.clear();
+    freeBlocks.clear();
+    usedCount = 0;
+}
+
+void PathPool::freeBlock(Block block) {
+    // Insert sorted, merging with the neighbours it touches
+    auto next = std::lower_bound(freeBlocks.begin(), freeBlocks.end(), block, [](const Block& a, const Block& b) {
+        return a.offset < b.offset;
+    });
+    if (next != freeBlocks.end() && block.offset + block.length == next->offset) {
+        block.length += next->length;
+        next = freeBlocks.erase(next);
+    }
+    if (next != freeBlocks.begin()) {
+        auto previous = next - 1;
+        if (previous->offset + previous->length == block.offset) {
+            block.offset = previous->offset;
+            block.length += previous->length;
+            next = freeBlocks.erase(previous);
+        }
+    }
+
+    // A gap at the end is trimmed instead of kept (capacity is retained)
+    if (block.offset + block.length == steps.size()) {
+        steps.resize(block.offset);
+        return;
+    }
+    freeBlocks.insert(next, block);
+}
+
+} // namespace ECS
@@ -0,0 +1,218 @@
+#include "../include/TileMap.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace ECS {
+
+namespace {
+
+/**
+ * Mask of the bits of word wordIndex that fall inside tiles [minX, maxX]
+ */
+uint64_t spanMask(size_t wordIndex, int minX, int maxX) {
+    int wordStart = static_cast<int>(wordIndex * TileMap::WORD_BITS);
+    int lo = std::max(minX - wordStart, 0);
+    int hi = std::min(maxX - wordStart, static_cast<int>(TileMap::WORD_BITS) - 1);
+    uint64_t upper = (hi == 63) ? ~0ULL : ((1ULL << (hi + 1)) - 1);
+    uint64_t lower = ~0ULL << lo;
+    return upper & lower;
+}
+
+} // namespace
+
+TileMap::TileMap(int width, int height, bool traversable)
+    : width(std::max(width, 0))
+    , height(std::max(height, 0)) {
+    size_t rowWordsNeeded = (static_cast<size_t>(this->width) + WORD_BITS - 1) / WORD_BITS;
+    wordsPerRow = (rowWordsNeeded + CACHE_LINE_WORDS - 1) / CACHE_LINE_WORDS * CACHE_LINE_WORDS;
+
+    size_t planeWords = wordsPerRow * static_cast<size_t>(this->height);
+    storage.assign(planeWords * static_cast<size_t>(TileFlag::Count) + CACHE_LINE_WORDS, 0);
+
+    uintptr_t address = reinterpret_cast<uintptr_t>(storage.data());
+    uintptr_t misalignment = address % (CACHE_LINE_WORDS * sizeof(uint64_t));
+    alignOffset = misalignment == 0 ? 0 : (CACHE_LINE_WORDS * sizeof(uint64_t) - misalignment) / sizeof(uint64_t);
+
+    if (traversable) {
+        fill(TileFlag::Traversable, true);
+    }
+}
+
+int TileMap::getWidth() const {
+    return width;
+}
+
+int TileMap::getHeight() const {
+    return height;
+}
+
+size_t TileMap::getWordsPerRow() const {
+    return wordsPerRow;
+}
+
+bool TileMap::inBounds(int x, int y) const {
+    return x >= 0 && y >= 0 && x < width && y < height;
+}
+
+bool TileMap::has(int x, int y, TileFlag flag) const {
+    if (!inBounds(x, y)) {
+        return false;
+    }
+    const uint64_t* row = rowWords(flag, y);
+    return (row[x / WORD_BITS] >> (x % WORD_BITS)) & 1ULL;
+}
+
+void TileMap::set(int x, int y, TileFlag flag, bool value) {
+    if (!inBounds(x, y)) {
+        return;
+    }
+    uint64_t* row = rowWords(flag, y);
+    uint64_t bit = 1ULL << (x % WORD_BITS);
+    if (value) {
+        row[x / WORD_BITS] |= bit;
+    } else {
+        row[x / WORD_BITS] &= ~bit;
+    }
+}
+
+uint8_t TileMap::getFlags(int x, int y) const {
+    uint8_t flags = 0;
+    for (uint8_t plane = 0; plane < static_cast<uint8_t>(TileFlag::Count); ++plane) {
+        if (has(x, y, static_cast<TileFlag>(plane))) {
+            flags |= static_cast<uint8_t>(1u << plane);
+        }
+    }
+    return flags;
+}
+
+void TileMap::setFlags(int x, int y, uint8_t flags) {
+    for (uint8_t plane = 0; plane < static_cast<uint8_t>(TileFlag::Count); ++plane) {
+        set(x, y, static_cast<TileFlag>(plane), (flags >> plane) & 1u);
+    }
+}
+
+bool TileMap::isWalkable(int x, int y) const {
+    if (!inBounds(x, y)) {
+        return false;
+    }
+    size_t word = static_cast<size_t>(x) / WORD_BITS;
+    uint64_t bit = 1ULL << (x % WORD_BITS);
+    return (rowWords(TileFlag::Traversable, y)[word] & ~rowWords(TileFlag::Blocked, y)[word] & bit) != 0;
+}
+
+void TileMap::fill(TileFlag flag, bool value) {
+    fillRect(0, 0, width - 1, height - 1, flag, value);
+}
+
+void TileMap::fillRect(int minX, int minY, int maxX, int maxY, TileFlag flag, bool value) {
+    if (!clipSpan(minX, maxX)) {
+        return;
+    }
+    minY = std::max(minY, 0);
+    maxY = std::min(maxY, height - 1);
+
+    size_t firstWord = static_cast<size_t>(minX) / WORD_BITS;
+    size_t lastWord = static_cast<size_t>(maxX) / WORD_BITS;
+    for (int y = minY; y <= maxY; ++y) {
+        uint64_t* row = rowWords(flag, y);
+        for (size_t w = firstWord; w <= lastWord; ++w) {
+            uint64_t mask = spanMask(w, minX, maxX);
+            row[w] = value ? (row[w] | mask) : (row[w] & ~mask);
+        }
+    }
+}
+
+size_t TileMap::countInRect(int minX, int minY, int maxX, int maxY, TileFlag flag) const {
+    if (!clipSpan(minX, maxX)) {
+        return 0;
+    }
+    minY = std::max(minY, 0);
+    maxY = std::min(maxY, height - 1);
+
+    size_t count = 0;
+    size_t firstWord = static_cast<size_t>(minX) / WORD_BITS;
+    size_t lastWord = static_cast<size_t>(maxX) / WORD_BITS;
+    for (int y = minY; y <= maxY; ++y) {
+        const uint64_t* row = rowWords(flag, y);
+        for (size_t w = firstWord; w <= lastWord; ++w) {
+            count += static_cast<size_t>(__builtin_popcountll(row[w] & spanMask(w, minX, maxX)));
+        }
+    }
+    return count;
+}
+
+size_t TileMap::countInRadius(int centerX, int centerY, int radius, TileFlag flag) const {
+    if (radius < 0) {
+        return 0;
+    }
+    size_t count = 0;
+    for (int dy = -radius; dy <= radius; ++dy) {
+        int halfWidth = discHalfWidth(radius, dy);
+        count += countInRect(centerX - halfWidth, centerY + dy, centerX + halfWidth, centerY + dy, flag);
+    }
+    return count;
+}
+
+void TileMap::collectInRadius(int centerX, int centerY, int radius, TileFlag flag, std::vector<TileCoord>& out) const {
+    if (radius < 0) {
+        return;
+    }
+    for (int dy = -radius; dy <= radius; ++dy) {
+        int y = centerY + dy;
+        if (y < 0 || y >= height) {
+            continue;
+        }
+        int halfWidth = discHalfWidth(radius, dy);
+        int minX = centerX - halfWidth;
+        int maxX = centerX + halfWidth;
+        if (!clipSpan(minX, maxX)) {
+            continue;
+        }
+
+        const uint64_t* row = rowWords(flag, y);
+        size_t lastWord = static_cast<size_t>(maxX) / WORD_BITS;
+        for (size_t w = static_cast<size_t>(minX) / WORD_BITS; w <= lastWord; ++w) {
+            uint64_t bits = row[w] & spanMask(w, minX, maxX);
+            while (bits) {
+                int bit = __builtin_ctzll(bits);
+                out.push_back(TileCoord{static_cast<int>(w * WORD_BITS) + bit, y});
+                bits &= bits - 1;
+            }
+        }
+    }
+}
+
+const uint64_t* TileMap::getRow(TileFlag flag, int y) const {
+    return rowWords(flag, y);
+}
+
+uint64_t* TileMap::rowWords(TileFlag flag, int y) {
+    size_t planeRow = static_cast<size_t>(flag) * static_cast<size_t>(height) + static_cast<size_t>(y);
+    return storage.data() + alignOffset + planeRow * wordsPerRow;
+}
+
+const uint64_t* TileMap::rowWords(TileFlag flag, int y) const {
+    size_t planeRow = static_cast<size_t>(flag) * static_cast<size_t>(height) + static_cast<size_t>(y);
+    return storage.data() + alignOffset + planeRow * wordsPerRow;
+}
+
+bool TileMap::clipSpan(int& minX, int& maxX) const {
+    minX = std::max(minX, 0);
+    maxX = std::min(maxX, width - 1);
+    return minX <= maxX && height > 0;
+}
+
+int TileMap::discHalfWidth(int radius, int dy) {
+    int64_t remaining = static_cast<int64_t>(radius) * radius - static_cast<int64_t>(dy) * dy;
+    int64_t halfWidth = static_cast<int64_t>(std::sqrt(static_cast<double>(remaining)));
+    // Correct floating-point rounding at exact squares
+    while (halfWidth * halfWidth > remaining) {
+        --halfWidth;
+    }
+    while ((halfWidth + 1) * (halfWidth + 1) <= remaining) {
+        ++halfWidth;
+    }
+    return static_cast<int>(halfWidth);
+}
+
+} // namespace ECS
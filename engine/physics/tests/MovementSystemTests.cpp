@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "../include/MovementSystem.hpp"
+#include "../../ecs/systems/include/SystemManager.hpp"
 #include "../../input/include/MockInputManager.hpp"
 #include "../../ecs/include/ComponentArray.hpp"
 #include "../../ecs/components/include/Transform.hpp"
@@ -454,4 +455,312 @@ TEST_F(MovementSystemTest, SystemWithoutInputManager) {
     
     const GridMovement* movement = gridMovements->get(entity.id);
     EXPECT_TRUE(movement->isMoving);
-}
\ No newline at end of file
+}
+
+/**
+ * Test scheduling through SystemManager as an ISystem
+ */
+TEST_F(MovementSystemTest, ScheduledBySystemManager) {
+    auto scheduled = std::make_unique<MovementSystem>(
+        positions.get(), gridPositions.get(), gridMovements.get(), velocities.get(),
+        nullptr, nullptr, gridBounds.get(), nullptr);
+    MovementSystem* scheduledPtr = scheduled.get();
+    EXPECT_EQ(scheduledPtr->getPhase(), SystemPhase::Simulation);
+    EXPECT_TRUE(scheduledPtr->canRunInParallel());
+    EXPECT_STREQ(scheduledPtr->getName(), "MovementSystem");
+    EXPECT_NE(scheduledPtr->getComponentWrites() & getComponentBit<Position>(), 0u);
+    EXPECT_EQ(scheduledPtr->getResourceReads(), 0u);
+    EXPECT_EQ(scheduledPtr->getResourceWrites() & getResourceBit<OccupancyGrid>(), 0u);
+    EXPECT_NE(scheduledPtr->getResourceWrites() & getResourceBit<PathPool>(), 0u);
+
+    SystemManager systemManager;
+    systemManager.registerSystem(std::move(scheduled));
+
+    Entity entity = createMovableEntity(0, 0);
+    ASSERT_TRUE(scheduledPtr->requestGridMovement(entity.id, 1, 0, false));
+    systemManager.updateAll(0.5f, *entityManager);
+
+    const GridMovement* movement = gridMovements->get(entity.id);
+    EXPECT_GT(movement->progress, 0.0f);
+    EXPECT_GT(positions->get(entity.id)->x, 0.0f);
+}
+
+/**
+ * Test that attached grids are declared so the scheduler never overlaps them
+ */
+TEST_F(MovementSystemTest, GridResourcesDeclared) {
+    TileMap map(4, 4);
+    OccupancyGrid occupancy(4, 4);
+    movementSystem->setTileMap(&map);
+    movementSystem->setOccupancyGrid(&occupancy);
+    EXPECT_NE(movementSystem->getResourceReads() & getResourceBit<TileMap>(), 0u);
+    EXPECT_NE(movementSystem->getResourceWrites() & getResourceBit<OccupancyGrid>(), 0u);
+
+    movementSystem->setTileMap(nullptr);
+    movementSystem->setOccupancyGrid(nullptr);
+    EXPECT_EQ(movementSystem->getResourceReads(), 0u);
+    EXPECT_EQ(movementSystem->getResourceWrites() & getResourceBit<OccupancyGrid>(), 0u);
+}
+
+/**
+ * Test active set: only movers are tracked and completed moves leave it
+ */
+TEST_F(MovementSystemTest, ActiveSetTracksMovers) {
+    Entity idle = createMovableEntity(0, 0);
+    Entity slow = createMovableEntity(2, 2);
+    Entity fast = createMovableEntity(4, 4);
+    EXPECT_EQ(movementSystem->getMovingCount(), 0u);
+
+    ASSERT_TRUE(movementSystem->requestGridMovement(slow.id, 3, 2, false));
+    ASSERT_TRUE(movementSystem->requestGridMovement(fast.id, 5, 4, false));
+    ASSERT_TRUE(movementSystem->requestGridMovement(fast.id, 5, 4, false)); // Re-request keeps one entry
+    EXPECT_EQ(movementSystem->getMovingCount(), 2u);
+    EXPECT_FALSE(movementSystem->isEntityMoving(idle.id, *entityManager));
+    EXPECT_TRUE(movementSystem->isEntityMoving(slow.id, *entityManager));
+
+    gridMovements->get(slow.id)->speed = 0.5f;
+    movementSystem->update(*entityManager, 1.0f);
+    EXPECT_EQ(movementSystem->getMovingCount(), 1u);
+    EXPECT_EQ(movementSystem->getMovingEntities()[0], slow.id);
+    EXPECT_EQ(gridPositions->get(fast.id)->x, 5);
+
+    // Destroyed movers are dropped on the next update
+    entityManager->destroyEntity(slow);
+    movementSystem->update(*entityManager, 0.1f);
+    EXPECT_EQ(movementSystem->getMovingCount(), 0u);
+
+    // Queued moves join the set when started
+    ASSERT_TRUE(movementSystem->queueGridMovement(idle.id, 0, 1, false));
+    movementSystem->executeQueuedMovements(*entityManager);
+    EXPECT_TRUE(movementSystem->isEntityMoving(idle.id, *entityManager));
+    movementSystem->stopMovement(idle.id, *entityManager, false);
+    EXPECT_EQ(movementSystem->getMovingCount(), 0u);
+}
+
+/**
+ * Test pending-move list ordering policies and mid-move carry-over
+ */
+TEST_F(MovementSystemTest, PendingMoveOrdering) {
+    Entity a = createMovableEntity(0, 0);
+    Entity b = createMovableEntity(2, 0);
+    Entity c = createMovableEntity(4, 0);
+
+    movementSystem->queueGridMovement(c.id, 4, 1, false, 1);
+    movementSystem->queueGridMovement(a.id, 0, 1, false, 5);
+    movementSystem->queueGridMovement(b.id, 2, 1, false, 5);
+    movementSystem->queueGridMovement(c.id, 4, 2, false, 9); // Re-queue updates in place
+    EXPECT_EQ(movementSystem->getPendingMoveCount(), 3u);
+    EXPECT_EQ(gridMovements->get(c.id)->pendingY, 2);
+
+    EXPECT_EQ(movementSystem->getQueuedMoveOrder(), QueuedMoveOrder::Queued);
+    EXPECT_EQ(movementSystem->getPendingMoveOrder(), (std::vector<EntityID>{c.id, a.id, b.id}));
+    movementSystem->setQueuedMoveOrder(QueuedMoveOrder::ByEntityID);
+    EXPECT_EQ(movementSystem->getPendingMoveOrder(), (std::vector<EntityID>{a.id, b.id, c.id}));
+    movementSystem->setQueuedMoveOrder(QueuedMoveOrder::ByInitiative);
+    EXPECT_EQ(movementSystem->getPendingMoveOrder(), (std::vector<EntityID>{c.id, a.id, b.id}));
+
+    // An entity still mid-move keeps its pending move for the next turn
+    ASSERT_TRUE(movementSystem->requestGridMovement(a.id, 1, 0, false));
+    movementSystem->executeQueuedMovements(*entityManager);
+    EXPECT_EQ(movementSystem->getPendingMoveOrder(), std::vector<EntityID>{a.id});
+    EXPECT_EQ(gridMovements->get(c.id)->targetY, 2);
+    EXPECT_TRUE(movementSystem->isEntityMoving(b.id, *entityManager));
+
+    movementSystem->update(*entityManager, 1.0f);
+    movementSystem->executeQueuedMovements(*entityManager);
+    EXPECT_EQ(movementSystem->getPendingMoveCount(), 0u);
+    EXPECT_EQ(gridMovements->get(a.id)->targetY, 1);
+    EXPECT_TRUE(movementSystem->isEntityMoving(a.id, *entityManager));
+}
+
+/**
+ * Test tile map obstacles reject movement targets
+ */
+TEST_F(MovementSystemTest, TileMapValidation) {
+    TileMap map(8, 8);
+    map.set(2, 1, TileFlag::Blocked);
+    map.set(1, 2, TileFlag::Hazard);
+    movementSystem->setTileMap(&map);
+    EXPECT_EQ(movementSystem->getTileMap(), &map);
+
+    Entity entity = createMovableEntity(1, 1);
+    EXPECT_FALSE(movementSystem->requestGridMovement(entity.id, 2, 1));
+    EXPECT_FALSE(movementSystem->queueGridMovement(entity.id, 8, 1));
+    EXPECT_FALSE(movementSystem->isEntityMoving(entity.id, *entityManager));
+    EXPECT_TRUE(movementSystem->requestGridMovement(entity.id, 1, 2)); // Hazards are walkable
+    EXPECT_TRUE(movementSystem->queueGridMovement(entity.id, 2, 1, false)); // Validation skipped
+
+    movementSystem->setTileMap(nullptr);
+    EXPECT_TRUE(movementSystem->requestGridMovement(entity.id, 2, 1));
+}
+
+/**
+ * Test occupancy reservations reject conflicting moves and follow completion
+ */
+TEST_F(MovementSystemTest, OccupancyReservations) {
+    OccupancyGrid occupancy(8, 8);
+    movementSystem->setOccupancyGrid(&occupancy);
+    EXPECT_EQ(movementSystem->getOccupancyGrid(), &occupancy);
+
+    Entity a = createMovableEntity(1, 1);
+    Entity b = createMovableEntity(3, 1);
+    Entity c = createMovableEntity(5, 5);
+    movementSystem->rebuildOccupancy(*entityManager);
+    EXPECT_EQ(occupancy.getOccupiedCount(), 3u);
+    EXPECT_EQ(occupancy.getOccupant(3, 1), b.id);
+
+    // Simultaneous requests for the same cell: the second is rejected
+    EXPECT_FALSE(movementSystem->requestGridMovement(a.id, 3, 1)); // Occupied
+    EXPECT_TRUE(movementSystem->requestGridMovement(a.id, 2, 1));
+    EXPECT_FALSE(movementSystem->requestGridMovement(b.id, 2, 1));
+    EXPECT_EQ(occupancy.getReservation(2, 1), a.id);
+
+    // Retargeting moves the reservation
+    EXPECT_TRUE(movementSystem->requestGridMovement(a.id, 1, 2));
+    EXPECT_EQ(occupancy.getReservation(2, 1), INVALID_ENTITY);
+    EXPECT_EQ(occupancy.getReservation(1, 2), a.id);
+
+    movementSystem->update(*entityManager, 1.0f);
+    EXPECT_EQ(occupancy.getOccupant(1, 1), INVALID_ENTITY);
+    EXPECT_EQ(occupancy.getOccupant(1, 2), a.id);
+    EXPECT_EQ(occupancy.getReservation(1, 2), INVALID_ENTITY);
+
+    // Stopping releases the reservation without moving the occupant
+    ASSERT_TRUE(movementSystem->requestGridMovement(c.id, 5, 6));
+    movementSystem->stopMovement(c.id, *entityManager);
+    EXPECT_EQ(occupancy.getReservation(5, 6), INVALID_ENTITY);
+    EXPECT_EQ(occupancy.getOccupant(5, 5), c.id);
+
+    // Queued moves into one cell: the first in order wins
+    movementSystem->setQueuedMoveOrder(QueuedMoveOrder::ByEntityID);
+    ASSERT_TRUE(movementSystem->queueGridMovement(c.id, 4, 4));
+    ASSERT_TRUE(movementSystem->queueGridMovement(b.id, 4, 4));
+    movementSystem->executeQueuedMovements(*entityManager);
+    EXPECT_TRUE(movementSystem->isEntityMoving(b.id, *entityManager));
+    EXPECT_FALSE(movementSystem->isEntityMoving(c.id, *entityManager));
+    EXPECT_FALSE(gridMovements->get(c.id)->hasPendingMove);
+    EXPECT_EQ(occupancy.getReservation(4, 4), b.id);
+
+    // Unvalidated queued moves lose contested cells too
+    movementSystem->update(*entityManager, 1.0f);
+    ASSERT_TRUE(movementSystem->queueGridMovement(c.id, 4, 4, false));
+    ASSERT_TRUE(movementSystem->queueGridMovement(a.id, 1, 3, false));
+    Entity d = createMovableEntity(2, 3);
+    occupancy.place(d.id, 2, 3);
+    ASSERT_TRUE(movementSystem->queueGridMovement(d.id, 1, 3, false));
+    movementSystem->executeQueuedMovements(*entityManager);
+    EXPECT_FALSE(movementSystem->isEntityMoving(c.id, *entityManager));
+    EXPECT_FALSE(gridMovements->get(c.id)->hasPendingMove);
+    EXPECT_TRUE(movementSystem->isEntityMoving(a.id, *entityManager));
+    EXPECT_FALSE(movementSystem->isEntityMoving(d.id, *entityManager));
+    EXPECT_EQ(occupancy.getReservation(1, 3), a.id);
+    EXPECT_EQ(occupancy.getOccupant(4, 4), b.id);
+    EXPECT_EQ(occupancy.getOccupant(5, 5), c.id);
+}
+
+/**
+ * Test unvalidated moves never leave a unit off the occupancy grid
+ */
+TEST_F(MovementSystemTest, OccupancyKeepsUnvalidatedMovers) {
+    OccupancyGrid occupancy(8, 8);
+    movementSystem->setOccupancyGrid(&occupancy);
+    Entity a = createMovableEntity(1, 1);
+    Entity b = createMovableEntity(2, 1);
+    movementSystem->rebuildOccupancy(*entityManager);
+
+    // Skipping validation does not allow stepping onto another unit
+    EXPECT_FALSE(movementSystem->requestGridMovement(a.id, 2, 1, false));
+    EXPECT_FALSE(movementSystem->isEntityMoving(a.id, *entityManager));
+    EXPECT_EQ(occupancy.getOccupant(1, 1), a.id);
+    EXPECT_EQ(occupancy.getOccupant(2, 1), b.id);
+    EXPECT_TRUE(movementSystem->requestGridMovement(a.id, 1, 2, false));
+    EXPECT_EQ(occupancy.getReservation(1, 2), a.id);
+
+    // Target taken by a unit placed outside the system: the mover stays put
+    Entity spawned = createMovableEntity(1, 2);
+    ASSERT_TRUE(occupancy.place(spawned.id, 1, 2));
+    movementSystem->update(*entityManager, 1.0f);
+    auto* gridPosition = gridPositions->get(a.id);
+    EXPECT_EQ(gridPosition->x, 1);
+    EXPECT_EQ(gridPosition->y, 1);
+    EXPECT_FLOAT_EQ(positions->get(a.id)->y, 1.0f * movementSystem->getGridCellSize());
+    EXPECT_FALSE(movementSystem->isEntityMoving(a.id, *entityManager));
+    EXPECT_EQ(occupancy.getOccupant(1, 1), a.id);
+    EXPECT_EQ(occupancy.getOccupant(1, 2), spawned.id);
+    EXPECT_EQ(occupancy.getReservation(1, 2), INVALID_ENTITY);
+    EXPECT_EQ(occupancy.getOccupiedCount(), 3u);
+}
+
+/**
+ * Test multi-step paths are consumed step by step without further requests
+ */
+TEST_F(MovementSystemTest, PathFollowing) {
+    OccupancyGrid occupancy(8, 8);
+    movementSystem->setOccupancyGrid(&occupancy);
+    Entity mover = createMovableEntity(0, 0);
+    Entity blocker = createMovableEntity(4, 2);
+    movementSystem->rebuildOccupancy(*entityManager);
+
+    std::vector<TileCoord> path = {{1, 0}, {2, 0}, {2, 1}, {3, 1}};
+    ASSERT_TRUE(movementSystem->requestGridPath(mover.id, path));
+    EXPECT_EQ(movementSystem->getRemainingPathSteps(mover.id), 3u);
+    EXPECT_EQ(movementSystem->getPathPool().getUsedCount(), 3u);
+
+    // Half a step per update: leftover progress carries into the next step
+    movementSystem->update(*entityManager, 0.5f);
+    movementSystem->update(*entityManager, 0.75f);
+    auto* gridPosition = gridPositions->get(mover.id);
+    auto* gridMovement = gridMovements->get(mover.id);
+    EXPECT_EQ(gridPosition->x, 1);
+    EXPECT_EQ(gridMovement->targetX, 2);
+    EXPECT_FLOAT_EQ(gridMovement->progress, 0.25f);
+    EXPECT_EQ(occupancy.getReservation(2, 0), mover.id);
+    EXPECT_TRUE(movementSystem->isEntityMoving(mover.id, *entityManager));
+
+    for (int i = 0; i < 3; ++i) {
+        movementSystem->update(*entityManager, 1.0f);
+    }
+    EXPECT_EQ(gridPosition->x, 3);
+    EXPECT_EQ(gridPosition->y, 1);
+    EXPECT_EQ(occupancy.getOccupant(3, 1), mover.id);
+    EXPECT_FALSE(movementSystem->isEntityMoving(mover.id, *entityManager));
+    EXPECT_EQ(movementSystem->getPathPool().getUsedCount(), 0u);
+
+    // A step that became blocked ends the path at the current cell
+    path = {{4, 1}, {4, 2}, {4, 3}};
+    ASSERT_TRUE(movementSystem->requestGridPath(mover.id, path));
+    movementSystem->update(*entityManager, 1.0f);
+    EXPECT_EQ(gridPosition->x, 4);
+    EXPECT_EQ(gridPosition->y, 1);
+    EXPECT_FALSE(movementSystem->isEntityMoving(mover.id, *entityManager));
+    EXPECT_EQ(movementSystem->getRemainingPathSteps(mover.id), 0u);
+    EXPECT_EQ(occupancy.getOccupant(4, 2), blocker.id);
+
+    // Unvalidated paths stop there as well instead of walking onto the blocker
+    path = {{5, 1}, {4, 2}, {4, 3}};
+    ASSERT_TRUE(movementSystem->requestGridPath(mover.id, path, false));
+    movementSystem->update(*entityManager, 1.0f);
+    EXPECT_EQ(gridPosition->x, 5);
+    EXPECT_EQ(gridPosition->y, 1);
+    EXPECT_FALSE(movementSystem->isEntityMoving(mover.id, *entityManager));
+    EXPECT_EQ(movementSystem->getRemainingPathSteps(mover.id), 0u);
+    EXPECT_EQ(occupancy.getOccupant(5, 1), mover.id);
+    EXPECT_EQ(occupancy.getOccupant(4, 2), blocker.id);
+    EXPECT_EQ(occupancy.getReservation(4, 2), INVALID_ENTITY);
+
+    // Explicit moves and stops drop the path
+    path = {{5, 1}, {6, 1}, {7, 1}};
+    ASSERT_TRUE(movementSystem->requestGridPath(mover.id, path));
+    ASSERT_TRUE(movementSystem->requestGridMovement(mover.id, 4, 0));
+    EXPECT_EQ(movementSystem->getRemainingPathSteps(mover.id), 0u);
+    ASSERT_TRUE(movementSystem->requestGridPath(mover.id, path));
+    movementSystem->stopMovement(mover.id, *entityManager);
+    EXPECT_EQ(movementSystem->getPathPool().getUsedCount(), 0u);
+
+    // Destroyed mid-path: the block is freed when the entity is pruned
+    ASSERT_TRUE(movementSystem->requestGridPath(mover.id, path));
+    entityManager->destroyEntity(mover);
+    movementSystem->update(*entityManager, 0.5f);
+    EXPECT_EQ(movementSystem->getPathPool().getUsedCount(), 0u);
+    EXPECT_FALSE(movementSystem->requestGridPath(blocker.id, std::vector<TileCoord>{}));
+}
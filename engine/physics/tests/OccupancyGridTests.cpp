@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "../include/OccupancyGrid.hpp"
+
+using namespace ECS;
+
+/**
+ * Test placing, removing and moving occupants
+ */
+TEST(OccupancyGridTest, Occupants) {
+    OccupancyGrid grid(10, 5);
+    EXPECT_EQ(grid.getWidth(), 10);
+    EXPECT_EQ(grid.getHeight(), 5);
+    EXPECT_TRUE(grid.isFree(3, 3));
+
+    EXPECT_TRUE(grid.place(1, 3, 3));
+    EXPECT_TRUE(grid.place(1, 3, 3)); // Idempotent
+    EXPECT_FALSE(grid.place(2, 3, 3));
+    EXPECT_FALSE(grid.place(2, 10, 0));
+    EXPECT_EQ(grid.getOccupant(3, 3), 1u);
+    EXPECT_EQ(grid.getOccupiedCount(), 1u);
+    EXPECT_FALSE(grid.isFree(3, 3));
+    EXPECT_TRUE(grid.isFree(3, 3, 1));
+    EXPECT_FALSE(grid.isFree(-1, 0));
+
+    grid.remove(2, 3, 3); // Not the occupant
+    EXPECT_EQ(grid.getOccupant(3, 3), 1u);
+
+    EXPECT_TRUE(grid.move(1, 3, 3, 4, 3));
+    EXPECT_EQ(grid.getOccupant(3, 3), INVALID_ENTITY);
+    EXPECT_EQ(grid.getOccupant(4, 3), 1u);
+    EXPECT_EQ(grid.getOccupiedCount(), 1u);
+
+    // A failed move leaves the entity where it was
+    grid.place(2, 5, 3);
+    EXPECT_FALSE(grid.move(1, 4, 3, 5, 3));
+    EXPECT_FALSE(grid.move(1, 4, 3, 10, 3));
+    EXPECT_EQ(grid.getOccupant(4, 3), 1u);
+    EXPECT_EQ(grid.getOccupant(5, 3), 2u);
+    EXPECT_EQ(grid.getOccupiedCount(), 2u);
+    grid.remove(2, 5, 3);
+
+    grid.remove(1, 4, 3);
+    EXPECT_EQ(grid.getOccupiedCount(), 0u);
+}
+
+/**
+ * Test reservations block other entities until released or completed
+ */
+TEST(OccupancyGridTest, Reservations) {
+    OccupancyGrid grid(4, 4);
+    grid.place(1, 0, 0);
+    grid.place(2, 2, 2);
+
+    EXPECT_TRUE(grid.reserve(1, 1, 0));
+    EXPECT_EQ(grid.getReservation(1, 0), 1u);
+    EXPECT_FALSE(grid.reserve(3, 1, 0));
+    EXPECT_FALSE(grid.isFree(1, 0, 3));
+    EXPECT_FALSE(grid.reserve(1, 2, 2)); // Occupied
+
+    grid.release(3, 1, 0); // Not the holder
+    EXPECT_EQ(grid.getReservation(1, 0), 1u);
+
+    EXPECT_TRUE(grid.move(1, 0, 0, 1, 0));
+    EXPECT_EQ(grid.getReservation(1, 0), INVALID_ENTITY);
+    EXPECT_TRUE(grid.reserve(3, 0, 0));
+    grid.release(3, 0, 0);
+    EXPECT_TRUE(grid.isFree(0, 0, 3));
+
+    grid.clear();
+    EXPECT_EQ(grid.getOccupiedCount(), 0u);
+    EXPECT_EQ(grid.getOccupant(2, 2), INVALID_ENTITY);
+}
+
+/**
+ * Test area versions move only when a change lands in an overlapping region
+ */
+TEST(OccupancyGridTest, AreaVersions) {
+    OccupancyGrid grid(32, 32);
+    uint64_t nearVersion = grid.getAreaVersion(0, 0, 9, 9);
+    uint64_t farVersion = grid.getAreaVersion(24, 24, 31, 31);
+
+    grid.place(1, 3, 3);
+    EXPECT_NE(grid.getAreaVersion(0, 0, 9, 9), nearVersion);
+    EXPECT_EQ(grid.getAreaVersion(24, 24, 31, 31), farVersion);
+
+    // Failed or no-op writes do not count as changes
+    nearVersion = grid.getAreaVersion(0, 0, 9, 9);
+    grid.place(2, 3, 3);
+    grid.remove(2, 3, 3);
+    grid.release(2, 4, 4);
+    EXPECT_EQ(grid.getAreaVersion(0, 0, 9, 9), nearVersion);
+
+    grid.reserve(1, 25, 25);
+    EXPECT_NE(grid.getAreaVersion(24, 24, 31, 31), farVersion);
+
+    farVersion = grid.getAreaVersion(24, 24, 31, 31);
+    grid.clear();
+    EXPECT_NE(grid.getAreaVersion(24, 24, 31, 31), farVersion);
+}
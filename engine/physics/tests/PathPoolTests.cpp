@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "../include/PathPool.hpp"
+#include <vector>
+
+using namespace ECS;
+
+namespace {
+
+std::vector<TileCoord> makeSteps(int count, int y) {
+    std::vector<TileCoord> steps;
+    for (int x = 0; x < count; ++x) {
+        steps.push_back(TileCoord{x, y});
+    }
+    return steps;
+}
+
+} // namespace
+
+/**
+ * Test allocation, per-owner replacement and step lookup
+ */
+TEST(PathPoolTest, AllocateAndRelease) {
+    PathPool pool;
+    std::vector<TileCoord> a = makeSteps(4, 1);
+    std::vector<TileCoord> b = makeSteps(3, 2);
+
+    uint32_t first = pool.allocate(1, a.data(), a.size());
+    uint32_t second = pool.allocate(2, b.data(), b.size());
+    EXPECT_EQ(first, 0u);
+    EXPECT_EQ(second, 4u);
+    EXPECT_EQ(pool.get(first + 3), (TileCoord{3, 1}));
+    EXPECT_EQ(pool.get(second), (TileCoord{0, 2}));
+    EXPECT_EQ(pool.getUsedCount(), 7u);
+    EXPECT_TRUE(pool.hasBlock(1));
+
+    // Re-allocating replaces the owner's block
+    uint32_t replaced = pool.allocate(1, b.data(), 2);
+    EXPECT_EQ(replaced, 0u);   // First fit in the freed block
+    EXPECT_EQ(pool.getUsedCount(), 5u);
+    EXPECT_EQ(pool.getFreeBlockCount(), 1u);
+
+    pool.release(3);           // No block: no-op
+    pool.release(1);
+    EXPECT_FALSE(pool.hasBlock(1));
+    EXPECT_EQ(pool.getUsedCount(), 3u);
+
+    pool.clear();
+    EXPECT_EQ(pool.getSize(), 0u);
+    EXPECT_FALSE(pool.hasBlock(2));
+}
+
+/**
+ * Test free blocks merge and trailing gaps are trimmed
+ */
+TEST(PathPoolTest, FreeListMerging) {
+    PathPool pool;
+    std::vector<TileCoord> steps = makeSteps(5, 0);
+    for (EntityID owner = 1; owner <= 4; ++owner) {
+        pool.allocate(owner, steps.data(), steps.size());
+    }
+    EXPECT_EQ(pool.getSize(), 20u);
+
+    pool.release(1);
+    pool.release(3);
+    EXPECT_EQ(pool.getFreeBlockCount(), 2u);
+    pool.release(2);           // Joins both neighbours
+    EXPECT_EQ(pool.getFreeBlockCount(), 1u);
+
+    // A long path fits in the merged gap
+    std::vector<TileCoord> longPath = makeSteps(15, 9);
+    EXPECT_EQ(pool.allocate(5, longPath.data(), longPath.size()), 0u);
+    EXPECT_EQ(pool.getFreeBlockCount(), 0u);
+    EXPECT_EQ(pool.getSize(), 20u);
+
+    // Releasing the tail trims the array, then the merged front follows
+    pool.release(4);
+    EXPECT_EQ(pool.getSize(), 15u);
+    pool.release(5);
+    EXPECT_EQ(pool.getSize(), 0u);
+    EXPECT_EQ(pool.getFreeBlockCount(), 0u);
+    EXPECT_EQ(pool.getUsedCount(), 0u);
+}
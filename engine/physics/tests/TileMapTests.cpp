@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "../include/TileMap.hpp"
+#include <cstdint>
+#include <vector>
+
+using namespace ECS;
+
+/**
+ * Test single-tile queries, flag masks and out-of-bounds behaviour
+ */
+TEST(TileMapTest, TileQueries) {
+    TileMap map(100, 20);
+    EXPECT_EQ(map.getWidth(), 100);
+    EXPECT_EQ(map.getHeight(), 20);
+    EXPECT_EQ(map.getWordsPerRow() % TileMap::CACHE_LINE_WORDS, 0u);
+
+    EXPECT_TRUE(map.has(99, 19, TileFlag::Traversable));
+    EXPECT_TRUE(map.isWalkable(64, 3));
+    EXPECT_FALSE(map.has(3, 3, TileFlag::Hazard));
+
+    map.set(64, 3, TileFlag::Blocked);
+    map.set(65, 3, TileFlag::Hazard);
+    EXPECT_FALSE(map.isWalkable(64, 3));
+    EXPECT_TRUE(map.isWalkable(65, 3));
+    EXPECT_TRUE(map.isWalkable(63, 3));
+
+    map.setFlags(7, 7, (1u << static_cast<uint8_t>(TileFlag::Interactable)));
+    EXPECT_EQ(map.getFlags(7, 7), (1u << static_cast<uint8_t>(TileFlag::Interactable)));
+    EXPECT_FALSE(map.isWalkable(7, 7)); // Traversable cleared
+
+    // Outside the map: no flags, never walkable, writes ignored
+    map.set(-1, 0, TileFlag::Hazard);
+    map.set(100, 0, TileFlag::Hazard);
+    EXPECT_FALSE(map.isWalkable(-1, 0));
+    EXPECT_FALSE(map.isWalkable(0, 20));
+    EXPECT_EQ(map.getFlags(100, 0), 0u);
+    EXPECT_EQ(map.countInRect(0, 0, 99, 19, TileFlag::Hazard), 1u);
+
+    TileMap empty(10, 10, false);
+    EXPECT_FALSE(empty.isWalkable(0, 0));
+}
+
+/**
+ * Test rows are cache-line aligned and padding bits stay clear
+ */
+TEST(TileMapTest, AlignedRowsAndPadding) {
+    TileMap map(70, 3);
+    for (int y = 0; y < 3; ++y) {
+        const uint64_t* row = map.getRow(TileFlag::Traversable, y);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(row) % 64, 0u);
+        EXPECT_EQ(row[0], ~0ULL);
+        EXPECT_EQ(row[1], (1ULL << 6) - 1); // Tiles 64..69 only
+        EXPECT_EQ(row[2], 0u);
+    }
+
+    map.fill(TileFlag::Hazard, true);
+    EXPECT_EQ(map.countInRect(-50, -50, 500, 500, TileFlag::Hazard), 210u);
+    map.fill(TileFlag::Hazard, false);
+    EXPECT_EQ(map.countInRect(0, 0, 69, 2, TileFlag::Hazard), 0u);
+
+    // Moving keeps the aligned storage
+    TileMap moved(std::move(map));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(moved.getRow(TileFlag::Blocked, 2)) % 64, 0u);
+    EXPECT_TRUE(moved.isWalkable(69, 2));
+}
+
+/**
+ * Test word-parallel rectangle and radius operations against a per-tile scan
+ */
+TEST(TileMapTest, AreaOperations) {
+    TileMap map(200, 50);
+    map.fillRect(60, 10, 140, 12, TileFlag::Hazard);
+    EXPECT_EQ(map.countInRect(0, 0, 199, 49, TileFlag::Hazard), 81u * 3u);
+    EXPECT_EQ(map.countInRect(64, 11, 127, 11, TileFlag::Hazard), 64u);
+
+    map.fillRect(100, 0, 200, 49, TileFlag::Hazard, false);
+    EXPECT_EQ(map.countInRect(0, 0, 199, 49, TileFlag::Hazard), 40u * 3u);
+
+    // Scattered hazards across word boundaries
+    for (int i = 0; i < 200; i += 7) {
+        map.set(i, (i * 3) % 50, TileFlag::Hazard);
+    }
+
+    const int cx = 70;
+    const int cy = 20;
+    const int radius = 15;
+    size_t expected = 0;
+    std::vector<TileCoord> expectedTiles;
+    for (int y = 0; y < 50; ++y) {
+        for (int x = 0; x < 200; ++x) {
+            int dx = x - cx;
+            int dy = y - cy;
+            if (dx * dx + dy * dy <= radius * radius && map.has(x, y, TileFlag::Hazard)) {
+                ++expected;
+                expectedTiles.push_back(TileCoord{x, y});
+            }
+        }
+    }
+    ASSERT_GT(expected, 0u);
+    EXPECT_EQ(map.countInRadius(cx, cy, radius, TileFlag::Hazard), expected);
+
+    std::vector<TileCoord> tiles;
+    map.collectInRadius(cx, cy, radius, TileFlag::Hazard, tiles);
+    EXPECT_EQ(tiles, expectedTiles);
+
+    // Radius 0 is the centre tile; clipped discs at the corner
+    EXPECT_EQ(map.countInRadius(64, 11, 0, TileFlag::Hazard), 1u);
+    EXPECT_EQ(map.countInRadius(0, 0, 2, TileFlag::Traversable), 6u);
+    EXPECT_EQ(map.countInRadius(0, 0, -1, TileFlag::Traversable), 0u);
+}
@@ -3,6 +3,9 @@
 #include "../../ecs/systems/include/ISystem.hpp"
 #include "IRenderer.hpp"
 #include "../../ecs/include/EntityManager.hpp"
+#include "../../ecs/include/ComponentArray.hpp"
+#include "../../ecs/components/include/Transform.hpp"
+#include "../../ecs/components/include/Rendering.hpp"
 
 namespace ECS {
 
@@ -16,6 +19,9 @@ namespace ECS {
  * - Handles frame lifecycle management (beginFrame/endFrame)
  * - ECS-compliant system with bitmask-based entity queries
  * - Testable using MockRenderer without graphics dependencies
+ * - Render interpolation: with component arrays injected, draws each entity
+ *   at lerp(PreviousPosition, Position, alpha) so a fixed-rate simulation
+ *   renders smoothly at any refresh rate (see FixedTimestep)
  * 
  * Component Requirements:
  * - Position (for world coordinates)
@@ -24,12 +30,23 @@ namespace ECS {
  * Usage:
  *   MockRenderer mockRenderer;
  *   RenderSystem renderSystem(&mockRenderer);
+ *   renderSystem.setComponentSources(&positions, &renderables, &sprites, &previousPositions);
+ *   renderSystem.setInterpolationAlpha(timestep.getAlpha());
  *   renderSystem.update(deltaTime, entityManager);
+ * 
+ * Without injected component arrays, placeholder values are rendered.
  */
 class RenderSystem : public ISystem {
 private:
     IRenderer* renderer;  // Injected rendering implementation
     
+    // Injected component storage (nullptr = placeholder rendering)
+    ComponentArray<Position>* positions = nullptr;
+    ComponentArray<Renderable>* renderables = nullptr;
+    ComponentArray<Sprite>* sprites = nullptr;
+    ComponentArray<PreviousPosition>* previousPositions = nullptr;
+    float interpolationAlpha = 1.0f;
+    
 public:
     /**
      * Constructor with dependency injection
@@ -57,6 +74,18 @@ public:
      */
     int getPriority() const override;
     
+    /**
+     * Get system name for profiling
+     * @return "RenderSystem"
+     */
+    const char* getName() const override;
+    
+    /**
+     * Get system phase - rendering runs in the Render phase
+     * @return SystemPhase::Render
+     */
+    SystemPhase getPhase() const override;
+    
     /**
      * Check if system should update this frame
      * @param deltaTime Time elapsed since last update
@@ -70,6 +99,30 @@ public:
      */
     IRenderer* getRenderer() const;
     
+    /**
+     * Inject component storage to render actual component data
+     * @param positions Position array (required for component rendering)
+     * @param renderables Renderable array for shape entities
+     * @param sprites Sprite array for sprite entities (optional)
+     * @param previousPositions Snapshots for interpolation (optional)
+     */
+    void setComponentSources(ComponentArray<Position>* positions,
+                             ComponentArray<Renderable>* renderables,
+                             ComponentArray<Sprite>* sprites = nullptr,
+                             ComponentArray<PreviousPosition>* previousPositions = nullptr);
+    
+    /**
+     * Set interpolation factor between previous and current positions
+     * @param alpha 0.0 = previous simulation state, 1.0 = current (default)
+     */
+    void setInterpolationAlpha(float alpha);
+    
+    /**
+     * Get interpolation factor used by the next update
+     * @return Interpolation alpha
+     */
+    float getInterpolationAlpha() const;
+    
     /**
      * Get count of entities rendered in last update (for testing)
      * @return Number of entities processed in last update call
@@ -80,6 +133,14 @@ private:
     // Statistics for testing verification
     size_t lastRenderCount = 0;
     
+    /**
+     * Get the interpolated render position of an entity from injected arrays
+     * @param entityId Entity to look up
+     * @param out Interpolated position
+     * @return false if the entity has no Position
+     */
+    bool getRenderPosition(EntityID entityId, Position& out) const;
+    
     /**
      * Render entity with Position + Sprite components
      * @param entity Entity to render
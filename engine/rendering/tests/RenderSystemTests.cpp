@@ -372,4 +372,33 @@ TEST_F(RenderSystemTest, NullRendererHandling) {
     // Update with null renderer should either throw or handle gracefully
     // For now, test that it doesn't crash the program
     EXPECT_NO_THROW(nullSystem.update(0.016f, *entityManager));
-}
\ No newline at end of file
+}
+// Test injected component data is rendered with interpolation
+TEST_F(RenderSystemTest, InterpolatedComponentRendering) {
+    ComponentArray<Position> positions;
+    ComponentArray<PreviousPosition> previousPositions;
+    ComponentArray<Renderable> renderables;
+    
+    Entity entity = entityManager->createEntity();
+    positions.add(entity.id, {100.0f, 40.0f, 0.0f}, getComponentBit<Position>(), *entityManager);
+    previousPositions.add(entity.id, {80.0f, 40.0f, 0.0f}, getComponentBit<PreviousPosition>(), *entityManager);
+    renderables.add(entity.id, {10.0f, 20.0f, 1.0f, 0.0f, 0.0f, 1.0f}, getComponentBit<Renderable>(), *entityManager);
+    
+    renderSystem->setComponentSources(&positions, &renderables, nullptr, &previousPositions);
+    EXPECT_FLOAT_EQ(renderSystem->getInterpolationAlpha(), 1.0f);
+    
+    renderSystem->setInterpolationAlpha(0.25f);
+    renderSystem->update(0.016f, *entityManager);
+    
+    ASSERT_EQ(mockRenderer->rectCalls.size(), 1);
+    EXPECT_FLOAT_EQ(mockRenderer->rectCalls[0].x, 85.0f);
+    EXPECT_FLOAT_EQ(mockRenderer->rectCalls[0].y, 40.0f);
+    EXPECT_FLOAT_EQ(mockRenderer->rectCalls[0].width, 10.0f);
+    
+    // Without a snapshot the current position is drawn as-is
+    previousPositions.clear();
+    mockRenderer->reset();
+    renderSystem->update(0.016f, *entityManager);
+    ASSERT_EQ(mockRenderer->rectCalls.size(), 1);
+    EXPECT_FLOAT_EQ(mockRenderer->rectCalls[0].x, 100.0f);
+}
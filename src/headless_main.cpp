@@ -0,0 +1,417 @@
+#include "ComponentArray.hpp"
+#include "ComponentRegistry.hpp"
+#include "EntityManager.hpp"
+#include "IRenderer.hpp"
+#include "Logger.hpp"
+#include "MemoryStats.hpp"
+#include "Profiler.hpp"
+#include "RenderSystem.hpp"
+#include "Rendering.hpp"
+#include "SystemManager.hpp"
+#include "Transform.hpp"
+#include "TransformUtils.hpp"
+#include "../engine/input/include/MockInputManager.hpp"
+#include "../engine/ecs/systems/include/InputSystem.hpp"
+#include "../engine/physics/include/MovementSystem.hpp"
+#include "../engine/pathfinding/include/RandomGrid.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+/**
+ * Train Heist - Headless Simulation Runner
+ *
+ * Runs the ECS simulation without a window: mock input, a renderer that only
+ * counts draw calls, and a scenario that is generated (or loaded from a text
+ * file). Ticks run back to back at a fixed step, then the runner prints
+ * ticks/sec, per-system timings and memory use.
+ *
+ * Used for CI performance gates (--min-tps fails the run below a threshold)
+ * and batch simulation on machines without a display.
+ *
+ * Scenario file format (one item per line, '#' starts a comment):
+ *   grid <width> <height>
+ *   entity <gridX> <gridY> [speed]
+ */
+
+using namespace ECS;
+using RandomGrid::randomBelow;
+
+namespace {
+
+struct RunnerOptions {
+    uint64_t ticks = 1000;
+    size_t entities = 10000;
+    int gridSize = 256;
+    uint32_t seed = 12345;
+    double minTicksPerSecond = 0.0;
+    std::string scenarioPath;
+    std::string tracePath;
+};
+
+struct ScenarioEntity {
+    int x = 0;
+    int y = 0;
+    float speed = 1.0f;
+};
+
+struct Scenario {
+    int width = 0;
+    int height = 0;
+    std::vector<ScenarioEntity> entities;
+};
+
+/**
+ * IRenderer that only counts calls (no recording, no allocation)
+ */
+class CountingRenderer : public IRenderer {
+public:
+    uint64_t frames = 0;
+    uint64_t drawCalls = 0;
+
+    void beginFrame() override { frames++; }
+    void endFrame() override {}
+    void clear() override {}
+    void renderSprite(float x, float y, float z, float width, float height, int textureId) override {
+        (void)x; (void)y; (void)z; (void)width; (void)height; (void)textureId;
+        drawCalls++;
+    }
+    void renderRect(float x, float y, float width, float height,
+                    float red, float green, float blue, float alpha) override {
+        (void)x; (void)y; (void)width; (void)height; (void)red; (void)green; (void)blue; (void)alpha;
+        drawCalls++;
+    }
+    void getScreenSize(int& width, int& height) const override {
+        width = 1 << 20;  // Everything is on screen
+        height = 1 << 20;
+    }
+};
+
+/**
+ * Issues random one-cell moves to idle entities, standing in for player/AI orders
+ */
+class ScenarioDriverSystem : public ISystem {
+public:
+    ScenarioDriverSystem(MovementSystem* movement, ComponentArray<GridPosition>* gridPositions,
+                         ComponentArray<GridMovement>* gridMovements, uint32_t seed)
+        : movement(movement), gridPositions(gridPositions), gridMovements(gridMovements), random(seed) {}
+
+    void update(float deltaTime, EntityManager& entityManager) override {
+        (void)deltaTime;
+        (void)entityManager;
+        static const int offsets[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+        for (size_t i = 0; i < gridMovements->size(); ++i) {
+            if (gridMovements->getByIndex(i).isMoving || randomBelow(random, 4) != 0) {
+                continue;
+            }
+            EntityID id = gridMovements->getEntityByIndex(i);
+            const GridPosition* cell = gridPositions->get(id);
+            if (!cell) {
+                continue;
+            }
+            const int* offset = offsets[randomBelow(random, 4)];
+            if (movement->requestGridMovement(id, cell->x + offset[0], cell->y + offset[1], true)) {
+                ordersIssued++;
+            }
+        }
+    }
+
+    uint64_t getRequiredComponents() const override {
+        return getComponentBit<GridPosition>() | getComponentBit<GridMovement>();
+    }
+    int getPriority() const override { return 500; }  // Before MovementSystem
+    const char* getName() const override { return "ScenarioDriver"; }
+
+    uint64_t ordersIssued = 0;
+
+private:
+    MovementSystem* movement;
+    ComponentArray<GridPosition>* gridPositions;
+    ComponentArray<GridMovement>* gridMovements;
+    uint32_t random;  // Deterministic generator state, so runs are reproducible across platforms
+  };
+
+void printUsage(const char* program) {
+    std::printf(
+        "Usage: %s [options]\n"
+        "  --ticks N         Simulation ticks to run (default 1000)\n"
+        "  --entities N      Generated entity count (default 10000)\n"
+        "  --grid N          Generated grid width/height (default 256)\n"
+        "  --seed N          Generator and driver seed (default 12345)\n"
+        "  --scenario FILE   Load scenario instead of generating one\n"
+        "  --trace FILE      Write a Chrome trace of the run\n"
+        "  --min-tps X       Exit with status 2 if ticks/sec is below X\n",
+        program);
+}
+
+bool parseOptions(int argc, char** argv, RunnerOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        auto needValue = [&]() {
+            if (!value) {
+                std::fprintf(stderr, "Missing value for %s\n", arg);
+                return false;
+            }
+            ++i;
+            return true;
+        };
+
+        if (std::strcmp(arg, "--help") == 0 || std::strcmp(arg, "-h") == 0) {
+            printUsage(argv[0]);
+            std::exit(0);
+        } else if (std::strcmp(arg, "--ticks") == 0) {
+            if (!needValue()) return false;
+            options.ticks = std::strtoull(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--entities") == 0) {
+            if (!needValue()) return false;
+            options.entities = static_cast<size_t>(std::strtoull(value, nullptr, 10));
+        } else if (std::strcmp(arg, "--grid") == 0) {
+            if (!needValue()) return false;
+            options.gridSize = std::atoi(value);
+        } else if (std::strcmp(arg, "--seed") == 0) {
+            if (!needValue()) return false;
+            options.seed = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        } else if (std::strcmp(arg, "--scenario") == 0) {
+            if (!needValue()) return false;
+            options.scenarioPath = value;
+        } else if (std::strcmp(arg, "--trace") == 0) {
+            if (!needValue()) return false;
+            options.tracePath = value;
+        } else if (std::strcmp(arg, "--min-tps") == 0) {
+            if (!needValue()) return false;
+            options.minTicksPerSecond = std::atof(value);
+        } else {
+            std::fprintf(stderr, "Unknown option: %s\n", arg);
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+    if (options.gridSize <= 0) {
+        std::fprintf(stderr, "--grid must be positive\n");
+        return false;
+    }
+    return true;
+}
+
+Scenario generateScenario(const RunnerOptions& options) {
+    Scenario scenario;
+    scenario.width = options.gridSize;
+    scenario.height = options.gridSize;
+    scenario.entities.reserve(options.entities);
+    uint32_t random = options.seed;
+    for (size_t i = 0; i < options.entities; ++i) {
+        ScenarioEntity entity;
+        entity.x = randomBelow(random, scenario.width);
+        entity.y = randomBelow(random, scenario.height);
+        entity.speed = 2.0f + static_cast<float>(randomBelow(random, 5));
+        scenario.entities.push_back(entity);
+    }
+    return scenario;
+}
+
+bool loadScenario(const std::string& path, Scenario& scenario) {
+    std::ifstream in(path);
+    if (!in) {
+        std::fprintf(stderr, "Cannot open scenario: %s\n", path.c_str());
+        return false;
+    }
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        lineNumber++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.resize(comment);
+        }
+        std::istringstream fields(line);
+        std::string keyword;
+        if (!(fields >> keyword)) {
+            continue;
+        }
+        if (keyword == "grid") {
+            fields >> scenario.width >> scenario.height;
+        } else if (keyword == "entity") {
+            ScenarioEntity entity;
+            fields >> entity.x >> entity.y;
+            if (!(fields >> entity.speed)) {
+                entity.speed = 1.0f;
+            }
+            scenario.entities.push_back(entity);
+        } else {
+            std::fprintf(stderr, "%s:%d: unknown keyword '%s'\n", path.c_str(), lineNumber, keyword.c_str());
+            return false;
+        }
+    }
+    if (scenario.width <= 0 || scenario.height <= 0) {
+        std::fprintf(stderr, "%s: missing or invalid 'grid' line\n", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Peak resident set size in bytes (0 where unavailable)
+ */
+size_t getPeakResidentBytes() {
+#if defined(__APPLE__)
+    struct rusage usage;
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? static_cast<size_t>(usage.ru_maxrss) : 0;
+#elif defined(__unix__)
+    struct rusage usage;
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? static_cast<size_t>(usage.ru_maxrss) * 1024 : 0;
+#else
+    return 0;
+#endif
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    RunnerOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    // Warnings and errors only: the report goes to stdout
+    auto consoleOutput = std::make_unique<Engine::ConsoleOutput>();
+    auto logger = std::make_unique<Engine::Logger>(std::move(consoleOutput), Engine::LogLevel::WARN);
+    Engine::GlobalLogger::setLogger(std::move(logger));
+
+    Scenario scenario;
+    if (!options.scenarioPath.empty()) {
+        if (!loadScenario(options.scenarioPath, scenario)) {
+            return 1;
+        }
+    } else {
+        scenario = generateScenario(options);
+    }
+
+    // World storage
+    EntityManager entityManager;
+    ComponentArray<Position> positions;
+    ComponentArray<PreviousPosition> previousPositions;
+    ComponentArray<GridPosition> gridPositions;
+    ComponentArray<GridMovement> gridMovements;
+    ComponentArray<GridBounds> gridBounds;
+    ComponentArray<Renderable> renderables;
+
+    const uint64_t positionBit = getComponentBit<Position>();
+    const uint64_t previousPositionBit = getComponentBit<PreviousPosition>();
+    const uint64_t gridPositionBit = getComponentBit<GridPosition>();
+    const uint64_t gridMovementBit = getComponentBit<GridMovement>();
+    const uint64_t gridBoundsBit = getComponentBit<GridBounds>();
+    const uint64_t renderableBit = getComponentBit<Renderable>();
+
+    const float cellSize = 32.0f;
+    const GridBounds worldBounds(0, 0, scenario.width - 1, scenario.height - 1);
+    for (const ScenarioEntity& spec : scenario.entities) {
+        Entity entity = entityManager.createEntity();
+        Position start{spec.x * cellSize, spec.y * cellSize, 0.0f};
+        positions.add(entity.id, start, positionBit, entityManager);
+        previousPositions.add(entity.id, PreviousPosition{start.x, start.y, start.z}, previousPositionBit, entityManager);
+        gridPositions.add(entity.id, GridPosition{spec.x, spec.y}, gridPositionBit, entityManager);
+        gridMovements.add(entity.id, GridMovement(spec.x, spec.y, spec.speed), gridMovementBit, entityManager);
+        gridBounds.add(entity.id, worldBounds, gridBoundsBit, entityManager);
+        renderables.add(entity.id, Renderable{24.0f, 24.0f, 0.8f, 0.3f, 0.2f, 1.0f}, renderableBit, entityManager);
+    }
+
+    // Systems: mock input, scenario orders, movement, counting renderer
+    MockInputManager inputManager;
+    CountingRenderer renderer;
+
+    auto movementSystem = std::make_unique<MovementSystem>(
+        &positions, &gridPositions, &gridMovements, nullptr, nullptr, nullptr, &gridBounds, nullptr);
+    movementSystem->setGridCellSize(cellSize);
+    MovementSystem* movement = movementSystem.get();
+
+    auto driverSystem = std::make_unique<ScenarioDriverSystem>(movement, &gridPositions, &gridMovements, options.seed);
+    ScenarioDriverSystem* driver = driverSystem.get();
+
+    auto renderSystem = std::make_unique<RenderSystem>(&renderer);
+    renderSystem->setComponentSources(&positions, &renderables, nullptr, &previousPositions);
+
+    SystemManager systemManager;
+    systemManager.registerSystem(std::make_unique<InputSystem>(&inputManager));
+    systemManager.registerSystem(std::move(driverSystem));
+    systemManager.registerSystem(std::move(movementSystem));
+    systemManager.registerSystem(std::move(renderSystem));
+
+    Profiler profiler;
+    systemManager.setProfiler(&profiler);
+    if (!options.tracePath.empty()) {
+        profiler.beginCapture();
+    }
+
+    std::printf("Headless run: %zu entities on %dx%d grid, %llu ticks\n",
+                scenario.entities.size(), scenario.width, scenario.height,
+                static_cast<unsigned long long>(options.ticks));
+
+    // Run ticks back to back at a fixed step
+    const float step = 1.0f / 60.0f;
+    const auto runStart = std::chrono::steady_clock::now();
+    for (uint64_t tick = 0; tick < options.ticks; ++tick) {
+        TransformUtils::storePreviousPositions(positions, previousPositions, previousPositionBit, entityManager);
+        systemManager.updateAll(step, entityManager);
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - runStart).count();
+    const double ticksPerSecond = seconds > 0.0 ? static_cast<double>(options.ticks) / seconds : 0.0;
+
+    if (!options.tracePath.empty()) {
+        profiler.endCapture();
+        std::ofstream traceFile(options.tracePath);
+        if (!traceFile || !profiler.writeChromeTrace(traceFile)) {
+            std::fprintf(stderr, "Failed to write trace: %s\n", options.tracePath.c_str());
+        }
+    }
+
+    // Order-sensitive checksum of final grid state: equal across runs with the same inputs
+    uint64_t checksum = 1469598103934665603ull;
+    for (size_t i = 0; i < gridPositions.size(); ++i) {
+        const GridPosition& cell = gridPositions.getByIndex(i);
+        checksum = (checksum ^ static_cast<uint32_t>(cell.x)) * 1099511628211ull;
+        checksum = (checksum ^ static_cast<uint32_t>(cell.y)) * 1099511628211ull;
+    }
+
+    std::printf("\nElapsed: %.3f s, %.1f ticks/sec (%.4f ms/tick)\n",
+                seconds, ticksPerSecond, options.ticks > 0 ? seconds * 1000.0 / static_cast<double>(options.ticks) : 0.0);
+    std::printf("Orders issued: %llu, draw calls: %llu, state checksum: %016llx\n\n",
+                static_cast<unsigned long long>(driver->ordersIssued),
+                static_cast<unsigned long long>(renderer.drawCalls),
+                static_cast<unsigned long long>(checksum));
+
+    std::ostringstream timings;
+    profiler.writeSummary(timings);
+    std::printf("%s\n", timings.str().c_str());
+
+    MemoryReport memoryReport;
+    memoryReport.track("Position", positions);
+    memoryReport.track("PreviousPosition", previousPositions);
+    memoryReport.track("GridPosition", gridPositions);
+    memoryReport.track("GridMovement", gridMovements);
+    memoryReport.track("GridBounds", gridBounds);
+    memoryReport.track("Renderable", renderables);
+    memoryReport.trackEntityManager(entityManager);
+    memoryReport.collect();
+    std::printf("%s\n", memoryReport.formatTable().c_str());
+    std::printf("ECS allocated: %.2f MiB, peak RSS: %.2f MiB\n",
+                static_cast<double>(memoryReport.getTotalBytesAllocated()) / (1024.0 * 1024.0),
+                static_cast<double>(getPeakResidentBytes()) / (1024.0 * 1024.0));
+
+    if (options.minTicksPerSecond > 0.0 && ticksPerSecond < options.minTicksPerSecond) {
+        std::printf("FAIL: %.1f ticks/sec is below --min-tps %.1f\n", ticksPerSecond, options.minTicksPerSecond);
+        return 2;
+    }
+    return 0;
+}
@@ -3,6 +3,7 @@
 #include "Entity.h"
 #include "EntityManager.hpp"
 #include "Logger.hpp"
+#include "MemoryStats.hpp"
 #include "RenderSystem.hpp"
 #include "Rendering.hpp"
 #include "SFMLRenderer.hpp"
@@ -10,8 +11,11 @@
 #include "SFMLWindowManager.hpp"
 #include "../engine/input/include/SFMLInputManager.hpp"
 #include "../engine/ecs/systems/include/InputSystem.hpp"
+#include "FixedTimestep.hpp"
 #include "SystemManager.hpp"
 #include "Transform.hpp"
+#include "TransformUtils.hpp"
+#include <chrono>
 #include <cmath>
 #include <memory>
 
@@ -24,6 +28,7 @@
  * 3. Input system integration with keyboard and mouse handling
  * 4. Interactive entity control with arrow keys
  * 5. Mouse click logging and real SFML graphics output
+ * 6. Fixed-timestep simulation with interpolated rendering
  */
 
 using namespace ECS;
@@ -59,13 +64,20 @@ int main() {
 
     // Create component arrays
     ComponentArray<Position> positionComponents;
+    ComponentArray<PreviousPosition> previousPositionComponents;
     ComponentArray<Renderable> renderableComponents;
 
+    // Renderer draws interpolated component data
+    RenderSystem renderSystem(renderer.get());
+    renderSystem.setComponentSources(&positionComponents, &renderableComponents,
+                                     nullptr, &previousPositionComponents);
+
     LOG_INFO("ECS", "Setting up interactive demo scene...");
 
     // Get component bits
     uint64_t positionBit = getComponentBit<Position>();
     uint64_t renderableBit = getComponentBit<Renderable>();
+    uint64_t previousPositionBit = getComponentBit<PreviousPosition>();
 
     // Create some demo entities with rectangles (no texture files needed)
 
@@ -79,7 +91,7 @@ int main() {
     
     // Set red rectangle as the controllable entity
     inputSystem->setControlledEntity(redRect.id);
-    inputSystem->setMovementSpeed(5.0f); // Moderate movement speed
+    inputSystem->setMovementSpeed(300.0f); // Pixels per second
 
     // Green rectangle in top-right
     Entity greenRect = entityManager.createEntity();
@@ -113,6 +125,12 @@ int main() {
                              {200.0f, 200.0f, 1.0f, 0.0f, 1.0f, 0.5f},
                              renderableBit, entityManager);
 
+    // Memory accounting for ECS storage (logged periodically below)
+    MemoryReport memoryReport;
+    memoryReport.track("Position", positionComponents);
+    memoryReport.track("Renderable", renderableComponents);
+    memoryReport.trackEntityManager(entityManager);
+
     LOG_INFO("ECS", "Created " +
                         std::to_string(entityManager.getActiveEntityCount()) +
                         " demo entities");
@@ -122,11 +140,18 @@ int main() {
     LOG_INFO("Main", "- Press ESCAPE or close window to exit");
     LOG_INFO("Main", "Starting interactive demo...");
 
-    // Main game loop
+    // Main game loop: fixed 60 Hz simulation, rendering at display rate
+    FixedTimestep timestep(1.0f / 60.0f, 5);
+    auto lastFrameTime = std::chrono::steady_clock::now();
+    uint64_t simTick = 0;
     int frameCount = 0;
     while (windowManager->isWindowOpen()) {
-      // Let the input system process ALL events
-      inputSystem->update(entityManager, 1.0f);
+      auto now = std::chrono::steady_clock::now();
+      float frameSeconds = std::chrono::duration<float>(now - lastFrameTime).count();
+      lastFrameTime = now;
+
+      // Let the input system process ALL events (once per rendered frame)
+      inputSystem->update(entityManager, frameSeconds);
       
       // Check if window close was requested or ESC key was pressed
       if (inputManager->wasWindowCloseRequested() || inputManager->wasKeyPressed(KeyCode::Escape)) {
@@ -139,78 +164,65 @@ int main() {
         windowManager->closeWindow();
       }
       
-      // Handle keyboard input for controlled entity manually 
-      // (since our InputSystem logs but doesn't move entities directly)
-      EntityID controlledId = inputSystem->getControlledEntity();
-      if (controlledId != INVALID_ENTITY) {
-        Position* controlledPos = positionComponents.get(controlledId);
-        if (controlledPos) {
-          float moveSpeed = inputSystem->getMovementSpeed();
+      // Fixed simulation steps (snapshot positions first for interpolation)
+      timestep.run(frameSeconds, [&](float step) {
+        TransformUtils::storePreviousPositions(positionComponents, previousPositionComponents,
+                                               previousPositionBit, entityManager);
+
+        // Handle keyboard input for controlled entity manually 
+        // (since our InputSystem logs but doesn't move entities directly)
+        EntityID controlledId = inputSystem->getControlledEntity();
+        if (controlledId != INVALID_ENTITY) {
+          Position* controlledPos = positionComponents.get(controlledId);
+          if (controlledPos) {
+            float moveSpeed = inputSystem->getMovementSpeed() * step;
           
-          if (inputManager->isKeyPressed(KeyCode::Left)) {
-            controlledPos->x -= moveSpeed;
-          }
-          if (inputManager->isKeyPressed(KeyCode::Right)) {
-            controlledPos->x += moveSpeed;
-          }
-          if (inputManager->isKeyPressed(KeyCode::Up)) {
-            controlledPos->y -= moveSpeed;
-          }
-          if (inputManager->isKeyPressed(KeyCode::Down)) {
-            controlledPos->y += moveSpeed;
-          }
+            if (inputManager->isKeyPressed(KeyCode::Left)) {
+              controlledPos->x -= moveSpeed;
+            }
+            if (inputManager->isKeyPressed(KeyCode::Right)) {
+              controlledPos->x += moveSpeed;
+            }
+            if (inputManager->isKeyPressed(KeyCode::Up)) {
+              controlledPos->y -= moveSpeed;
+            }
+            if (inputManager->isKeyPressed(KeyCode::Down)) {
+              controlledPos->y += moveSpeed;
+            }
           
-          // Keep entity within window bounds
-          if (controlledPos->x < 0) controlledPos->x = 0;
-          if (controlledPos->y < 0) controlledPos->y = 0;
-          if (controlledPos->x > 700) controlledPos->x = 700; // 800 - 100 (width)
-          if (controlledPos->y > 500) controlledPos->y = 500; // 600 - 100 (height)
+            // Keep entity within window bounds
+            if (controlledPos->x < 0) controlledPos->x = 0;
+            if (controlledPos->y < 0) controlledPos->y = 0;
+            if (controlledPos->x > 700) controlledPos->x = 700; // 800 - 100 (width)
+            if (controlledPos->y > 500) controlledPos->y = 500; // 600 - 100 (height)
+          }
         }
-      }
 
-      // Begin rendering frame
-      renderer->beginFrame();
-      renderer->clear();
-
-      // Manual rendering loop (simplified for demo)
-      const auto &positions = positionComponents.getComponents();
-      const auto &posEntityIDs = positionComponents.getEntityIDs();
-
-      // Render entities that have both Position and Renderable components
-      for (size_t i = 0; i < positions.size(); ++i) {
-        EntityID entityId = posEntityIDs[i];
-
-        // Check if this entity also has a Renderable component
-        const Renderable *renderable = renderableComponents.get(entityId);
-        if (renderable) {
-          const Position &pos = positions[i];
-          renderer->renderRect(pos.x, pos.y, renderable->width,
-                               renderable->height, renderable->red,
-                               renderable->green, renderable->blue,
-                               renderable->alpha);
+        // Simple animation: move yellow rectangle in a circle
+        simTick++;
+        if (simTick % 120 == 0) { // Every 2 seconds of simulation time
+          Position *yellowPos = positionComponents.get(yellowRect.id);
+          if (yellowPos) {
+            float angle = (simTick / 120.0f) * 3.14159f * 2.0f /
+                          10.0f; // Full circle over 20 seconds
+            yellowPos->x = 350.0f + 100.0f * std::cos(angle);
+            yellowPos->y = 250.0f + 100.0f * std::sin(angle);
+          }
         }
-      }
+      });
 
-      // End rendering frame
-      renderer->endFrame();
-
-      // Simple animation: move yellow rectangle in a circle
+      // Render between the last two simulation states
+      renderSystem.setInterpolationAlpha(timestep.getAlpha());
+      renderSystem.update(frameSeconds, entityManager);
       frameCount++;
-      if (frameCount % 120 == 0) { // Every 2 seconds at 60 FPS
-        Position *yellowPos = positionComponents.get(yellowRect.id);
-        if (yellowPos) {
-          float angle = (frameCount / 120.0f) * 3.14159f * 2.0f /
-                        10.0f; // Full circle over 20 seconds
-          yellowPos->x = 350.0f + 100.0f * std::cos(angle);
-          yellowPos->y = 250.0f + 100.0f * std::sin(angle);
-        }
-      }
 
       // Print frame info occasionally
       if (frameCount % 300 == 0) { // Every 5 seconds
         LOG_INFO("Render",
                  "Frame " + std::to_string(frameCount) + " - Entities: " +
                      std::to_string(entityManager.getActiveEntityCount()));
+        memoryReport.collect();
+        LOG_INFO("Memory", "\n" + memoryReport.formatTable());
       }
     }
 